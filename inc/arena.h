@@ -0,0 +1,33 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "constants.h"
+
+#define ARENA_ALIGNMENT 16
+
+/**
+ * struct Arena - Bump allocator over one fixed block of memory
+ * @base: start of the block
+ * @size: size of the block in bytes
+ * @used: number of bytes handed out so far
+ * @borrowed: the block was carved out of another arena, which owns it
+ *
+ * Description: Allocations are never freed one by one; arena_reset()
+ * releases all of them at once so the block can be reused.
+ */
+struct Arena
+{
+	unsigned char *base;
+	size_t size;
+	size_t used;
+	bool borrowed;
+};
+
+bool arena_init(struct Arena *arena, size_t size);
+bool arena_init_from(struct Arena *arena, struct Arena *parent, size_t size);
+void *arena_alloc(struct Arena *arena, size_t bytes);
+void *arena_calloc(struct Arena *arena, size_t count, size_t size);
+void arena_reset(struct Arena *arena);
+void arena_free(struct Arena *arena);
+
+#endif
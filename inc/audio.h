@@ -0,0 +1,180 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include "structs.h"
+
+#define AUDIO_RATE 44100
+#define AUDIO_FRAMES 512
+#define AUDIO_VOICES 64
+#define AUDIO_COMMANDS 256
+#define AUDIO_HUMS 8
+#define AUDIO_NEAR (TILE_SIZE / 2.0f)
+#define AUDIO_RANGE (16 * TILE_SIZE)
+#define AUDIO_WALL_GAIN 0.35f
+#define AUDIO_THIN_GAIN 0.6f
+#define AUDIO_GRATE_GAIN 0.9f
+#define AUDIO_MIN_OCCLUSION 0.02f
+#define AUDIO_OCCLUSION_STEP 0.01f
+#define AUDIO_STEP_DISTANCE (TILE_SIZE * 3 / 4)
+#define AUDIO_MASTER_GAIN 0.5f
+
+/**
+ * enum AudioSound - Sounds the mixer can play, synthesized at start up
+ * @AUDIO_HUM: one second of a light's buzz, seamless when looped
+ * @AUDIO_STEP: a footstep
+ * @AUDIO_CLICK: a switch being flipped
+ * @AUDIO_SOUNDS: number of sounds
+ */
+enum AudioSound
+{
+	AUDIO_HUM,
+	AUDIO_STEP,
+	AUDIO_CLICK,
+	AUDIO_SOUNDS
+};
+
+/**
+ * enum AudioCommandType - Requests the game thread sends the mixer
+ * @AUDIO_PLAY: start a sound on a voice, from its beginning
+ * @AUDIO_STOP: silence a voice
+ * @AUDIO_OCCLUDE: set the share of a voice's sound that gets through the
+ *		walls to the listener
+ * @AUDIO_LISTEN: move the listener
+ */
+enum AudioCommandType
+{
+	AUDIO_PLAY,
+	AUDIO_STOP,
+	AUDIO_OCCLUDE,
+	AUDIO_LISTEN
+};
+
+/**
+ * struct AudioCommand - One request in the command queue
+ * @type: what is requested
+ * @voice: voice the request is about, unused by AUDIO_LISTEN
+ * @sound: sound to play
+ * @loop: the sound repeats until stopped
+ * @x: x coordinate of the voice or the listener, in world units
+ * @y: y coordinate of the voice or the listener, in world units
+ * @value: gain for AUDIO_PLAY, share heard for AUDIO_OCCLUDE, facing
+ *		angle for AUDIO_LISTEN
+ */
+struct AudioCommand
+{
+	enum AudioCommandType type;
+	int voice;
+	enum AudioSound sound;
+	bool loop;
+	float x;
+	float y;
+	float value;
+};
+
+/**
+ * struct AudioVoice - A sound being mixed, owned by the audio thread
+ * @samples: mono samples of the sound, NULL when the voice is silent
+ * @length: number of samples
+ * @position: next sample to mix
+ * @loop: the sound repeats
+ * @x: x coordinate of the source, in world units
+ * @y: y coordinate of the source, in world units
+ * @gain: loudness of the source
+ * @occlusion: share of the sound that gets through the walls
+ * @left: left gain reached at the end of the last block
+ * @right: right gain reached at the end of the last block
+ * @filtered: state of the low-pass filter muffling occluded sound
+ */
+struct AudioVoice
+{
+	const float *samples;
+	int length;
+	int position;
+	bool loop;
+	float x;
+	float y;
+	float gain;
+	float occlusion;
+	float left;
+	float right;
+	float filtered;
+};
+
+/**
+ * struct AudioSource - The game thread's view of a voice
+ * @x: x coordinate of the source, in world units
+ * @y: y coordinate of the source, in world units
+ * @until: tick at which a one-shot sound is over, 0 for a loop
+ * @light: static light a hum belongs to, -1 for other sounds
+ * @occlusion: last share heard sent to the mixer
+ * @active: the voice is in use
+ */
+struct AudioSource
+{
+	float x;
+	float y;
+	Uint32 until;
+	int light;
+	float occlusion;
+	bool active;
+};
+
+/**
+ * struct Audio - Software mixer fed through a lock-free command queue
+ * @device: audio device, 0 when mixing offline
+ * @sounds: synthesized mono samples of each sound
+ * @lengths: number of samples of each sound
+ * @commands: ring of AUDIO_COMMANDS requests
+ * @head: requests queued so far, only written by the game thread
+ * @tail: requests applied so far, only written by the audio thread
+ * @rejected: requests dropped because the ring was full
+ * @voices: voices being mixed, only touched by the audio thread
+ * @listener_x: listener x coordinate, audio thread copy
+ * @listener_y: listener y coordinate, audio thread copy
+ * @listener_angle: listener facing angle, audio thread copy
+ * @sources: voices as the game thread allocated them
+ * @lighting: lightmap the hums were placed from
+ * @step_x: position of each player at their last footstep
+ * @step_y: position of each player at their last footstep
+ *
+ * Description: The queue is single-producer, single-consumer like the
+ * capture ring: the game thread only writes the slot at @head and the
+ * audio callback only reads the slot at @tail. The callback drains it at
+ * the start of every block, so it never waits on the game and the game
+ * never waits on it; the map itself is only read by the game thread,
+ * which sends the occlusion it traces.
+ */
+struct Audio
+{
+	SDL_AudioDeviceID device;
+	float *sounds[AUDIO_SOUNDS];
+	int lengths[AUDIO_SOUNDS];
+	struct AudioCommand commands[AUDIO_COMMANDS];
+	SDL_atomic_t head;
+	SDL_atomic_t tail;
+	long rejected;
+	struct AudioVoice voices[AUDIO_VOICES];
+	float listener_x;
+	float listener_y;
+	float listener_angle;
+	struct AudioSource sources[AUDIO_VOICES];
+	const struct Lighting *lighting;
+	float step_x[MAX_PLAYERS];
+	float step_y[MAX_PLAYERS];
+};
+
+struct Audio *audio_create(bool open_device);
+void audio_destroy(struct Audio *audio);
+bool audio_push(struct Audio *audio, const struct AudioCommand *command);
+int audio_play(struct Audio *audio, enum AudioSound sound, float x, float y,
+		float gain, bool loop);
+void audio_stop(struct Audio *audio, int voice);
+void audio_callback(void *data, Uint8 *stream, int length);
+void audio_mix(struct Audio *audio, float *stream, int frames);
+bool audio_synthesize(struct Audio *audio);
+void audio_update(struct Game *game);
+void audio_click(struct Game *game);
+float audio_occlusion(const struct Game *game, float from_x, float from_y,
+		float to_x, float to_y);
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include "structs.h"
+
+#define CAPTURE_SLOTS 8
+#define CAPTURE_TARGETS 2
+#define CAPTURE_FPS 60
+#define CAPTURE_Y4M_SUFFIX ".y4m"
+#define CAPTURE_INDEX_SUFFIX ".idx"
+
+/**
+ * struct CaptureFrame - One slot of the capture ring
+ * @pixels: ARGB8888 pixels of the frame, width * height of them
+ * @number: frame number since capture started, dropped frames included
+ * @ticks: SDL tick the frame was presented at
+ */
+struct CaptureFrame
+{
+	Uint32 *pixels;
+	Uint32 number;
+	Uint32 ticks;
+};
+
+/**
+ * struct Capture - Frames recorded to disk by a writer thread
+ * @file: video file, Y4M or raw 24-bit RGB frames
+ * @index: sidecar index of raw captures, one line per frame written;
+ *		NULL for Y4M
+ * @width: frame width in pixels
+ * @height: frame height in pixels
+ * @frames: ring of CAPTURE_SLOTS frames
+ * @head: frames queued so far, only written by the main thread
+ * @tail: frames written so far, only written by the writer thread
+ * @ready: counts queued frames the writer has not woken up for yet
+ * @quit: tells the writer to exit once the ring is empty
+ * @failed: set by the writer when the disk refuses a write
+ * @thread: writer thread
+ * @planes: writer scratch, one encoded frame
+ * @number: number of the next frame offered
+ * @dropped: frames dropped because the ring was full
+ * @renderer: renderer captured
+ * @targets: textures the frames are drawn to in turn; NULL when the
+ *		renderer has no render targets, frames then being read from the
+ *		back buffer
+ * @target: index of the texture the frame is drawn to
+ * @pending: the other texture holds a frame not read back yet
+ * @pending_number: number of that frame
+ * @pending_ticks: SDL tick that frame was presented at
+ *
+ * Description: The ring is single-producer, single-consumer: the main
+ * thread only fills the slot at @head and the writer only reads the slot
+ * at @tail, so neither ever waits for the other. A full ring drops the
+ * frame instead of stalling the game. With @targets, a frame is read back
+ * one frame after it was drawn, when the GPU has long finished it, rather
+ * than waiting for the frame being drawn to complete. The copy itself
+ * still runs on the main thread: SDL_RenderReadPixels is the only
+ * readback SDL2 offers and it is synchronous.
+ */
+struct Capture
+{
+	FILE *file;
+	FILE *index;
+	int width;
+	int height;
+	struct CaptureFrame frames[CAPTURE_SLOTS];
+	SDL_atomic_t head;
+	SDL_atomic_t tail;
+	SDL_sem *ready;
+	SDL_atomic_t quit;
+	SDL_atomic_t failed;
+	SDL_Thread *thread;
+	Uint8 *planes;
+	Uint32 number;
+	long dropped;
+	SDL_Renderer *renderer;
+	SDL_Texture *targets[CAPTURE_TARGETS];
+	int target;
+	bool pending;
+	Uint32 pending_number;
+	Uint32 pending_ticks;
+};
+
+struct Capture *capture_create(SDL_Renderer *renderer, const char *path);
+void capture_destroy(struct Capture *capture);
+void capture_begin(struct Capture *capture);
+bool capture_frame(struct Capture *capture);
+void capture_flush(struct Capture *capture);
+bool capture_write_header(struct Capture *capture);
+bool capture_encode(struct Capture *capture, const struct CaptureFrame *frame);
+
+#endif
@@ -0,0 +1,216 @@
+/*
+ * Cast kernel template, without include guard: every inclusion defines
+ * one instance of the ray caster, for the tile size CAST_TILE, its
+ * functions named by CAST_NAME() and declared with CAST_LINKAGE. A
+ * literal CAST_TILE lets the compiler turn the divisions by the tile
+ * size into multiplications and shifts, which a tile size read from the
+ * config does not allow. The parameters are undefined at the end.
+ */
+
+/**
+ * cast_horizontal_ray - Casts a horizontal ray and
+ *			determines its intersection with walls.
+ * @game: Pointer to the Game structure containing game state.
+ * @viewer: Pointer to the Player the ray starts from.
+ * @ray_angle: Angle of the ray to cast.
+ * @facing_down: Flag indicating whether the ray is facing downwards.
+ * @facing_right: Flag indicating whether the ray is facing rightwards.
+ * @horiz_x: Pointer to store the x coordinate
+ *		of the horizontal ray intersection.
+ * @horiz_y: Pointer to store the y coordinate
+ *		of the horizontal ray intersection.
+ * @horiz_distance: Pointer to store the distance
+ *		from the player to the horizontal ray intersection.
+ *
+ * This function casts a horizontal ray and calculates
+ * where it intersects with the nearest wall.
+ * It updates horiz_x, horiz_y, and horiz_distance
+ * with the intersection point and distance.
+ */
+CAST_LINKAGE void CAST_NAME(horizontal_ray)(const struct Game *game,
+		const struct Player *viewer, float ray_angle, int facing_down,
+		int facing_right, float *horiz_x, float *horiz_y,
+		float *horiz_distance)
+{
+	float y_intercept, x_intercept, y_step, x_step;
+	float next_horiz_x, next_horiz_y, x_to_check, y_to_check;
+	int map_x, map_y;
+
+	y_intercept = floor(viewer->y / CAST_TILE) * CAST_TILE;
+	y_intercept += facing_down ? CAST_TILE : 0;
+	x_intercept = (viewer->x + (y_intercept - viewer->y)
+			/ tan(ray_angle));
+
+	y_step = CAST_TILE;
+	y_step *= facing_down ? 1 : -1;
+	x_step = CAST_TILE / tan(ray_angle);
+	x_step *= (facing_right && x_step < 0) ? -1 : 1;
+	x_step *= (!facing_right && x_step > 0) ? -1 : 1;
+
+	next_horiz_x = x_intercept;
+	next_horiz_y = y_intercept;
+
+	while (next_horiz_x >= 0 && next_horiz_x < game->map_width * CAST_TILE &&
+			next_horiz_y >= 0 && next_horiz_y < game->map_height * CAST_TILE)
+	{
+		x_to_check = next_horiz_x;
+		y_to_check = next_horiz_y + (facing_down ? 0 : -1);
+		if (x_to_check < 0 || x_to_check >= game->map_width * CAST_TILE ||
+				y_to_check < 0 || y_to_check >= game->map_height * CAST_TILE)
+			break;
+		map_x = (int)(x_to_check / CAST_TILE);
+		map_y = (int)(y_to_check / CAST_TILE);
+		if (map_cell(game, map_x, map_y) == MAP_WALL)
+		{
+			*horiz_x = next_horiz_x;
+			*horiz_y = next_horiz_y;
+			*horiz_distance = sqrt(pow(*horiz_x - viewer->x, 2) +
+					pow(*horiz_y - viewer->y, 2));
+			return;
+		}
+		next_horiz_x += x_step;
+		next_horiz_y += y_step;
+	}
+	*horiz_distance = INFINITY;
+}
+
+/**
+ * cast_vertical_ray - Casts a vertical ray
+ *			and determines its intersection with walls.
+ * @game: Pointer to the Game structure containing game state.
+ * @viewer: Pointer to the Player the ray starts from.
+ * @ray_angle: Angle of the ray to cast.
+ * @facing_down: Flag indicating whether the ray is facing downwards.
+ * @facing_right: Flag indicating whether the ray is facing rightwards.
+ * @vert_x: Pointer to store the x coordinate of the vertical ray intersection.
+ * @vert_y: Pointer to store the y coordinate of the vertical ray intersection.
+ * @vert_distance: Pointer to store the distance
+ *		from the player to the vertical ray intersection.
+ *
+ * This function casts a vertical ray and calculates
+ * where it intersects with the nearest wall.
+ * It updates vert_x, vert_y, and vert_distance
+ * with the intersection point and distance.
+ */
+CAST_LINKAGE void CAST_NAME(vertical_ray)(const struct Game *game,
+		const struct Player *viewer, float ray_angle, int facing_down,
+		int facing_right, float *vert_x, float *vert_y, float *vert_distance)
+{
+	float x_intercept, y_intercept, x_step, y_step;
+	float next_vert_x, next_vert_y, x_to_check, y_to_check;
+	int map_x, map_y;
+
+	x_intercept = floor(viewer->x / CAST_TILE) * CAST_TILE;
+	x_intercept += facing_right ? CAST_TILE : 0;
+	y_intercept = (viewer->y + (x_intercept - viewer->x)
+			* tan(ray_angle));
+	x_step = CAST_TILE;
+	x_step *= facing_right ? 1 : -1;
+	y_step = CAST_TILE * tan(ray_angle);
+	y_step *= (facing_down && y_step < 0) ? -1 : 1;
+	y_step *= (!facing_down && y_step > 0) ? -1 : 1;
+
+	next_vert_x = x_intercept;
+	next_vert_y = y_intercept;
+
+	while (next_vert_x >= 0 && next_vert_x < game->map_width * CAST_TILE &&
+			next_vert_y >= 0 && next_vert_y < game->map_height * CAST_TILE)
+	{
+		x_to_check = next_vert_x + (facing_right ? 0 : -1);
+		y_to_check = next_vert_y;
+
+		if (x_to_check < 0 || x_to_check >= game->map_width * CAST_TILE ||
+				y_to_check < 0 || y_to_check >= game->map_height * CAST_TILE)
+			break;
+		map_x = (int)(x_to_check / CAST_TILE);
+		map_y = (int)(y_to_check / CAST_TILE);
+		if (map_cell(game, map_x, map_y) == MAP_WALL)
+		{
+			*vert_x = next_vert_x;
+			*vert_y = next_vert_y;
+			*vert_distance = sqrt(pow(*vert_x - viewer->x, 2) +
+					pow(*vert_y - viewer->y, 2));
+			return;
+		}
+		next_vert_x += x_step;
+		next_vert_y += y_step;
+	}
+	*vert_distance = INFINITY;
+}
+
+/**
+ * cast_single_ray - Casts a single ray
+ *		and determines its intersection with walls.
+ * @game: Pointer to the Game structure containing game state.
+ * @viewer: Pointer to the Player the ray starts from.
+ * @ray_angle: Angle of the ray to cast.
+ * @hit: Pointer to the RayHit to fill.
+ *
+ * This function casts a single ray and calculates
+ * where it intersects with the nearest wall
+ * in both horizontal and vertical directions.
+ * It fills hit with the intersection point based on the shorter distance;
+ * a ray hitting nothing is given an infinite distance, ending at (0, 0).
+ */
+CAST_LINKAGE void CAST_NAME(single_ray)(const struct Game *game,
+		const struct Player *viewer, float ray_angle, struct RayHit *hit)
+{
+	float horiz_x = 0, horiz_y = 0, vert_x = 0, vert_y = 0;
+	float horiz_distance = INFINITY, vert_distance = INFINITY;
+	int facing_down, facing_right;
+
+	ray_angle = fmodf(ray_angle, 2 * PI);
+	if (ray_angle < 0)
+		ray_angle += 2 * PI;
+
+	facing_down = (ray_angle > 0 && ray_angle < PI);
+	facing_right = (ray_angle < 0.5 * PI || ray_angle > 1.5 * PI);
+
+	CAST_NAME(horizontal_ray)(game, viewer, ray_angle, facing_down,
+			facing_right, &horiz_x, &horiz_y, &horiz_distance);
+	CAST_NAME(vertical_ray)(game, viewer, ray_angle, facing_down,
+			facing_right, &vert_x, &vert_y, &vert_distance);
+
+	hit->angle = ray_angle;
+	if (horiz_distance < vert_distance)
+	{
+		hit->end_x = horiz_x;
+		hit->end_y = horiz_y;
+		hit->distance = horiz_distance;
+		hit->is_vertical = 0;
+	}
+	else
+	{
+		hit->end_x = vert_x;
+		hit->end_y = vert_y;
+		hit->distance = vert_distance;
+		hit->is_vertical = 1;
+	}
+}
+
+/**
+ * cast_rays - Casts the rays of a range of camera columns.
+ * @game: Pointer to the Game structure containing game state.
+ * @camera: Pointer to the Camera whose hits are filled.
+ * @first: First column to cast.
+ * @last: Column after the last one to cast.
+ *
+ * This function calculates the direction of each column's ray and casts it
+ * to detect intersections with walls. Column i looks along
+ * (angle_index + i) * angle_step. Only the map is read, so disjoint
+ * column ranges can be cast from several threads at once.
+ */
+CAST_LINKAGE void CAST_NAME(rays)(const struct Game *game,
+		struct Camera *camera, int first, int last)
+{
+	int i;
+	float angle_step = FOV_RADIAN / (camera->viewport.w - 1);
+
+	for (i = first; i < last; i++)
+		CAST_NAME(single_ray)(game, camera->player,
+				(camera->angle_index + i) * angle_step, &camera->hits[i]);
+}
+
+#undef CAST_TILE
+#undef CAST_NAME
+#undef CAST_LINKAGE
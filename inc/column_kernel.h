@@ -0,0 +1,79 @@
+/*
+ * Column kernel template, without include guard: every inclusion defines
+ * COLUMN_NAME(), drawing one column of views COLUMN_WORDS * 64 rows high
+ * at most, with tiles COLUMN_TILE units wide. It is declared with
+ * COLUMN_LINKAGE. Literal parameters keep the span buffer as small as the
+ * view and let the compiler unroll its loops; COLUMN_WRAP(), the position
+ * of a hit along its tile, defaults to a floor that is only exact for a
+ * power-of-two COLUMN_TILE, where the generic instance calls fmod(). The
+ * parameters are undefined at the end.
+ */
+
+#ifndef COLUMN_WRAP
+#define COLUMN_WRAP(position) ((position) - floorf((position) / COLUMN_TILE) \
+		* COLUMN_TILE)
+#endif
+
+/**
+ * draw_3d_view - Render one column of a camera's 3D view
+ * @game: Pointer to the Game structure
+ * @camera: Pointer to the Camera, its viewport already set on the renderer
+ * @column: Viewport column, its hit already cast
+ *
+ * The column is drawn front to back through a ColumnSpan, so no row is
+ * written twice. A flat map is drawn from the cast hit alone: the floor
+ * up to the wall, then the wall, a thin wall standing in for it when one
+ * is nearer. A lit map is walked cell by cell like a map with heights,
+ * so its floor takes the light of every tile it crosses. The grates in
+ * front are then blended in back to front.
+ */
+COLUMN_LINKAGE void COLUMN_NAME(struct Game *game, const struct Camera *camera,
+		int column)
+{
+	const struct RayHit *hit = &camera->hits[column];
+	const struct Player *player = camera->player;
+	struct RayLayer *layers = hit->layer_count ?
+		camera->layers + column * CAST_MAX_LAYERS : NULL;
+	const struct RayLayer *thin = NULL;
+	struct ColumnSpan span;
+	float corrected_distance, hit_x;
+	int word, i;
+
+	span.column = column;
+	span.drawn = 0;
+	memset(span.written, 0, COLUMN_WORDS * sizeof(*span.written));
+	span.bottom = camera->viewport.h;
+	span.horizon = camera->viewport.h / 2.0f;
+	span.eye = map_cell_top(game, (int)(player->x / COLUMN_TILE),
+			(int)(player->y / COLUMN_TILE)) + COLUMN_TILE / 2.0f;
+	span.projection = camera->projection;
+	span.cosine = cosf(hit->angle - player->angle);
+	if (hit->layer_count && (layers[hit->layer_count - 1].type == MAP_THIN_X
+				|| layers[hit->layer_count - 1].type == MAP_THIN_Y))
+		thin = &layers[hit->layer_count - 1];
+	if (game->map_has_heights || game->lighting)
+		draw_height_column(game, camera, &span);
+	else
+	{
+		corrected_distance = thin ? thin->distance * span.cosine :
+			calculate_corrected_distance(hit->distance, hit->angle,
+					player->angle);
+		hit_x = thin ? thin->hit_x : hit->is_vertical ?
+			COLUMN_WRAP(hit->end_y) : COLUMN_WRAP(hit->end_x);
+		for (i = 0; i < hit->layer_count; i++)
+			layers[i].clip = span.bottom;
+		draw_span_surface(game, &span, 0, corrected_distance, 255);
+		draw_span_face(game, &span, 0, COLUMN_TILE, corrected_distance,
+				hit_x, 255);
+	}
+	draw_span_layers(game, &span, layers, hit->layer_count);
+	game->stats.pixels_drawn += span.drawn;
+	for (word = 0; word < COLUMN_WORDS; word++)
+		game->stats.pixels_covered += __builtin_popcountll(span.written[word]);
+}
+
+#undef COLUMN_TILE
+#undef COLUMN_WORDS
+#undef COLUMN_NAME
+#undef COLUMN_LINKAGE
+#undef COLUMN_WRAP
@@ -0,0 +1,58 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <stdbool.h>
+
+#define CONFIG_MAX_WIDTH 3840
+#define CONFIG_MAX_HEIGHT 2160
+#define CONFIG_FIELD_SIZE 32
+#define CONFIG_LINE_FORMAT " %31[^= \t#] = %31s %c"
+
+#define WINDOW_WIDTH (config.window_width)
+#define WINDOW_HEIGHT (config.window_height)
+#define NUM_RAYS WINDOW_WIDTH
+#define FOV_DEGREES (config.fov_degrees)
+#define FOV_RADIAN (config.fov)
+#define FOV_HALF_RADIAN (config.fov_half)
+#define TILE_SIZE (config.tile_size)
+#define PLAYER_SPEED (config.player_speed)
+#define ROTATION_SPEED (config.rotation_speed)
+
+/**
+ * struct Config - Settings read once at start up, from the config file
+ *		and then the command line
+ * @window_width: window width in pixels, one ray per column
+ * @window_height: window height in pixels
+ * @fov_degrees: horizontal field of view, a divisor of 360 so the angle
+ *		grids of the casts close on themselves
+ * @tile_size: side of a map tile, in world units
+ * @player_speed: world units a held key moves a player per second
+ * @rotation_speed: radians a held key turns a player per second
+ * @fov: @fov_degrees in radians, derived
+ * @fov_half: half of @fov, derived
+ *
+ * Description: The settings were compile-time constants, and the macros
+ * naming them now read this structure, so the code using them did not
+ * change. The derived fields are computed once by config_derive() rather
+ * than wherever the macros are used.
+ */
+struct Config
+{
+	int window_width;
+	int window_height;
+	int fov_degrees;
+	int tile_size;
+	float player_speed;
+	float rotation_speed;
+	double fov;
+	double fov_half;
+};
+
+extern struct Config config;
+
+bool config_set(struct Config *settings, const char *key, const char *value);
+bool config_is_key(const char *key);
+void config_derive(struct Config *settings);
+bool config_load(struct Config *settings, const char *path);
+
+#endif
@@ -8,6 +8,8 @@
 #include <stdio.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
+#include "config.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -17,26 +19,41 @@
 #define GREY_COLOR 128
 #define PLAYER_SIZE 10
 #define YELLOW_COLOR (255, 255, 0)
-#define MAP_WIDTH 24
-#define MAP_HEIGHT 24
 #define MAP_WALL 1
 #define MAP_FLOOR 0
-#define TILE_SIZE 128
-#define SCREEN_WIDTH (MAP_WIDTH * TILE_SIZE)
-#define SCREEN_HEIGHT (MAP_HEIGHT * TILE_SIZE)
+#define MAP_MAX_DIMENSION 32768
+#define MINIMAP_TILES 24
+#define MAX_PLAYERS 2
+#define CAST_BATCH_COLUMNS 64
+#define VARIABLE_RATE_EDGE (TILE_SIZE / 32)
+#define STATS_INTERVAL_MS 1000
+#define FRAME_PERIOD_MS 16
+#define PACING_HISTORY 16
+#define PACING_MARGIN_MS 2
+#define LATENCY_BUCKETS 8
+#define SHADE_DISTANCE (24 * TILE_SIZE)
 #define DEGREE_TO_RADIAN(degree) ((degree) * (M_PI / 180.0))
-#define FOV_HALF_RADIAN (DEGREE_TO_RADIAN(FOV_DEGREES / 2))
-#define HALF_WINDOW_WIDTH (WINDOW_WIDTH / 2)
-#define PROJECTION_PLANE_DISTANCE (HALF_WINDOW_WIDTH / tan(FOV_HALF_RADIAN))
 #define PI 3.14159265
-#define FOV_DEGREES 60
-#define NUM_RAYS WINDOW_WIDTH
-#define WINDOW_WIDTH 1200
-#define WINDOW_HEIGHT 500
-#define MAX_LINE_HEIGHT 500
 #define MAP_WALL_CHAR '1'
 #define MAP_FLOOR_CHAR '0'
-#define PLAYER_SPEED 200.0f
-#define ROTATION_SPEED 2.0f
+#define MAP_LOW_WALL_CHAR 'a'
+#define MAP_THIN_X 2
+#define MAP_THIN_Y 3
+#define MAP_GRATE_X 4
+#define MAP_GRATE_Y 5
+#define MAP_LAYER_CHARS "|-!="
+#define CAST_MAX_LAYERS 8
+#define GRATE_TEXTURE_SIZE 64
+#define MAP_RAISED_FLOOR_CHAR 'A'
+#define MAP_TYPE_MASK 0xff
+#define MAP_HEIGHT_SHIFT 8
+#define MAP_HEIGHT_UNITS 8
+#define MAP_MAX_WALL_UNITS (2 * MAP_HEIGHT_UNITS)
+#define MAP_CELL(type, height) ((type) | (height) << MAP_HEIGHT_SHIFT)
+#define MAP_CELL_TYPE(cell) ((cell) & MAP_TYPE_MASK)
+#define MAP_HEIGHT_MASK 0xff
+#define MAP_CELL_HEIGHT(cell) ((cell) >> MAP_HEIGHT_SHIFT & MAP_HEIGHT_MASK)
+#define MAP_LIGHT_CHAR 'L'
+#define MAP_LIGHT_FLAG (1 << 16)
 
 #endif
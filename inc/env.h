@@ -0,0 +1,45 @@
+#ifndef ENV_H
+#define ENV_H
+
+#include "game.h"
+
+#define ENV_ACTION_SIZE 3
+#define ENV_HIT_SIZE 2
+#define ENV_BATCH_AGENTS 64
+#define ENV_SPAWN_ATTEMPTS 1024
+
+/**
+ * struct Env - Headless environment stepping many agents on one map
+ * @game: map holder; no window, renderer or texture is ever created
+ * @agents: one Player per agent
+ * @agent_count: number of agents
+ * @columns: rays cast per agent and step
+ * @observations: agent_count * columns * ENV_HIT_SIZE floats; for every
+ *		column, the wall distance in tiles and 1 for a vertical wall
+ *		side or 0 for a horizontal one
+ * @actions: actions of the step in progress
+ * @delta_time: duration of the step in progress, in seconds
+ * @jobs: worker threads stepping batches of ENV_BATCH_AGENTS agents
+ * @steps: number of env_step() calls since the last reset
+ */
+struct Env
+{
+	struct Game game;
+	struct Player *agents;
+	int agent_count;
+	int columns;
+	float *observations;
+	const float *actions;
+	float delta_time;
+	struct JobPool *jobs;
+	long steps;
+};
+
+struct Env *env_create(const char *map_path, int agent_count, int columns,
+		int thread_count);
+void env_destroy(struct Env *env);
+const float *env_reset(struct Env *env, Uint64 seed);
+const float *env_step(struct Env *env, const float *actions,
+		float delta_time);
+
+#endif
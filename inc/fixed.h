@@ -0,0 +1,72 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include "structs.h"
+
+#define FIX_SHIFT 16
+#define FIX_ONE (1 << FIX_SHIFT)
+#define FIX_FRACTION_MASK (FIX_ONE - 1)
+#define FIX_FROM_INT(value) ((fixed_t)(value) * FIX_ONE)
+#define FIX_MUL(a, b) ((fixed_t)(((Sint64)(a) * (b)) >> FIX_SHIFT))
+#define FIX_TO_FLOAT(value) ((float)(value) / FIX_ONE)
+#define FIX_PLAYER_RADIUS (PLAYER_SIZE * FIX_ONE / 2 / TILE_SIZE)
+#define FIX_Q30_SHIFT 30
+#define FIX_Q30_HALF_PI 1686629713LL
+
+/**
+ * struct FixedTables - Integer trig tables of the fixed-point engine
+ * @angles: number of angle units in a full turn
+ * @columns: number of angle units in the field of view, one per column
+ *		of a full-width view
+ * @sin: sine of every angle unit
+ * @cos: cosine of every angle unit
+ *
+ * Description: One angle unit is exactly one NUM_RAYS column of the
+ * field of view, so column angles never need rounding. The tables are
+ * filled with integer arithmetic only, which makes every build produce
+ * the same bits.
+ */
+struct FixedTables
+{
+	int angles;
+	int columns;
+	fixed_t *sin;
+	fixed_t *cos;
+};
+
+/**
+ * struct FixedHit - Wall hit of one fixed-point ray
+ * @distance: distance from the player to the wall, in tiles
+ * @x: x coordinate of the hit, in tiles
+ * @y: y coordinate of the hit, in tiles
+ * @is_vertical: 1 if the ray hit a vertical wall side, 0 otherwise
+ */
+struct FixedHit
+{
+	fixed_t distance;
+	fixed_t x;
+	fixed_t y;
+	int is_vertical;
+};
+
+struct FixedTables *fixed_tables_create(int columns);
+void fixed_tables_destroy(struct FixedTables *tables);
+int fixed_angle_wrap(const struct FixedTables *tables, int angle);
+
+void fixed_cast_ray(const struct Game *game, const struct FixedTables *tables,
+		const struct FixedPlayer *player, int angle, struct FixedHit *hit);
+void fixed_cast_rays(const struct Game *game, struct Camera *camera,
+		int first, int last);
+
+void fixed_rotate_player(const struct FixedTables *tables,
+		struct FixedPlayer *player, int amount);
+bool fixed_check_collision(const struct Game *game,
+		const struct FixedTables *tables, const struct FixedPlayer *player,
+		fixed_t new_x, fixed_t new_y);
+void fixed_move_player(const struct Game *game,
+		const struct FixedTables *tables, struct FixedPlayer *player,
+		fixed_t forward, fixed_t strafe);
+void fixed_handle_input(struct Game *game);
+void fixed_sync_players(struct Game *game);
+
+#endif
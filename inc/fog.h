@@ -0,0 +1,51 @@
+#ifndef FOG_H
+#define FOG_H
+
+#include "structs.h"
+
+#define FOG_TEXTURE_MAX 2048
+#define FOG_RUN_STRIDE 32
+#define FOG_FLOOR_PIXEL 0xa0646464
+#define FOG_WALL_PIXEL 0xffc8c8c8
+
+/**
+ * struct Fog - Tiles of the map the players have seen
+ * @explored: one bit per tile, row-major, set once a ray crossed the tile
+ * @width: number of tiles per row
+ * @height: number of rows
+ * @texture: one pixel per tile, explored tiles drawn, the others clear;
+ *		NULL until the minimap is first shown
+ * @untextured: the minimap is drawn tile by tile, the map being a world,
+ *		larger than FOG_TEXTURE_MAX or its texture having failed
+ * @dirty_first_x: first column revealed since @texture was updated
+ * @dirty_first_y: first row revealed since @texture was updated
+ * @dirty_last_x: column after the last one revealed since then
+ * @dirty_last_y: row after the last one revealed since then
+ *
+ * Description: The bits are set from the hits of the view's own rays,
+ * so exploring casts no extra ray; only the rectangle the newly revealed
+ * tiles span is uploaded to @texture.
+ */
+struct Fog
+{
+	Uint64 *explored;
+	int width;
+	int height;
+	SDL_Texture *texture;
+	bool untextured;
+	int dirty_first_x;
+	int dirty_first_y;
+	int dirty_last_x;
+	int dirty_last_y;
+};
+
+bool fog_reset(struct Game *game, int width, int height);
+void fog_destroy(struct Fog *fog);
+bool fog_explored(const struct Fog *fog, int map_x, int map_y);
+void fog_mark(struct Fog *fog, int map_y, int first_x, int last_x);
+void fog_triangle(struct Fog *fog, const float *corners);
+void fog_reveal(struct Game *game, const struct Camera *camera, int first,
+		int last);
+void fog_update_texture(struct Game *game);
+
+#endif
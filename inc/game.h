@@ -6,11 +6,37 @@
 #include "raycasting.h"
 #include "map.h"
 #include "rendering.h"
+#include "pathfind.h"
+#include "world.h"
+#include "jobs.h"
+#include "fixed.h"
+#include "level.h"
+#include "capture.h"
+#include "metrics.h"
+#include "lighting.h"
+#include "audio.h"
+#include "net.h"
+#include "fog.h"
+#include "snapshot.h"
 
 void game_cleanup(struct Game *game, int exit_status);
 bool sdl_initialize(struct Game *game, const char *map_file_path);
 SDL_Texture* load_texture(SDL_Renderer *renderer, const char *path);
 bool create_window_and_renderer(struct Game *game);
 bool initialize_sdl_and_img(void);
+bool load_textures(struct Game *game);
+bool start_services(struct Game *game);
+bool start_rendering(struct Game *game);
+bool load_map_data(struct Game *game);
+bool start_network(struct Game *game);
+bool parse_options(int argc, char *argv[], struct Options *options);
+void stats_frame_end(struct Game *game);
+void update_world(struct Game *game);
+void update_lights(struct Game *game);
+void print_usage(const char *name);
+void pacing_wait(struct Game *game);
+void pacing_input(struct Game *game, const SDL_Event *event);
+void pacing_present(struct Game *game);
+void pacing_report(const struct FrameStats *stats);
 
 #endif
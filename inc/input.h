@@ -4,11 +4,39 @@
 #include "structs.h"
 #include "game.h"
 
+/**
+ * enum InputButton - Keys of a player, as flags
+ * @INPUT_FORWARD: move forward
+ * @INPUT_BACKWARD: move backward
+ * @INPUT_STRAFE_LEFT: step left
+ * @INPUT_STRAFE_RIGHT: step right
+ * @INPUT_TURN_LEFT: rotate counterclockwise
+ * @INPUT_TURN_RIGHT: rotate clockwise
+ * @INPUT_BUTTONS: number of keys
+ */
+enum InputButton
+{
+	INPUT_FORWARD = 1 << 0,
+	INPUT_BACKWARD = 1 << 1,
+	INPUT_STRAFE_LEFT = 1 << 2,
+	INPUT_STRAFE_RIGHT = 1 << 3,
+	INPUT_TURN_LEFT = 1 << 4,
+	INPUT_TURN_RIGHT = 1 << 5,
+	INPUT_BUTTONS = 6
+};
+
 void handle_input(struct Game *game);
-void handle_rotation(struct Game *game, float rotation_speed);
-void handle_movement(struct Game *game, float movement_speed);
+void handle_rotation(struct Game *game, int index, float rotation_speed);
+void handle_movement(struct Game *game, int index, float movement_speed);
+int input_buttons(const struct Game *game, int index);
+void input_press(Uint8 *keyboard_state, int index, int buttons);
+void rotate_player(struct Player *player, float amount);
+void move_player(const struct Game *game, struct Player *player,
+		float forward, float strafe);
 void update_direction(struct Player *player);
-bool check_collision(const struct Game *game, float newX, float newY);
-void keep_player_in_bounds(struct Player *player);
+bool check_collision(const struct Game *game, const struct Player *player,
+		float newX, float newY);
+void keep_player_in_bounds(const struct Game *game, struct Player *player);
+bool map_in_bounds(const struct Game *game, int map_x, int map_y);
 
 #endif
@@ -0,0 +1,56 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include "constants.h"
+
+#define JOB_MAX_THREADS 8
+
+/**
+ * JobFunction - Runs one job of a batch
+ * @context: pointer shared by every job of the batch
+ * @index: index of the job, from 0 to the batch size minus one
+ */
+typedef void (*JobFunction)(void *context, int index);
+
+/**
+ * struct JobPool - Worker threads running batches of independent jobs
+ * @threads: worker threads
+ * @thread_count: number of worker threads, 0 runs every job inline
+ * @lock: protects every field below it except @next
+ * @start: signals the workers that a batch is ready or they must quit
+ * @finished: signals job_pool_run() that the last worker is done
+ * @function: job function of the current batch
+ * @context: context of the current batch
+ * @count: number of jobs in the current batch
+ * @next: next job index to hand out
+ * @busy: number of workers still running the current batch
+ * @generation: batch counter, lets workers tell a new batch from a
+ *		spurious wake up
+ * @quit: tells the workers to exit
+ *
+ * Description: The calling thread takes jobs too, so a pool is never
+ * slower than running the batch inline.
+ */
+struct JobPool
+{
+	SDL_Thread *threads[JOB_MAX_THREADS];
+	int thread_count;
+	SDL_mutex *lock;
+	SDL_cond *start;
+	SDL_cond *finished;
+	JobFunction function;
+	void *context;
+	int count;
+	SDL_atomic_t next;
+	int busy;
+	Uint32 generation;
+	bool quit;
+};
+
+struct JobPool *job_pool_create(int thread_count);
+void job_pool_destroy(struct JobPool *pool);
+void job_pool_run(struct JobPool *pool, JobFunction function, void *context,
+		int count);
+int job_pool_default_threads(void);
+
+#endif
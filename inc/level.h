@@ -0,0 +1,116 @@
+#ifndef LEVEL_H
+#define LEVEL_H
+
+#include "structs.h"
+#include "pathfind.h"
+
+#define LEVEL_SPEC_PREFIX "levels:"
+#define LEVEL_PATH_SIZE 256
+#define LEVEL_MANIFEST_FORMAT "%255s %255s"
+#define LEVEL_SLOTS 2
+#define LEVEL_CLUSTER_NODES (4 * PATH_CLUSTER_SIZE - 4)
+#define LEVEL_CLUSTER_BYTES (LEVEL_CLUSTER_NODES * (sizeof(struct HpaNode) + \
+		PATH_TILE_BYTES + (LEVEL_CLUSTER_NODES + 3) * sizeof(struct HpaEdge)) \
+		+ sizeof(int))
+
+/**
+ * enum LevelState - Loading state of a level slot
+ * @LEVEL_EMPTY: the slot holds no level
+ * @LEVEL_LOADING: the loader thread is filling the slot
+ * @LEVEL_READY: the level can be switched to
+ * @LEVEL_FAILED: the level could not be loaded
+ */
+enum LevelState
+{
+	LEVEL_EMPTY,
+	LEVEL_LOADING,
+	LEVEL_READY,
+	LEVEL_FAILED
+};
+
+/**
+ * struct LevelEntry - One line of a level manifest
+ * @map_path: map file or maze specification of the level
+ * @texture_path: wall texture of the level, empty for the default one
+ */
+struct LevelEntry
+{
+	char map_path[LEVEL_PATH_SIZE];
+	char texture_path[LEVEL_PATH_SIZE];
+};
+
+/**
+ * struct Level - A loaded level and everything derived from it
+ * @arena: the only memory of the level; resetting it frees the level
+ * @state: enum LevelState, written by the loader thread
+ * @index: manifest index of the level
+ * @entry: manifest line of the level
+ * @map: row-major tile grid, in @arena
+ * @width: map width in tiles
+ * @height: map height in tiles
+ * @max_top: top of the tallest cell, in world units
+ * @has_heights: the map has cells of other than the default heights
+ * @has_layers: the map has thin walls or grates
+ * @pathfinder: pathfinding service of the map, in @arena, NULL for a map
+ *		over PATH_MAX_TILES tiles
+ * @lighting: lightmap of the map, in @arena, NULL for a map without lights
+ * @pixels: ARGB8888 wall texture pixels, in @arena, NULL for the
+ *		default wall texture
+ * @texture_width: wall texture width in pixels
+ * @texture_height: wall texture height in pixels
+ * @wall_texture: @pixels uploaded to the renderer, created on the main
+ *		thread when the level becomes current
+ */
+struct Level
+{
+	struct Arena arena;
+	SDL_atomic_t state;
+	int index;
+	const struct LevelEntry *entry;
+	int *map;
+	int width;
+	int height;
+	int max_top;
+	bool has_heights;
+	bool has_layers;
+	struct Pathfinder *pathfinder;
+	struct Lighting *lighting;
+	Uint32 *pixels;
+	int texture_width;
+	int texture_height;
+	SDL_Texture *wall_texture;
+};
+
+/**
+ * struct LevelSet - Levels of a manifest, played in order
+ * @entries: manifest lines
+ * @count: number of levels
+ * @slots: the current level and the one being preloaded
+ * @current: slot of the level being played
+ * @loader: thread preloading the other slot, NULL when idle
+ * @default_wall_texture: wall texture of levels without their own
+ *
+ * Description: While a level is played the next one is loaded into the
+ * other slot, so switching only swaps pointers and uploads one texture.
+ */
+struct LevelSet
+{
+	struct LevelEntry *entries;
+	int count;
+	struct Level slots[LEVEL_SLOTS];
+	int current;
+	SDL_Thread *loader;
+	SDL_Texture *default_wall_texture;
+};
+
+bool level_set_create(struct Game *game, const char *spec_text);
+void level_set_destroy(struct Game *game);
+bool level_set_next(struct Game *game);
+size_t level_set_memory(const struct LevelSet *set, int index,
+		size_t *reserved);
+
+bool level_read_manifest(struct LevelSet *set, const char *path);
+bool level_preload(struct LevelSet *set, int slot, int index);
+bool level_activate(struct Game *game, struct Level *level);
+
+#endif
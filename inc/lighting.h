@@ -0,0 +1,115 @@
+#ifndef LIGHTING_H
+#define LIGHTING_H
+
+#include "structs.h"
+#include "jobs.h"
+
+#define LIGHT_AMBIENT 56
+#define LIGHT_RADIUS (8 * TILE_SIZE)
+#define LIGHT_INTENSITY 320
+#define LANTERN_RADIUS (5 * TILE_SIZE)
+#define LANTERN_INTENSITY 240
+#define LIGHT_MOVE_STEP (TILE_SIZE / 8)
+#define LIGHT_BAKE_ROWS 4
+#define LIGHT_FACE_OFFSET 0.01f
+#define LIGHTING_BYTES(lights, tiles) (sizeof(struct Lighting) + \
+		((lights) + MAX_PLAYERS) * sizeof(struct Light) + \
+		2 * (tiles) * LIGHT_FACES + 4 * ARENA_ALIGNMENT)
+
+/**
+ * enum LightFace - Faces of a tile lit separately
+ * @LIGHT_TOP: top surface, the floor of floor tiles
+ * @LIGHT_WEST: side facing -x
+ * @LIGHT_EAST: side facing +x
+ * @LIGHT_NORTH: side facing -y
+ * @LIGHT_SOUTH: side facing +y
+ * @LIGHT_FACES: number of faces
+ */
+enum LightFace
+{
+	LIGHT_TOP,
+	LIGHT_WEST,
+	LIGHT_EAST,
+	LIGHT_NORTH,
+	LIGHT_SOUTH,
+	LIGHT_FACES
+};
+
+/**
+ * struct Light - Point light
+ * @x: x coordinate, in world units
+ * @y: y coordinate, in world units
+ * @radius: distance the light reaches, in world units
+ * @intensity: brightness added at the light itself, 255 being full
+ * @on: the light shines
+ */
+struct Light
+{
+	float x;
+	float y;
+	float radius;
+	int intensity;
+	bool on;
+};
+
+/**
+ * struct Lighting - Lightmap of a map lit by point lights
+ * @map: tiles of the map, shadows are cast by its walls
+ * @width: number of tiles per map row
+ * @height: number of map rows
+ * @lights: static lights of the map, then one lantern per player
+ * @static_count: number of static lights
+ * @count: number of lights
+ * @baked: LIGHT_FACES levels per tile, ambient and static lights only
+ * @lightmap: LIGHT_FACES levels per tile, @baked plus the lanterns; the
+ *		one drawn from
+ * @first_x: first tile column of the region being lit
+ * @first_y: first tile row of the region being lit
+ * @last_x: tile column after the region being lit
+ * @last_y: tile row after the region being lit
+ * @dynamic: the region is relit from @baked and the lanterns rather
+ *		than baked from the static lights
+ * @bake_ms: time the static lights took to bake
+ * @arena: memory of the lights and both maps
+ * @parent: arena the lighting is carved from, NULL when it comes from
+ *		malloc
+ *
+ * Description: Static lights are baked once; moving a lantern only
+ * relights the tiles it reaches, from before and after the move.
+ */
+struct Lighting
+{
+	const int *map;
+	int width;
+	int height;
+	struct Light *lights;
+	int static_count;
+	int count;
+	Uint8 *baked;
+	Uint8 *lightmap;
+	int first_x;
+	int first_y;
+	int last_x;
+	int last_y;
+	bool dynamic;
+	double bake_ms;
+	struct Arena arena;
+	struct Arena *parent;
+};
+
+int lighting_count(const int *map, int width, int height);
+struct Lighting *lighting_create(const int *map, int width, int height,
+		struct JobPool *jobs, struct Arena *parent);
+void lighting_destroy(struct Lighting *lighting);
+bool lighting_move(struct Lighting *lighting, int lantern, float x, float y,
+		bool on, struct JobPool *jobs);
+void lighting_place(struct Lighting *lighting, int count);
+void lighting_include(struct Lighting *lighting, const struct Light *light);
+int lighting_at(const struct Lighting *lighting, int map_x, int map_y,
+		enum LightFace face);
+void lighting_bake(struct Lighting *lighting, bool dynamic,
+		struct JobPool *jobs);
+bool lighting_visible(const struct Lighting *lighting, float from_x,
+		float from_y, float to_x, float to_y);
+
+#endif
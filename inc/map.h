@@ -3,13 +3,24 @@
 
 #include "structs.h"
 
-void draw_2d_map(struct Game *game);
+void draw_2d_map(struct Game *game, const struct Camera *camera);
 void draw_map_background(struct Game *game, int map_x,
 		int map_y, int map_size);
-void draw_map_tiles(struct Game *game, int map_x, int map_y, int tile_size);
-void draw_player(struct Game *game, int map_x, int map_y, int tile_size);
-void draw_fov_rays(struct Game *game, int map_x, int map_y, int tile_size,
-		int player_x, int player_y, int player_size);
+void draw_map_tiles(struct Game *game, const struct Player *viewer,
+		int map_x, int map_y, int tile_size);
+void draw_player(struct Game *game, int player_x, int player_y,
+		int player_size, bool is_viewer);
+void draw_fov_rays(struct Game *game, const struct Player *viewer, int map_x,
+		int map_y, int tile_size, int player_x, int player_y, int player_size);
 bool parse_map_file(struct Game *game, const char *file_path);
+bool load_generated_map(struct Game *game, const char *spec_text);
+bool load_world_map(struct Game *game, const char *spec_text);
+int map_cell(const struct Game *game, int map_x, int map_y);
+bool map_segment_walk(float from_x, float from_y, float to_x, float to_y,
+		bool (*visit)(int map_x, int map_y, void *data), void *data);
+bool map_segment_clear(const int *map, int width, int height, float from_x,
+		float from_y, float to_x, float to_y);
+int map_cell_top(const struct Game *game, int map_x, int map_y);
+void map_measure_cells(struct Game *game);
 
 #endif
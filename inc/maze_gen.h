@@ -0,0 +1,97 @@
+#ifndef MAZE_GEN_H
+#define MAZE_GEN_H
+
+#include "constants.h"
+
+#define MAZE_SPEC_PREFIX "maze:"
+#define MAZE_DEFAULT_SEED 1
+
+/**
+ * enum MazeAlgorithm - Procedural maze generation algorithms
+ * @MAZE_BACKTRACKER: randomized depth-first search (long corridors)
+ * @MAZE_WILSON: loop-erased random walks (uniform spanning tree)
+ * @MAZE_ELLER: row-by-row sets, streams in O(width) memory
+ */
+enum MazeAlgorithm
+{
+	MAZE_BACKTRACKER,
+	MAZE_WILSON,
+	MAZE_ELLER
+};
+
+/**
+ * struct MazeSpec - Parameters of a generated maze
+ * @algorithm: generation algorithm to use
+ * @cells_x: number of maze cells per row
+ * @cells_y: number of maze cell rows
+ * @seed: seed of the random generator; equal specs give equal mazes
+ *
+ * Description: A maze of cells_x * cells_y cells is laid out on a tile
+ * map of (2 * cells_x + 1) x (2 * cells_y + 1) tiles: cells sit on odd
+ * coordinates and the tiles between them are walls or passages.
+ */
+struct MazeSpec
+{
+	enum MazeAlgorithm algorithm;
+	int cells_x;
+	int cells_y;
+	Uint64 seed;
+};
+
+/**
+ * struct MazeRng - splitmix64 random number generator state
+ * @state: current generator state
+ */
+struct MazeRng
+{
+	Uint64 state;
+};
+
+/**
+ * struct EllerState - Row state of the streaming Eller generator
+ * @cells_x: number of cells per row
+ * @sets: set id of every cell in the current row
+ * @parent: union-find parent of every set id
+ * @count: number of cells of the current row in each set
+ * @has_down: whether a set already opened a passage to the next row
+ * @remap: set id renumbering table used between rows
+ * @east: whether each cell opens to its east neighbour
+ * @down: whether each cell opens to the cell below
+ * @bits: buffered random bits for the coin flips
+ * @bits_left: number of unused bits in @bits
+ */
+struct EllerState
+{
+	int cells_x;
+	int *sets;
+	int *parent;
+	int *count;
+	Uint8 *has_down;
+	int *remap;
+	Uint8 *east;
+	Uint8 *down;
+	Uint64 bits;
+	int bits_left;
+};
+
+Uint64 maze_rng_next(struct MazeRng *rng);
+int maze_rng_below(struct MazeRng *rng, int bound);
+bool maze_parse_spec(const char *text, struct MazeSpec *spec);
+Uint8 *maze_generate(const struct MazeSpec *spec, int *width, int *height);
+bool maze_write_map_file(const struct MazeSpec *spec, const char *path);
+
+bool maze_backtracker(Uint8 *tiles, int cells_x, int cells_y,
+		struct MazeRng *rng);
+bool maze_wilson(Uint8 *tiles, int cells_x, int cells_y,
+		struct MazeRng *rng);
+bool maze_eller(Uint8 *tiles, int cells_x, int cells_y,
+		struct MazeRng *rng);
+bool maze_eller_stream(FILE *file, int cells_x, int cells_y,
+		struct MazeRng *rng);
+
+bool eller_init(struct EllerState *state, int cells_x);
+void eller_next_row(struct EllerState *state, struct MazeRng *rng,
+		bool last_row);
+void eller_free(struct EllerState *state);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "structs.h"
+#include <stdatomic.h>
+
+#define METRICS_POLL_MS 200
+#define METRICS_REQUEST_MS 100
+#define METRICS_BUFFER_SIZE 4096
+
+/**
+ * struct Metrics - Counters of the running game served to scrapers
+ * @frames: frames presented
+ * @frame_ns: total time between consecutive frames, in nanoseconds
+ * @last_frame_ns: time between the last two frames
+ * @present_ns: total time spent presenting frames
+ * @last_present_ns: time spent presenting the last frame
+ * @rays: rays cast, reused columns excluded
+ * @dropped: frames the capture dropped
+ * @level_bytes: arena memory of the current level, 0 for single maps
+ * @frame_arena_bytes: frame arena memory used by the last frame
+ * @previous: performance counter of the previous frame, main thread only
+ * @listener: listening Unix socket
+ * @path: socket path, removed when the server stops
+ * @thread: server thread
+ * @quit: tells the server thread to exit
+ *
+ * Description: The main loop only updates the counters with relaxed
+ * atomic stores, and the server only loads them, so a scrape never
+ * blocks a frame. Values read by one scrape may straddle a frame.
+ */
+struct Metrics
+{
+	atomic_ullong frames;
+	atomic_ullong frame_ns;
+	atomic_ullong last_frame_ns;
+	atomic_ullong present_ns;
+	atomic_ullong last_present_ns;
+	atomic_ullong rays;
+	atomic_ullong dropped;
+	atomic_ullong level_bytes;
+	atomic_ullong frame_arena_bytes;
+	Uint64 previous;
+	int listener;
+	char *path;
+	SDL_Thread *thread;
+	SDL_atomic_t quit;
+};
+
+struct Metrics *metrics_create(const char *path);
+void metrics_destroy(struct Metrics *metrics);
+void metrics_frame(const struct Game *game, Uint64 present_ticks, long rays);
+int metrics_format(const struct Metrics *metrics, char *buffer, size_t size);
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef NET_H
+#define NET_H
+
+#include "structs.h"
+#include "maze_gen.h"
+#include <netinet/in.h>
+
+#define NET_MAX_CLIENTS 1024
+#define NET_MAX_VISIBLE 64
+#define NET_HISTORY 32
+#define NET_PACKET_BYTES 1400
+#define NET_VIEW_RANGE (24 * TILE_SIZE)
+#define NET_TIMEOUT_MS 5000
+#define NET_CONNECT_MS 3000
+#define NET_HELLO_MS 100
+#define NET_RECEIVE_BUFFER (4 << 20)
+#define NET_SPAWN_ATTEMPTS 1000
+#define NET_POSITION_SCALE 16.0f
+#define NET_ANGLE_SCALE (65536 / (2 * PI))
+#define NET_HELLO_BYTES 11
+#define NET_WELCOME_BYTES 3
+#define NET_INPUT_BYTES 12
+#define NET_SNAPSHOT_HEADER 11
+#define NET_RECORD_HEADER 3
+#define NET_RECORD_FULL 13
+#define NET_FIELD_X 0x01
+#define NET_FIELD_Y 0x02
+#define NET_FIELD_ANGLE 0x04
+#define NET_FIELD_SMALL 0x08
+#define NET_FIELD_REMOVED 0x10
+
+/**
+ * enum NetPacketType - First byte of every datagram
+ * @NET_HELLO: client asks to join; map width, height and tile size follow
+ * @NET_WELCOME: server accepts a client; its entity id follows
+ * @NET_INPUT: client's keys, with the last snapshot it decoded
+ * @NET_SNAPSHOT: server's view of the entities a client can see
+ */
+enum NetPacketType
+{
+	NET_HELLO = 1,
+	NET_WELCOME,
+	NET_INPUT,
+	NET_SNAPSHOT
+};
+
+/**
+ * struct NetEntity - A player as snapshots carry it
+ * @id: entity id, the local players of a hosting game first, then one
+ *		per client
+ * @x: x coordinate, in 1 / NET_POSITION_SCALE world units
+ * @y: y coordinate, in 1 / NET_POSITION_SCALE world units
+ * @angle: facing angle, in 1 / NET_ANGLE_SCALE radians
+ */
+struct NetEntity
+{
+	Uint16 id;
+	Sint32 x;
+	Sint32 y;
+	Uint16 angle;
+};
+
+/**
+ * struct NetState - Entities one client was sent on one tick
+ * @tick: server tick of the snapshot, 0 for an unused slot
+ * @count: number of entities
+ * @entities: entities sorted by id
+ */
+struct NetState
+{
+	Uint32 tick;
+	int count;
+	struct NetEntity entities[NET_MAX_VISIBLE];
+};
+
+/**
+ * struct NetPeer - A client as the server tracks it
+ * @address: address the client sends from
+ * @active: the slot holds a client
+ * @heard: SDL_GetTicks() of the last datagram from the client
+ * @sequence: sequence number of the newest input applied
+ * @acked: newest snapshot the client decoded, 0 for none
+ * @buttons: keys held, InputButton flags
+ * @player: the client's player, simulated by the server
+ * @history: snapshots sent, indexed by tick % NET_HISTORY
+ */
+struct NetPeer
+{
+	struct sockaddr_in address;
+	bool active;
+	Uint32 heard;
+	Uint32 sequence;
+	Uint32 acked;
+	int buttons;
+	struct Player player;
+	struct NetState *history;
+};
+
+/**
+ * struct NetStats - Traffic a server sent
+ * @ticks: ticks run
+ * @snapshots: snapshots sent
+ * @bytes: bytes of the snapshots sent
+ * @full_bytes: bytes the same snapshots would take without a base
+ * @entities: entities the snapshots carried
+ */
+struct NetStats
+{
+	long ticks;
+	long snapshots;
+	long bytes;
+	long full_bytes;
+	long entities;
+};
+
+/**
+ * struct NetServer - Authoritative simulation serving clients over UDP
+ * @socket: UDP socket
+ * @sim: map holder whose first player stands in for the client being
+ *		moved, so the game's own input rules move it
+ * @keys: keyboard state built from a client's buttons
+ * @peers: client slots, entity id MAX_PLAYERS + slot
+ * @peer_count: number of slots ever used
+ * @tick: ticks run
+ * @now: SDL_GetTicks() at the start of the tick
+ * @rng: generator of spawn points
+ * @entities: every entity of the tick, in id order
+ * @entity_count: number of entities
+ * @cells: per interest cell, index of its first entity in @order
+ * @order: entity indices sorted by interest cell
+ * @grid_width: interest cells per row
+ * @grid_height: rows of interest cells
+ * @state: scratch snapshot being built
+ * @remote: other players the hosting game's players can see
+ * @remote_count: number of entries of @remote
+ * @stats: traffic sent
+ * @verbose: print players joining and leaving
+ *
+ * Description: Interest cells are NET_VIEW_RANGE wide, so an entity
+ * only has to look at its own cell and the eight around it.
+ */
+struct NetServer
+{
+	int socket;
+	struct Game sim;
+	Uint8 keys[SDL_NUM_SCANCODES];
+	struct NetPeer peers[NET_MAX_CLIENTS];
+	int peer_count;
+	Uint32 tick;
+	Uint32 now;
+	struct MazeRng rng;
+	struct NetEntity entities[MAX_PLAYERS + NET_MAX_CLIENTS];
+	int entity_count;
+	int *cells;
+	int order[MAX_PLAYERS + NET_MAX_CLIENTS];
+	int grid_width;
+	int grid_height;
+	struct NetState state;
+	struct Player remote[NET_MAX_VISIBLE];
+	int remote_count;
+	struct NetStats stats;
+	bool verbose;
+};
+
+/**
+ * struct NetClient - Connection of a client to a server
+ * @socket: UDP socket
+ * @server: address of the server
+ * @map_width: tiles per row of the client's map, checked on joining
+ * @map_height: rows of the client's map, checked on joining
+ * @id: entity id the server gave the client, 0 until it joined
+ * @sequence: inputs sent
+ * @newest: tick of the newest snapshot decoded, 0 for none
+ * @history: snapshots decoded, indexed by tick % NET_HISTORY
+ * @player: the client's player as of the newest snapshot
+ * @remote: the other players of the newest snapshot
+ * @remote_count: number of entries of @remote
+ * @bytes: bytes of snapshots received
+ * @dropped: snapshots dropped, their base being gone
+ */
+struct NetClient
+{
+	int socket;
+	struct sockaddr_in server;
+	int map_width;
+	int map_height;
+	Uint16 id;
+	Uint32 sequence;
+	Uint32 newest;
+	struct NetState history[NET_HISTORY];
+	struct Player player;
+	struct Player remote[NET_MAX_VISIBLE];
+	int remote_count;
+	long bytes;
+	long dropped;
+};
+
+int net_socket(int port);
+void net_put(Uint8 *at, Uint32 value, int bytes);
+Uint32 net_get(const Uint8 *at, int bytes);
+struct NetServer *net_server_create(const struct Game *game, int port);
+void net_server_destroy(struct NetServer *server);
+void net_server_tick(struct NetServer *server, const struct Game *host,
+		float delta_time);
+void net_server_join(struct NetServer *server,
+		const struct sockaddr_in *address, const Uint8 *packet, int length);
+void net_server_expire(struct NetServer *server);
+void net_interest_prepare(struct NetServer *server);
+void net_interest(const struct NetServer *server,
+		const struct Player *viewer, Uint16 id, struct NetState *state);
+bool net_visible(const struct Game *game, float from_x, float from_y,
+		float to_x, float to_y);
+struct NetClient *net_client_create(const struct Game *game,
+		const char *address);
+void net_client_destroy(struct NetClient *client);
+void net_client_hello(struct NetClient *client);
+bool net_client_wait(struct NetClient *client);
+void net_client_send(struct NetClient *client, int buttons);
+bool net_client_receive(struct NetClient *client);
+void net_quantize(const struct Player *player, Uint16 id,
+		struct NetEntity *entity);
+void net_player(const struct NetEntity *entity, struct Player *player);
+int net_encode(const struct NetState *base, const struct NetState *state,
+		Uint8 *buffer);
+bool net_decode(const struct NetState *history, const Uint8 *buffer,
+		int length, struct NetState *state);
+void net_frame(struct Game *game);
+
+#endif
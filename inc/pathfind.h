@@ -0,0 +1,205 @@
+#ifndef PATHFIND_H
+#define PATHFIND_H
+
+#include "arena.h"
+
+#define PATH_CLUSTER_SIZE 16
+#define PATH_ENTRANCE_SPLIT 6
+#define PATH_STRAIGHT_COST 1.0f
+#define PATH_DIAGONAL_COST 1.41421356f
+#define PATH_SCRATCH_BYTES (1 << 20)
+/* search state, path buffer and HPA* node lookup: eight 32-bit words */
+#define PATH_TILE_BYTES (8 * sizeof(int))
+/* larger maps are played without a pathfinder, which would need 9x them */
+#define PATH_MAX_TILES (1 << 22)
+#define PATH_FITS(width, height) ((size_t)(width) * (height) <= PATH_MAX_TILES)
+
+/**
+ * enum PathAlgorithm - Grid pathfinding algorithms
+ * @PATH_ASTAR: plain A* over the 8-connected tile grid
+ * @PATH_JPS: Jump Point Search, A* that skips symmetric paths
+ * @PATH_HPA: hierarchical A* over precomputed cluster entrances
+ */
+enum PathAlgorithm
+{
+	PATH_ASTAR,
+	PATH_JPS,
+	PATH_HPA
+};
+
+/**
+ * struct PathBounds - Tile rectangle a search may not leave
+ * @min_x: first column inside the rectangle
+ * @min_y: first row inside the rectangle
+ * @max_x: first column past the rectangle
+ * @max_y: first row past the rectangle
+ */
+struct PathBounds
+{
+	int min_x;
+	int min_y;
+	int max_x;
+	int max_y;
+};
+
+/**
+ * struct PathNodes - Per-node search state with an indexed binary heap
+ * @g: cost from the start
+ * @f: g plus the heuristic estimate, the heap key
+ * @parent: node the best known path arrives from
+ * @stamp: search generation that last touched the node
+ * @heap_pos: position in @heap, or -1 once the node is closed
+ * @heap: open list ordered by @f
+ * @heap_size: number of open nodes
+ * @generation: id of the current search
+ * @count: number of nodes
+ *
+ * Description: The arrays are allocated once; bumping @generation makes
+ * every node unvisited again without clearing anything.
+ */
+struct PathNodes
+{
+	float *g;
+	float *f;
+	int *parent;
+	Uint32 *stamp;
+	int *heap_pos;
+	int *heap;
+	int heap_size;
+	Uint32 generation;
+	int count;
+};
+
+/**
+ * struct HpaNode - Abstract node of the HPA* graph, one per entrance tile
+ * @tile: index of the tile in the map
+ * @cluster: index of the cluster holding the tile
+ * @first_edge: index of the node's first edge
+ * @edge_count: number of edges leaving the node
+ */
+struct HpaNode
+{
+	int tile;
+	int cluster;
+	int first_edge;
+	int edge_count;
+};
+
+/**
+ * struct HpaEdge - Edge of the HPA* graph
+ * @to: destination node
+ * @cost: length of the tile path behind the edge
+ */
+struct HpaEdge
+{
+	int to;
+	float cost;
+};
+
+/**
+ * struct HpaGraph - Cluster hierarchy precomputed when a map is loaded
+ * @clusters_x: number of cluster columns
+ * @clusters_y: number of cluster rows
+ * @nodes: abstract nodes, grouped by cluster
+ * @node_count: number of abstract nodes
+ * @cluster_first_node: first node of every cluster, plus an end marker
+ * @node_of_tile: abstract node of every tile, or -1
+ * @edges: edges of all nodes, stored node after node
+ * @edge_count: number of edges
+ * @search: search state over the nodes plus the query's start and goal
+ * @arena: memory of the nodes, edges and search state
+ */
+struct HpaGraph
+{
+	int clusters_x;
+	int clusters_y;
+	struct HpaNode *nodes;
+	int node_count;
+	int *cluster_first_node;
+	int *node_of_tile;
+	struct HpaEdge *edges;
+	int edge_count;
+	struct PathNodes search;
+	struct Arena arena;
+};
+
+/**
+ * struct PathResult - Path returned by a query
+ * @tiles: map indexes of the tiles from start to goal
+ * @length: number of tiles in @tiles
+ * @cost: path length in tiles, diagonal steps counting sqrt(2)
+ * @expanded: number of nodes expanded to answer the query
+ *
+ * Description: @tiles lives in the Pathfinder and is overwritten by the
+ * next query.
+ */
+struct PathResult
+{
+	const int *tiles;
+	int length;
+	float cost;
+	long expanded;
+};
+
+/**
+ * struct Pathfinder - Pathfinding service over one map
+ * @map: row-major tile grid, MAP_FLOOR tiles are walkable
+ * @width: map width in tiles
+ * @height: map height in tiles
+ * @arena: memory of everything sized by the map, allocated once
+ * @scratch: per-query memory, reset at the start of every query
+ * @grid: search state over the tiles
+ * @path: buffer receiving the tiles of the last path
+ * @expanded: nodes expanded by the current query
+ * @hpa: precomputed cluster hierarchy
+ * @parent: arena every block of the service is carved from, NULL when
+ *		they come from malloc
+ *
+ * Description: Queries never call malloc; all their memory comes from
+ * @arena and @scratch.
+ */
+struct Pathfinder
+{
+	const int *map;
+	int width;
+	int height;
+	struct Arena arena;
+	struct Arena scratch;
+	struct PathNodes grid;
+	int *path;
+	long expanded;
+	struct HpaGraph hpa;
+	struct Arena *parent;
+};
+
+struct Pathfinder *pathfinder_create(const int *map, int width, int height,
+		struct Arena *parent);
+void pathfinder_destroy(struct Pathfinder *pathfinder);
+bool pathfinder_query(struct Pathfinder *pathfinder,
+		enum PathAlgorithm algorithm, int start, int goal,
+		struct PathResult *result);
+bool path_walkable(const struct Pathfinder *pathfinder, int x, int y);
+float path_octile(const struct Pathfinder *pathfinder, int from, int to);
+
+bool path_nodes_init(struct PathNodes *nodes, struct Arena *arena, int count);
+void path_nodes_begin(struct PathNodes *nodes);
+bool path_nodes_relax(struct PathNodes *nodes, int node, int parent,
+		float g, float h);
+int path_nodes_pop(struct PathNodes *nodes);
+
+bool path_grid_search(struct Pathfinder *pathfinder, int start, int goal,
+		const struct PathBounds *bounds);
+int path_append(struct Pathfinder *pathfinder, int goal, int length);
+bool path_jps_search(struct Pathfinder *pathfinder, int start, int goal);
+int path_jps_append(struct Pathfinder *pathfinder, int goal);
+
+bool hpa_build(struct Pathfinder *pathfinder);
+bool hpa_alloc_graph(struct Pathfinder *pathfinder, const int *first_node);
+bool hpa_link_nodes(struct Pathfinder *pathfinder);
+int hpa_cluster_of(const struct Pathfinder *pathfinder, int tile);
+bool hpa_search(struct Pathfinder *pathfinder, int start, int goal,
+		struct PathResult *result);
+void hpa_cluster_bounds(const struct Pathfinder *pathfinder, int cluster,
+		struct PathBounds *bounds);
+
+#endif
@@ -3,14 +3,27 @@
 
 #include "structs.h"
 #include "rendering.h"
+#include "map.h"
 
-void cast_single_ray(struct Game *game, float ray_angle,
-		int ray_index, float *ray_end_x, float *ray_end_y);
-void cast_rays(struct Game *game, float ray_ends_x[NUM_RAYS],
-		float ray_ends_y[NUM_RAYS]);
-void cast_horizontal_ray(struct Game *game, float ray_angle, int facing_down,
-		int facing_right, float *horiz_x, float *horiz_y, float *horiz_distance);
-void cast_vertical_ray(struct Game *game, float ray_angle, int facing_down,
-		int facing_right, float *vert_x, float *vert_y, float *vert_distance);
+#define FRAME_ARENA_BYTES (MAX_PLAYERS * (NUM_RAYS * CAST_MAX_LAYERS * \
+			sizeof(struct RayLayer) + ARENA_ALIGNMENT))
+
+void cast_single_ray(const struct Game *game, const struct Player *viewer,
+		float ray_angle, struct RayHit *hit);
+void cast_rays(const struct Game *game, struct Camera *camera, int first,
+		int last);
+int cast_rays_variable(const struct Game *game, struct Camera *camera,
+		int first, int last, int step);
+void cast_horizontal_ray(const struct Game *game, const struct Player *viewer,
+		float ray_angle, int facing_down, int facing_right, float *horiz_x,
+		float *horiz_y, float *horiz_distance);
+void cast_vertical_ray(const struct Game *game, const struct Player *viewer,
+		float ray_angle, int facing_down, int facing_right, float *vert_x,
+		float *vert_y, float *vert_distance);
+CastKernel cast_kernel(void);
+void cast_layers(const struct Game *game, const struct Player *viewer,
+		struct RayHit *hit, struct RayLayer *layers);
+void setup_cameras(struct Game *game);
+void render_cameras(struct Game *game);
 
 #endif
@@ -3,16 +3,91 @@
 
 #include "structs.h"
 
-void draw_3d_view(struct Game *game, float ray_angle, float distance,
-		int ray_index, int is_vertical);
+#define SPAN_WORDS ((CONFIG_MAX_HEIGHT + 63) / 64)
+#define RENDER_BATCHES 4
+#define RENDER_BATCH_QUADS 1024
+
+/**
+ * struct ColumnSpan - Occlusion state of one view column, drawn front to
+ *		back
+ * @column: viewport column
+ * @bottom: rows [0, @bottom) of the column are still open; every row
+ *		below has been drawn, so later, farther strips are clipped to it
+ * @horizon: row at eye height
+ * @eye: eye height above the ground, in world units
+ * @projection: distance to the camera's projection plane, in pixels
+ * @cosine: cosine of the angle between the column's ray and the view
+ *		direction, turning ray distances into depths
+ * @drawn: rows written to the renderer so far
+ * @written: one bit per row written, to measure overdraw
+ *
+ * Description: With no ceilings, everything drawn so far hangs from the
+ * bottom of the column, so one row bound is the whole span buffer.
+ */
+struct ColumnSpan
+{
+	int column;
+	int bottom;
+	float horizon;
+	float eye;
+	float projection;
+	float cosine;
+	long drawn;
+	Uint64 written[SPAN_WORDS];
+};
+
+/**
+ * struct RenderBatch - Strips of one texture waiting to be drawn
+ * @texture: texture of the strips, NULL for an unused batch
+ * @texture_width: width of @texture, in texels
+ * @texture_height: height of @texture, in texels
+ * @vertices: four vertices per strip, shading in their color
+ * @indices: two triangles per strip; they never change, so they are only
+ *		written when the buffers grow
+ * @quads: strips queued this frame
+ * @capacity: strips the buffers hold
+ *
+ * Description: The buffers are kept from frame to frame and only grow.
+ */
+struct RenderBatch
+{
+	SDL_Texture *texture;
+	int texture_width;
+	int texture_height;
+	SDL_Vertex *vertices;
+	int *indices;
+	int quads;
+	int capacity;
+};
+
+void draw_3d_view(struct Game *game, const struct Camera *camera, int column);
+ColumnKernel column_kernel(int view_height);
 float calculate_corrected_distance(float distance, float ray_angle,
 		float player_angle);
-float calculate_line_height(float corrected_distance);
-float calculate_line_offset(float line_height);
+float calculate_line_height(float corrected_distance, float projection);
+float calculate_line_offset(float line_height, int view_height);
+SDL_Texture *create_grate_texture(SDL_Renderer *renderer);
 SDL_Rect setup_wall_strip(int ray_index, float line_offset, float line_height);
 SDL_Rect calculate_texture_rect(int texture_width,
 		float hit_x, float texture_y_start, float line_height, float step);
-void apply_shading(SDL_Texture *texture, float corrected_distance);
-void draw_weapon(struct Game *game);
+Uint8 shade_level(float corrected_distance, int light);
+void draw_weapon(struct Game *game, const struct Camera *camera);
+void draw_span_surface(struct Game *game, struct ColumnSpan *span, int top,
+		float depth, int light);
+void draw_span_face(struct Game *game, struct ColumnSpan *span, int bottom,
+		int top, float depth, float hit_x, int light);
+void draw_span_layers(struct Game *game, struct ColumnSpan *span,
+		const struct RayLayer *layers, int count);
+int span_row(const struct ColumnSpan *span, int height, float depth);
+void span_write(struct Game *game, struct ColumnSpan *span,
+		SDL_Texture *texture, const SDL_Rect *source, int first, Uint8 shade);
+void span_mark(struct ColumnSpan *span, int first, int last);
+void draw_height_column(struct Game *game, const struct Camera *camera,
+		struct ColumnSpan *span);
+struct RenderBatch *render_batches_create(void);
+void render_batches_destroy(struct RenderBatch *batches);
+void render_strip(struct Game *game, SDL_Texture *texture,
+		const SDL_Rect *source, const SDL_Rect *strip, Uint8 shade);
+void render_flush(struct Game *game);
 
 #endif
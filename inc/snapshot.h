@@ -0,0 +1,98 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "structs.h"
+
+#define SNAPSHOT_KEYFRAME_TICKS 64
+#define SNAPSHOT_SEGMENTS 4096
+#define SNAPSHOT_RING_BYTES (4 << 20)
+#define SNAPSHOT_PLAYER_BYTES 20
+#define SNAPSHOT_IMAGE_BYTES (MAX_PLAYERS * SNAPSHOT_PLAYER_BYTES + 4)
+#define SNAPSHOT_RECORD_MAX (2 * SNAPSHOT_IMAGE_BYTES + 8)
+#define SNAPSHOT_SEGMENT_MAX (SNAPSHOT_IMAGE_BYTES + \
+		(SNAPSHOT_KEYFRAME_TICKS - 1) * SNAPSHOT_RECORD_MAX)
+#define SNAPSHOT_REWIND_TICKS 2
+#define SNAPSHOT_MAGIC "SNP1"
+#define SNAPSHOT_SAVE_PATH "stroll.snap"
+
+/**
+ * struct SnapshotSegment - A keyframe and the ticks recorded against it
+ * @tick: tick of the keyframe
+ * @offset: byte offset of the segment in the ring
+ * @bytes: bytes of the segment, keyframe included
+ * @records: ticks in the segment, keyframe included, at most
+ *		SNAPSHOT_KEYFRAME_TICKS
+ *
+ * Description: The segment is the SNAPSHOT_IMAGE_BYTES image of its
+ * first tick followed by one record per later tick: a varint length,
+ * then the run-length coded XOR of the tick's image with the keyframe.
+ * A record of length 0 repeats the tick before it. Segments are stored
+ * whole, the same way in the ring and in saved files.
+ */
+struct SnapshotSegment
+{
+	long tick;
+	size_t offset;
+	size_t bytes;
+	int records;
+};
+
+/**
+ * struct SnapshotRing - History of the game state, one image per tick
+ * @data: SNAPSHOT_RING_BYTES bytes of segments, each contiguous
+ * @head: offset the next byte is written at
+ * @segments: index of the segments, a ring of SNAPSHOT_SEGMENTS entries
+ * @first: index of the oldest segment in @segments
+ * @count: number of segments held
+ * @keyframe: image of the newest segment's keyframe
+ * @previous: image of the newest tick
+ *
+ * Description: The image holds what moves from tick to tick: every
+ * player's position and direction, the weapon, the lantern and the
+ * minimap switch. The map does not change within a level, so the ring
+ * starts over on every level switch and the map is only written to saved
+ * files; fog and lights follow from the players. Every tick appends a
+ * record to the newest segment and every SNAPSHOT_KEYFRAME_TICKS ticks a
+ * new segment starts, overwriting the oldest ones once the ring is full,
+ * so a tick is rebuilt from its keyframe and one record.
+ */
+struct SnapshotRing
+{
+	Uint8 *data;
+	size_t head;
+	struct SnapshotSegment segments[SNAPSHOT_SEGMENTS];
+	int first;
+	int count;
+	Uint8 keyframe[SNAPSHOT_IMAGE_BYTES];
+	Uint8 previous[SNAPSHOT_IMAGE_BYTES];
+};
+
+struct SnapshotRing *snapshot_create(void);
+void snapshot_destroy(struct SnapshotRing *ring);
+void snapshot_reset(struct SnapshotRing *ring);
+void snapshot_frame(struct Game *game);
+void snapshot_record(struct Game *game);
+bool snapshot_rewind(struct Game *game, long ticks);
+long snapshot_first_tick(const struct SnapshotRing *ring);
+long snapshot_last_tick(const struct SnapshotRing *ring);
+bool snapshot_seek(const struct SnapshotRing *ring, long tick, Uint8 *image);
+void snapshot_truncate(struct SnapshotRing *ring, long tick);
+struct SnapshotSegment *snapshot_begin(struct SnapshotRing *ring,
+		long tick);
+void snapshot_capture(const struct Game *game, Uint8 *image);
+void snapshot_apply(struct Game *game, const Uint8 *image);
+size_t snapshot_size(const struct SnapshotRing *ring);
+size_t snapshot_varint_put(Uint8 *out, size_t value);
+bool snapshot_varint_get(const Uint8 *in, size_t length, size_t *at,
+		size_t *value);
+size_t snapshot_rle_encode(const Uint8 *image, const Uint8 *base,
+		size_t size, Uint8 *out);
+bool snapshot_rle_apply(const Uint8 *record, size_t length, Uint8 *image,
+		size_t size);
+bool snapshot_walk(const Uint8 *segment, size_t bytes, int index,
+		size_t *end, size_t *last);
+void snapshot_map_row(const struct Game *game, int map_y, Uint8 *row);
+bool snapshot_save(const struct Game *game, const char *path);
+bool snapshot_load(struct Game *game, const char *path);
+
+#endif
@@ -2,6 +2,62 @@
 #define STRUCTS_H
 
 #include "constants.h"
+#include "arena.h"
+
+struct Pathfinder;
+struct World;
+struct JobPool;
+struct FixedTables;
+struct LevelSet;
+struct Capture;
+struct Metrics;
+struct Lighting;
+struct Audio;
+struct RenderBatch;
+struct NetServer;
+struct NetClient;
+struct Fog;
+struct SnapshotRing;
+struct Game;
+struct Camera;
+
+typedef void (*CastKernel)(const struct Game *game, struct Camera *camera,
+		int first, int last);
+typedef void (*ColumnKernel)(struct Game *game, const struct Camera *camera,
+		int column);
+
+/**
+ * struct Options - Settings given on the command line
+ * @map_path: map file, maze, world or level set specification to play
+ * @chunk_cache_mb: memory cap of the world chunk cache, in megabytes
+ * @split_screen: two local players, each with half of the window
+ * @stats: print frame statistics every STATS_INTERVAL_MS
+ * @fixed_point: cast the view with the 16.16 fixed-point engine
+ * @capture_path: file every frame is recorded to, NULL to record nothing
+ * @metrics_path: Unix socket metrics are served on, NULL to serve none
+ * @low_latency: wait for the next frame before sampling input rather
+ *		than after presenting
+ * @batched: draw each view with one SDL_RenderGeometry call per texture
+ * @serve_port: UDP port other players join on, 0 to play alone
+ * @connect_address: host:port of the server to join, NULL to play locally
+ * @cast_step: columns between two rays of the variable-rate coarse pass,
+ *		1 to cast every column
+ */
+struct Options
+{
+	const char *map_path;
+	const char *capture_path;
+	const char *metrics_path;
+	const char *connect_address;
+	int chunk_cache_mb;
+	int serve_port;
+	int cast_step;
+	bool split_screen;
+	bool stats;
+	bool fixed_point;
+	bool low_latency;
+	bool batched;
+};
 
 /**
  * struct Player - Player structure
@@ -23,15 +79,213 @@ struct Player
 	float angle;
 };
 
+/**
+ * fixed_t - 16.16 fixed-point number; world coordinates count tiles
+ */
+typedef Sint32 fixed_t;
+
+/**
+ * struct FixedPlayer - Player state of the fixed-point engine
+ * @x: x position, in tiles
+ * @y: y position, in tiles
+ * @angle: view direction, in angle units
+ */
+struct FixedPlayer
+{
+	fixed_t x;
+	fixed_t y;
+	int angle;
+};
+
+/**
+ * struct RayHit - Wall hit of one screen column
+ * @angle: angle of the column's ray, in [0, 2 * PI)
+ * @distance: distance from the viewer to the wall
+ * @end_x: x coordinate of the hit
+ * @end_y: y coordinate of the hit
+ * @is_vertical: 1 if the ray hit a vertical wall side, 0 otherwise
+ * @layer_count: number of see-through layers in front of the wall, in
+ *		the camera's layer lists
+ */
+struct RayHit
+{
+	float angle;
+	float distance;
+	float end_x;
+	float end_y;
+	int is_vertical;
+	int layer_count;
+};
+
+/**
+ * struct RayLayer - Thin wall or grate crossed by a column's ray
+ * @distance: distance from the viewer, in world units
+ * @hit_x: position of the hit along the layer, in world units
+ * @type: MAP_THIN_X, MAP_THIN_Y, MAP_GRATE_X or MAP_GRATE_Y
+ * @base: height of the layer's floor, in world units
+ * @clip: rows of the column from this one down are hidden by nearer
+ *		geometry, set while the column is drawn
+ * @light: light level of the layer's tile
+ */
+struct RayLayer
+{
+	float distance;
+	float hit_x;
+	int type;
+	int base;
+	int clip;
+	int light;
+};
+
+/**
+ * struct Camera - One view of the world, drawn into a window rectangle
+ * @player: player the camera looks through
+ * @viewport: window rectangle the view is drawn into
+ * @projection: distance to the projection plane, in pixels
+ * @hits: wall hit of every viewport column, filled by cast_rays()
+ * @angle_index: first column's ray angle, in angle steps; columns are
+ *		cast on a fixed grid of world angles so hits survive rotation
+ * @cached: @hits hold the previous frame
+ * @cached_x: x position @hits were cast from
+ * @cached_y: y position @hits were cast from
+ * @cached_revision: map revision @hits were cast against
+ * @cached_angle_index: @angle_index @hits were cast with
+ * @cast_first: first column to cast this frame
+ * @cast_last: column after the last one to cast this frame
+ * @rays_cast: rays walked through the grid this frame, added up by the
+ *		cast jobs
+ * @layers: CAST_MAX_LAYERS see-through layers per column, nearest
+ *		first, in the frame arena
+ * @cast_columns: ray caster of the configured tile size
+ * @draw_column: column renderer of the viewport height and tile size
+ *
+ * Description: Every camera shares the map and textures of the Game;
+ * only the rays are its own. The kernels are picked by setup_cameras()
+ * among instances built for common tile sizes and view heights.
+ */
+struct Camera
+{
+	const struct Player *player;
+	SDL_Rect viewport;
+	float projection;
+	struct RayHit hits[CONFIG_MAX_WIDTH];
+	int angle_index;
+	bool cached;
+	float cached_x;
+	float cached_y;
+	Uint32 cached_revision;
+	int cached_angle_index;
+	int cast_first;
+	int cast_last;
+	SDL_atomic_t rays_cast;
+	struct RayLayer *layers;
+	CastKernel cast_columns;
+	ColumnKernel draw_column;
+};
+
+/**
+ * struct FrameStats - Counters reported every STATS_INTERVAL_MS
+ * @window_start: tick the current report window started at
+ * @frames: frames rendered in the window
+ * @columns: camera columns drawn in the window
+ * @columns_cast: columns whose ray was actually cast in the window
+ * @columns_interpolated: columns the variable-rate pass filled from the
+ *		face of their neighbours in the window
+ * @pixels_drawn: view pixels written in the window, counting rewrites
+ * @pixels_covered: distinct view pixels written in the window
+ * @layers: see-through layers drawn in the window
+ * @capture_ticks: performance counter ticks the main thread spent
+ *		queueing frames for capture in the window
+ * @frames_dropped: frames the capture dropped in the window
+ * @render_calls: renderer calls made drawing the views in the window
+ * @latency: presented frames carrying input events, by input-to-present
+ *		latency; bucket 0 is under 1 ms, bucket i under 2^i ms and the
+ *		last one everything longer
+ */
+struct FrameStats
+{
+	Uint32 window_start;
+	long frames;
+	long columns;
+	long columns_cast;
+	long columns_interpolated;
+	long pixels_drawn;
+	long pixels_covered;
+	long layers;
+	Uint64 capture_ticks;
+	long frames_dropped;
+	long render_calls;
+	long latency[LATENCY_BUCKETS];
+};
+
+/**
+ * struct FramePacing - Timing of the frame loop
+ * @sample_start: performance counter when input was sampled this frame
+ * @last_present: performance counter right after the last present, 0
+ *		before the first one
+ * @work: performance counter ticks from input sampling to present of
+ *		the last PACING_HISTORY frames
+ * @next: slot of @work the next frame goes into
+ * @input_ticks: SDL tick of the oldest input event not presented yet, 0
+ *		if there is none
+ */
+struct FramePacing
+{
+	Uint64 sample_start;
+	Uint64 last_present;
+	Uint64 work[PACING_HISTORY];
+	int next;
+	Uint32 input_ticks;
+};
+
 /**
  * struct Game - Game structure
  * @window: pointer to SDL_Window
  * @renderer: pointer to SDL_Renderer
- * @player: Player structure containing player information
- * @map: integer array representing the game map
+ * @players: local players, the first one is always present
+ * @player_count: number of local players
+ * @fixed_players: the players as the fixed-point engine moves them, when
+ *		it is on; @players are then derived from them for drawing
+ * @cameras: views drawn every frame
+ * @camera_count: number of cameras
+ * @jobs: worker threads casting the cameras' rays
+ * @fixed: trig tables of the fixed-point engine, NULL when it is off
+ * @batches: RENDER_BATCHES strip batches of the batched backend, NULL
+ *		when strips are drawn one call at a time
+ * @stats: frame statistics of the current report window
+ * @pacing: frame loop timing, used for late input sampling
+ * @frame_arena: scratch memory of the frame being drawn, reset every
+ *		frame
+ * @options: settings given on the command line
+ * @map: integer array representing the game map, row-major, or NULL
+ *		when the map is a streamed world
+ * @map_width: number of tiles per map row
+ * @map_height: number of map rows
+ * @world: streamed chunked world, NULL when the map is a single array
+ * @map_revision: bumped whenever the tiles seen by the ray caster change
+ * @map_max_top: top of the tallest cell, in world units
+ * @map_has_heights: the map has low walls, towers or raised floors; a
+ *		flat map is drawn straight from the cast hits
+ * @map_has_layers: the map has thin walls or grates, which rays cross
+ * @capture: frame recorder, NULL when not capturing
+ * @metrics: metrics server, NULL when not serving
+ * @audio: sound mixer, NULL when no audio device could be opened
+ * @server: server other players joined, NULL when not hosting
+ * @client: connection to the server, NULL when playing locally
+ * @remote: players of other games in sight, drawn on the minimap
+ * @remote_count: number of entries of @remote
+ * @levels: level set being played, NULL for a single map; its current
+ *		level owns @map and @pathfinder
+ * @pathfinder: pathfinding service over the map, built at load; NULL for
+ *		a world, a map over PATH_MAX_TILES tiles or when building failed
+ * @lighting: lightmap of the map, NULL when the map has no lights
+ * @fog: tiles the players have seen, all the minimap shows
+ * @snapshots: history of the game state, NULL when joined to a server
+ * @lantern: the players' lanterns shine
  * @rotation_speed: float representing the rotation speed of the player
  * @show_map: boolean to show/hide the map
  * @wall_texture: pointer to SDL_Texture for the wall
+ * @grate_texture: alpha-masked texture of grates, made at start up
  * @sky_texture: pointer to SDL_Texture for the sky
  * @ground_texture: pointer to SDL_Texture for the ground
  * @pistol_texture: pointer to SDL_Texture for the pistol
@@ -51,11 +305,43 @@ struct Game
 {
 	SDL_Window *window;
 	SDL_Renderer *renderer;
-	struct Player player;
-	int map[MAP_WIDTH * MAP_HEIGHT];
+	struct Player players[MAX_PLAYERS];
+	int player_count;
+	struct FixedPlayer fixed_players[MAX_PLAYERS];
+	struct Camera cameras[MAX_PLAYERS];
+	int camera_count;
+	struct JobPool *jobs;
+	struct FixedTables *fixed;
+	struct RenderBatch *batches;
+	struct FrameStats stats;
+	struct FramePacing pacing;
+	struct Arena frame_arena;
+	struct Options options;
+	int *map;
+	int map_width;
+	int map_height;
+	struct World *world;
+	Uint32 map_revision;
+	int map_max_top;
+	bool map_has_heights;
+	bool map_has_layers;
+	struct Capture *capture;
+	struct Metrics *metrics;
+	struct Audio *audio;
+	struct NetServer *server;
+	struct NetClient *client;
+	const struct Player *remote;
+	int remote_count;
+	struct LevelSet *levels;
+	struct Pathfinder *pathfinder;
+	struct Lighting *lighting;
+	struct Fog *fog;
+	struct SnapshotRing *snapshots;
+	bool lantern;
 	float rotation_speed;
 	bool show_map;
 	SDL_Texture *wall_texture;
+	SDL_Texture *grate_texture;
 	SDL_Texture *sky_texture;
 	SDL_Texture *ground_texture;
 	SDL_Texture *pistol_texture;
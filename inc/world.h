@@ -0,0 +1,117 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "constants.h"
+
+#define WORLD_SPEC_PREFIX "world:"
+#define WORLD_CHUNK_SHIFT 6
+#define WORLD_CHUNK_SIZE (1 << WORLD_CHUNK_SHIFT)
+#define WORLD_CHUNK_CELLS (WORLD_CHUNK_SIZE / 2)
+#define WORLD_DEFAULT_CHUNKS 64
+#define WORLD_DEFAULT_CACHE_MB 64
+#define WORLD_RESIDENT_RADIUS 2
+#define WORLD_LOOKAHEAD_TILES WORLD_CHUNK_SIZE
+#define WORLD_MIN_CHUNKS (2 * MAX_PLAYERS * (2 * WORLD_RESIDENT_RADIUS + 1) * \
+		(2 * WORLD_RESIDENT_RADIUS + 1))
+
+/**
+ * enum ChunkState - Life cycle of a chunk slot
+ * @CHUNK_FREE: slot unused, on the free list
+ * @CHUNK_PENDING: queued or being generated by the worker thread
+ * @CHUNK_RESIDENT: tiles ready, readable by the main thread
+ */
+enum ChunkState
+{
+	CHUNK_FREE,
+	CHUNK_PENDING,
+	CHUNK_RESIDENT
+};
+
+/**
+ * struct WorldChunk - One WORLD_CHUNK_SIZE square block of the world
+ * @cx: chunk column
+ * @cy: chunk row
+ * @state: life cycle state, only changed by the main thread
+ * @hash_next: next chunk in the same hash bucket
+ * @lru_prev: more recently used resident chunk
+ * @lru_next: less recently used resident chunk
+ * @queue_next: next chunk in the request, done or free list
+ * @tiles: row-major MAP_WALL/MAP_FLOOR tiles
+ */
+struct WorldChunk
+{
+	int cx;
+	int cy;
+	enum ChunkState state;
+	struct WorldChunk *hash_next;
+	struct WorldChunk *lru_prev;
+	struct WorldChunk *lru_next;
+	struct WorldChunk *queue_next;
+	Uint8 tiles[WORLD_CHUNK_SIZE * WORLD_CHUNK_SIZE];
+};
+
+/**
+ * struct World - Streamed world made of procedurally generated chunks
+ * @seed: world seed, every chunk is derived from it and its coordinates
+ * @chunks_x: world width in chunks
+ * @chunks_y: world height in chunks
+ * @slots: every chunk slot, sized from the cache memory cap
+ * @slot_count: number of chunk slots
+ * @buckets: hash table of pending and resident chunks
+ * @bucket_mask: number of buckets minus one
+ * @lru_head: most recently used resident chunk
+ * @lru_tail: least recently used resident chunk, evicted first
+ * @free_list: unused slots
+ * @requests: chunks waiting for the worker, oldest first
+ * @requests_tail: last chunk of @requests
+ * @done: chunks generated by the worker, waiting to become resident
+ * @lock: protects @requests, @done and @quit
+ * @wake: signals the worker that a request arrived or it must quit
+ * @thread: background generation thread
+ * @quit: tells the worker to exit
+ * @resident: number of resident chunks
+ * @evictions: number of chunks evicted so far
+ *
+ * Description: Only the main thread touches the hash table, the LRU list
+ * and the free list. The worker only sees chunks through @requests and
+ * @done, so lookups from the ray caster never take a lock.
+ */
+struct World
+{
+	Uint64 seed;
+	int chunks_x;
+	int chunks_y;
+	struct WorldChunk *slots;
+	size_t slot_count;
+	struct WorldChunk **buckets;
+	size_t bucket_mask;
+	struct WorldChunk *lru_head;
+	struct WorldChunk *lru_tail;
+	struct WorldChunk *free_list;
+	struct WorldChunk *requests;
+	struct WorldChunk *requests_tail;
+	struct WorldChunk *done;
+	SDL_mutex *lock;
+	SDL_cond *wake;
+	SDL_Thread *thread;
+	bool quit;
+	size_t resident;
+	long evictions;
+};
+
+struct World *world_create(Uint64 seed, int chunks_x, int chunks_y,
+		size_t cache_bytes);
+void world_destroy(struct World *world);
+bool world_update(struct World *world, float player_x, float player_y,
+		float dir_x, float dir_y);
+int world_cell(const struct World *world, int x, int y);
+bool world_parse_spec(const char *text, Uint64 *seed, int *chunks_x,
+		int *chunks_y);
+
+struct WorldChunk *world_lookup(const struct World *world, int cx, int cy);
+void world_insert(struct World *world, struct WorldChunk *chunk);
+void world_touch(struct World *world, struct WorldChunk *chunk);
+bool world_evict(struct World *world);
+int world_worker(void *data);
+
+#endif
@@ -17,23 +17,25 @@ float calculate_corrected_distance(float distance, float ray_angle,
 /**
  * calculate_line_height - Calculate the height of the line
  * @corrected_distance: Corrected distance
+ * @projection: Distance to the camera's projection plane, in pixels
  *
  * Return: Line height
  */
-float calculate_line_height(float corrected_distance)
+float calculate_line_height(float corrected_distance, float projection)
 {
-	return ((TILE_SIZE / corrected_distance) * PROJECTION_PLANE_DISTANCE);
+	return ((TILE_SIZE / corrected_distance) * projection);
 }
 
 /**
  * calculate_line_offset - Calculate the vertical offset of the line
  * @line_height: Height of the line
+ * @view_height: Height of the camera's viewport
  *
  * Return: Line offset
  */
-float calculate_line_offset(float line_height)
+float calculate_line_offset(float line_height, int view_height)
 {
-	return ((WINDOW_HEIGHT - line_height) / 2);
+	return ((view_height - line_height) / 2);
 }
 
 /**
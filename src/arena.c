@@ -0,0 +1,61 @@
+#include "../inc/arena.h"
+
+/**
+ * arena_alloc - Carves an aligned allocation out of an arena.
+ * @arena: Pointer to the Arena.
+ * @bytes: Number of bytes requested.
+ *
+ * Return: Pointer to the memory, or NULL if the arena is full.
+ */
+void *arena_alloc(struct Arena *arena, size_t bytes)
+{
+	size_t start = (arena->used + ARENA_ALIGNMENT - 1) &
+		~(size_t)(ARENA_ALIGNMENT - 1);
+
+	if (start > arena->size || bytes > arena->size - start)
+		return (NULL);
+	arena->used = start + bytes;
+	return (arena->base + start);
+}
+
+/**
+ * arena_calloc - Carves a zero-filled array out of an arena.
+ * @arena: Pointer to the Arena.
+ * @count: Number of elements.
+ * @size: Size of one element in bytes.
+ *
+ * Return: Pointer to the zeroed memory, or NULL if the arena is full.
+ */
+void *arena_calloc(struct Arena *arena, size_t count, size_t size)
+{
+	void *memory;
+
+	if (size != 0 && count > (size_t)-1 / size)
+		return (NULL);
+	memory = arena_alloc(arena, count * size);
+	if (memory)
+		memset(memory, 0, count * size);
+	return (memory);
+}
+
+/**
+ * arena_reset - Releases every allocation of an arena at once.
+ * @arena: Pointer to the Arena.
+ */
+void arena_reset(struct Arena *arena)
+{
+	arena->used = 0;
+}
+
+/**
+ * arena_free - Returns the backing block of an arena to the system.
+ * @arena: Pointer to the Arena; a borrowed block is only forgotten.
+ */
+void arena_free(struct Arena *arena)
+{
+	if (!arena->borrowed)
+		free(arena->base);
+	arena->base = NULL;
+	arena->size = 0;
+	arena->used = 0;
+}
@@ -0,0 +1,40 @@
+#include "../inc/arena.h"
+
+/**
+ * arena_init - Allocates the backing block of an arena.
+ * @arena: Pointer to the Arena to initialize.
+ * @size: Capacity of the arena in bytes.
+ *
+ * Return: true on success, false on allocation failure.
+ */
+bool arena_init(struct Arena *arena, size_t size)
+{
+	arena->base = malloc(size);
+	arena->size = arena->base ? size : 0;
+	arena->used = 0;
+	arena->borrowed = false;
+	return (arena->base != NULL);
+}
+
+/**
+ * arena_init_from - Carves the backing block of an arena out of another.
+ * @arena: Pointer to the Arena to initialize.
+ * @parent: Arena providing the block, or NULL to allocate it like
+ *		arena_init().
+ * @size: Capacity of the arena in bytes.
+ *
+ * The block goes away with the parent's next reset; arena_free() leaves
+ * it alone.
+ *
+ * Return: true on success, false if the parent is full.
+ */
+bool arena_init_from(struct Arena *arena, struct Arena *parent, size_t size)
+{
+	if (!parent)
+		return (arena_init(arena, size));
+	arena->base = arena_alloc(parent, size);
+	arena->size = arena->base ? size : 0;
+	arena->used = 0;
+	arena->borrowed = true;
+	return (arena->base != NULL);
+}
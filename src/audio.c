@@ -0,0 +1,135 @@
+#include "../inc/game.h"
+
+/**
+ * audio_create - Starts the software mixer.
+ * @open_device: true to play through an audio device, false to only mix
+ *		with audio_mix, as benchmarks do.
+ *
+ * The device asks for stereo floats at AUDIO_RATE in blocks of
+ * AUDIO_FRAMES and is left running: a silent mixer costs a few cleared
+ * blocks. Any driver SDL offers works, the dummy one included.
+ *
+ * Return: Pointer to the Audio, or NULL on failure.
+ */
+struct Audio *audio_create(bool open_device)
+{
+	struct Audio *audio = calloc(1, sizeof(*audio));
+	SDL_AudioSpec wanted = {0}, obtained;
+
+	if (!audio || !audio_synthesize(audio))
+	{
+		audio_destroy(audio);
+		return (NULL);
+	}
+	if (!open_device)
+		return (audio);
+	wanted.freq = AUDIO_RATE;
+	wanted.format = AUDIO_F32SYS;
+	wanted.channels = 2;
+	wanted.samples = AUDIO_FRAMES;
+	wanted.callback = audio_callback;
+	wanted.userdata = audio;
+	if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0 ||
+			!(audio->device = SDL_OpenAudioDevice(NULL, 0, &wanted, &obtained,
+					0)))
+	{
+		fprintf(stderr, "Unable to open audio: %s\n", SDL_GetError());
+		audio_destroy(audio);
+		return (NULL);
+	}
+	SDL_PauseAudioDevice(audio->device, 0);
+	return (audio);
+}
+
+/**
+ * audio_destroy - Stops the mixer and releases it.
+ * @audio: Pointer to the Audio, may be NULL.
+ *
+ * Closing the device waits for a callback in progress to return.
+ */
+void audio_destroy(struct Audio *audio)
+{
+	int i;
+
+	if (!audio)
+		return;
+	if (audio->device)
+		SDL_CloseAudioDevice(audio->device);
+	for (i = 0; i < AUDIO_SOUNDS; i++)
+		free(audio->sounds[i]);
+	free(audio);
+}
+
+/**
+ * audio_push - Queues a request for the mixer.
+ * @audio: Pointer to the Audio.
+ * @command: Request, copied into the queue.
+ *
+ * Only the game thread pushes. A full queue drops the request instead of
+ * waiting for the audio thread.
+ *
+ * Return: true if the request was queued, false if it was dropped.
+ */
+bool audio_push(struct Audio *audio, const struct AudioCommand *command)
+{
+	int head = SDL_AtomicGet(&audio->head);
+
+	if (head - SDL_AtomicGet(&audio->tail) == AUDIO_COMMANDS)
+	{
+		audio->rejected++;
+		return (false);
+	}
+	audio->commands[head % AUDIO_COMMANDS] = *command;
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&audio->head, head + 1);
+	return (true);
+}
+
+/**
+ * audio_play - Starts a sound on a free voice.
+ * @audio: Pointer to the Audio.
+ * @sound: Sound to play.
+ * @x: x coordinate of the source, in world units.
+ * @y: y coordinate of the source, in world units.
+ * @gain: Loudness of the source, 1 being the sound as synthesized.
+ * @loop: true to repeat the sound until audio_stop.
+ *
+ * A one-shot voice is freed once its sound has had time to end.
+ *
+ * Return: Voice playing the sound, -1 when every voice is busy.
+ */
+int audio_play(struct Audio *audio, enum AudioSound sound, float x, float y,
+		float gain, bool loop)
+{
+	struct AudioCommand command = {AUDIO_PLAY, 0, sound, loop, x, y, gain};
+	struct AudioSource *source;
+	Uint32 now = SDL_GetTicks();
+
+	for (command.voice = 0; command.voice < AUDIO_VOICES; command.voice++)
+	{
+		source = &audio->sources[command.voice];
+		if (source->active && source->until && (Sint32)(now -
+					source->until) >= 0)
+			source->active = false;
+		if (!source->active)
+			break;
+	}
+	if (command.voice == AUDIO_VOICES || !audio_push(audio, &command))
+		return (-1);
+	*source = (struct AudioSource){x, y, loop ? 0 : now + 1 +
+		audio->lengths[sound] * 1000 / AUDIO_RATE, -1, 1, true};
+	return (command.voice);
+}
+
+/**
+ * audio_stop - Silences a voice and frees it.
+ * @audio: Pointer to the Audio.
+ * @voice: Voice returned by audio_play.
+ */
+void audio_stop(struct Audio *audio, int voice)
+{
+	struct AudioCommand command = {AUDIO_STOP, voice, 0, false, 0, 0, 0};
+
+	if (audio_push(audio, &command))
+		audio->sources[voice].active = false;
+}
@@ -0,0 +1,136 @@
+#include "../inc/game.h"
+
+static void audio_apply(struct Audio *audio,
+		const struct AudioCommand *command);
+static void audio_voice(const struct Audio *audio, struct AudioVoice *voice,
+		float *stream, int frames);
+
+/**
+ * audio_callback - Fills a block of the audio device.
+ * @data: Pointer to the Audio.
+ * @stream: Block of interleaved stereo floats.
+ * @length: Size of the block in bytes.
+ */
+void audio_callback(void *data, Uint8 *stream, int length)
+{
+	audio_mix(data, (float *)stream, length / (2 * sizeof(float)));
+}
+
+/**
+ * audio_mix - Applies the queued requests and mixes one block.
+ * @audio: Pointer to the Audio.
+ * @stream: Receives frames interleaved stereo floats.
+ * @frames: Number of stereo frames to mix.
+ *
+ * Runs on the audio thread: it never takes a lock, never allocates and
+ * never reads the game.
+ */
+void audio_mix(struct Audio *audio, float *stream, int frames)
+{
+	int tail = SDL_AtomicGet(&audio->tail), head = SDL_AtomicGet(&audio->head);
+	int i;
+
+	SDL_MemoryBarrierAcquire();
+	for (; tail != head; tail++)
+		audio_apply(audio, &audio->commands[tail % AUDIO_COMMANDS]);
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&audio->tail, tail);
+	memset(stream, 0, 2 * sizeof(*stream) * frames);
+	for (i = 0; i < AUDIO_VOICES; i++)
+		if (audio->voices[i].samples)
+			audio_voice(audio, &audio->voices[i], stream, frames);
+	for (i = 0; i < 2 * frames; i++)
+		stream[i] = fmaxf(-1, fminf(1, stream[i] * AUDIO_MASTER_GAIN));
+}
+
+/**
+ * audio_apply - Carries out one request of the game thread.
+ * @audio: Pointer to the Audio.
+ * @command: Request taken from the queue.
+ *
+ * A voice starts from silence and ramps up over its first block, so a
+ * sound never starts with a click.
+ */
+static void audio_apply(struct Audio *audio,
+		const struct AudioCommand *command)
+{
+	struct AudioVoice *voice = &audio->voices[command->voice];
+
+	switch (command->type)
+	{
+		case AUDIO_PLAY:
+			*voice = (struct AudioVoice){audio->sounds[command->sound],
+				audio->lengths[command->sound], 0, command->loop, command->x,
+				command->y, command->value, 1, 0, 0, 0};
+			break;
+		case AUDIO_STOP:
+			voice->samples = NULL;
+			break;
+		case AUDIO_OCCLUDE:
+			voice->occlusion = command->value;
+			break;
+		case AUDIO_LISTEN:
+			audio->listener_x = command->x;
+			audio->listener_y = command->y;
+			audio->listener_angle = command->value;
+			break;
+	}
+}
+
+/**
+ * audio_voice - Mixes one voice into a block.
+ * @audio: Pointer to the Audio, for the listener.
+ * @voice: Pointer to the AudioVoice, playing.
+ * @stream: Block of interleaved stereo floats being mixed.
+ * @frames: Number of stereo frames of the block.
+ *
+ * Loudness falls off with distance, reaching nothing at AUDIO_RANGE, and
+ * is panned by constant power between the listener's ears. Occluded sound
+ * is quieter and also muffled by a one-pole low-pass filter. The gains
+ * move linearly across the block towards their new values. A voice out of
+ * earshot is only moved along its sound.
+ */
+static void audio_voice(const struct Audio *audio, struct AudioVoice *voice,
+		float *stream, int frames)
+{
+	float dx = voice->x - audio->listener_x, dy = voice->y - audio->listener_y;
+	float distance = sqrtf(dx * dx + dy * dy), gain = 0, pan = 0;
+	float left = voice->left, right = voice->right;
+	float step_left, step_right, smoothing;
+	int i;
+
+	if (distance < AUDIO_RANGE)
+		gain = voice->gain * voice->occlusion * AUDIO_NEAR /
+			fmaxf(distance, AUDIO_NEAR) * (1 - distance / AUDIO_RANGE);
+	if (distance > 0)
+		pan = (dy * cosf(audio->listener_angle) - dx *
+				sinf(audio->listener_angle)) / distance;
+	step_left = (gain * cosf((pan + 1) * PI / 4) - left) / frames;
+	step_right = (gain * sinf((pan + 1) * PI / 4) - right) / frames;
+	if (gain == 0 && left == 0 && right == 0)
+	{
+		voice->position += frames;
+		if (voice->position >= voice->length && !voice->loop)
+			voice->samples = NULL;
+		voice->position %= voice->length;
+		return;
+	}
+	smoothing = 0.1f + 0.9f * voice->occlusion;
+	for (i = 0; i < frames; i++)
+	{
+		if (voice->position == voice->length && !voice->loop)
+		{
+			voice->samples = NULL;
+			break;
+		}
+		voice->position %= voice->length;
+		voice->filtered += smoothing * (voice->samples[voice->position++] -
+				voice->filtered);
+		left += step_left;
+		right += step_right;
+		stream[2 * i] += voice->filtered * left;
+		stream[2 * i + 1] += voice->filtered * right;
+	}
+	voice->left = left;
+	voice->right = right;
+}
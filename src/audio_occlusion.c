@@ -0,0 +1,59 @@
+#include "../inc/game.h"
+
+/**
+ * struct AudioTrace - A sound traced through the grid
+ * @game: game holding the map
+ * @heard: share of the sound still heard
+ */
+struct AudioTrace
+{
+	const struct Game *game;
+	float heard;
+};
+
+static bool audio_absorb(int map_x, int map_y, void *data);
+
+/**
+ * audio_occlusion - Traces sound through the grid.
+ * @game: Pointer to the Game structure.
+ * @from_x: Listener x coordinate, in world units.
+ * @from_y: Listener y coordinate, in world units.
+ * @to_x: Source x coordinate, in world units.
+ * @to_y: Source y coordinate, in world units.
+ *
+ * Every tile between the two ends takes its share of the sound: walls
+ * the most, thin walls less, grates hardly any.
+ *
+ * Return: Share of the sound heard, 0 under AUDIO_MIN_OCCLUSION.
+ */
+float audio_occlusion(const struct Game *game, float from_x,
+		float from_y, float to_x, float to_y)
+{
+	struct AudioTrace trace = {game, 1};
+
+	map_segment_walk(from_x / TILE_SIZE, from_y / TILE_SIZE,
+			to_x / TILE_SIZE, to_y / TILE_SIZE, audio_absorb, &trace);
+	return (trace.heard < AUDIO_MIN_OCCLUSION ? 0 : trace.heard);
+}
+
+/**
+ * audio_absorb - Takes a tile's share of a traced sound.
+ * @map_x: Tile column.
+ * @map_y: Tile row.
+ * @data: Pointer to the AudioTrace.
+ *
+ * Return: true while enough of the sound is left to keep tracing.
+ */
+static bool audio_absorb(int map_x, int map_y, void *data)
+{
+	struct AudioTrace *trace = data;
+	int type = map_cell(trace->game, map_x, map_y);
+
+	if (type == MAP_WALL)
+		trace->heard *= AUDIO_WALL_GAIN;
+	else if (type == MAP_THIN_X || type == MAP_THIN_Y)
+		trace->heard *= AUDIO_THIN_GAIN;
+	else if (type == MAP_GRATE_X || type == MAP_GRATE_Y)
+		trace->heard *= AUDIO_GRATE_GAIN;
+	return (trace->heard >= AUDIO_MIN_OCCLUSION);
+}
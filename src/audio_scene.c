@@ -0,0 +1,132 @@
+#include "../inc/game.h"
+
+static void audio_hums(struct Game *game);
+static void audio_steps(struct Game *game);
+
+/**
+ * audio_update - Sends the mixer what changed in the scene this frame.
+ * @game: Pointer to the Game structure.
+ *
+ * The first player is the listener. Footsteps and the hum of the nearest
+ * lights are started or stopped, then every voice in earshot gets the
+ * share of its sound that reaches the listener through the map; a share
+ * is only sent again once it changed by AUDIO_OCCLUSION_STEP.
+ */
+void audio_update(struct Game *game)
+{
+	struct Audio *audio = game->audio;
+	const struct Player *listener = &game->players[0];
+	struct AudioCommand command = {AUDIO_LISTEN, 0, 0, false, listener->x,
+		listener->y, listener->angle};
+	struct AudioSource *source;
+	float occlusion;
+
+	if (!audio)
+		return;
+	audio_push(audio, &command);
+	audio_steps(game);
+	audio_hums(game);
+	command.type = AUDIO_OCCLUDE;
+	for (command.voice = 0; command.voice < AUDIO_VOICES; command.voice++)
+	{
+		source = &audio->sources[command.voice];
+		if (!source->active || fabsf(source->x - listener->x) >= AUDIO_RANGE ||
+				fabsf(source->y - listener->y) >= AUDIO_RANGE)
+			continue;
+		occlusion = audio_occlusion(game, listener->x, listener->y, source->x,
+				source->y);
+		if (fabsf(occlusion - source->occlusion) < AUDIO_OCCLUSION_STEP)
+			continue;
+		command.value = occlusion;
+		if (audio_push(audio, &command))
+			source->occlusion = occlusion;
+	}
+}
+
+/**
+ * audio_click - Plays the click of a switch at the first player.
+ * @game: Pointer to the Game structure.
+ */
+void audio_click(struct Game *game)
+{
+	if (game->audio)
+		audio_play(game->audio, AUDIO_CLICK, game->players[0].x,
+				game->players[0].y, 1, false);
+}
+
+/**
+ * audio_hums - Keeps the AUDIO_HUMS lights nearest the listener humming.
+ * @game: Pointer to the Game structure.
+ *
+ * Hums follow the lightmap: a new level silences the old lights.
+ */
+static void audio_hums(struct Game *game)
+{
+	struct Audio *audio = game->audio;
+	const struct Lighting *lighting = game->lighting;
+	const struct Player *listener = &game->players[0];
+	int nearest[AUDIO_HUMS], count = 0, light, i, voice;
+	float distance[AUDIO_HUMS], dx, dy, d;
+
+	for (light = 0; lighting && light < lighting->static_count; light++)
+	{
+		dx = lighting->lights[light].x - listener->x;
+		dy = lighting->lights[light].y - listener->y;
+		d = dx * dx + dy * dy;
+		if (d >= (float)AUDIO_RANGE * AUDIO_RANGE ||
+				(count == AUDIO_HUMS && d >= distance[count - 1]))
+			continue;
+		for (i = count < AUDIO_HUMS ? count++ : count - 1;
+				i > 0 && distance[i - 1] > d; i--)
+		{
+			nearest[i] = nearest[i - 1];
+			distance[i] = distance[i - 1];
+		}
+		nearest[i] = light;
+		distance[i] = d;
+	}
+	for (voice = 0; voice < AUDIO_VOICES; voice++)
+	{
+		for (i = 0; i < count && nearest[i] != audio->sources[voice].light; i++)
+			;
+		if (audio->sources[voice].active &&
+				audio->sources[voice].light >= 0 &&
+				(audio->lighting != lighting || i == count))
+			audio_stop(audio, voice);
+		else if (i < count && audio->sources[voice].active)
+			nearest[i] = -1;
+	}
+	audio->lighting = lighting;
+	for (i = 0; i < count; i++)
+		if (nearest[i] >= 0 && (voice = audio_play(audio, AUDIO_HUM,
+						lighting->lights[nearest[i]].x,
+						lighting->lights[nearest[i]].y, 0.5f, true)) >= 0)
+			audio->sources[voice].light = nearest[i];
+}
+
+/**
+ * audio_steps - Plays a footstep every AUDIO_STEP_DISTANCE a player walks.
+ * @game: Pointer to the Game structure.
+ *
+ * A jump of several tiles, such as a level switch, makes no sound.
+ */
+static void audio_steps(struct Game *game)
+{
+	struct Audio *audio = game->audio;
+	const struct Player *player;
+	float dx, dy;
+	int i;
+
+	for (i = 0; i < game->player_count; i++)
+	{
+		player = &game->players[i];
+		dx = player->x - audio->step_x[i];
+		dy = player->y - audio->step_y[i];
+		if (dx * dx + dy * dy < (float)AUDIO_STEP_DISTANCE * AUDIO_STEP_DISTANCE)
+			continue;
+		if (dx * dx + dy * dy < 16.0f * TILE_SIZE * TILE_SIZE)
+			audio_play(audio, AUDIO_STEP, player->x, player->y, 0.8f, false);
+		audio->step_x[i] = player->x;
+		audio->step_y[i] = player->y;
+	}
+}
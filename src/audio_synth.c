@@ -0,0 +1,56 @@
+#include "../inc/game.h"
+
+static float audio_noise(Uint32 *state);
+
+/**
+ * audio_synthesize - Makes the sounds of the game.
+ * @audio: Pointer to the Audio, its sounds not made yet.
+ *
+ * The game ships no sound files, so every sound is synthesized once at
+ * start up. The hum holds a whole number of periods of each of its
+ * partials, so it loops without a seam.
+ *
+ * Return: true on success, false on allocation failure.
+ */
+bool audio_synthesize(struct Audio *audio)
+{
+	static const float seconds[AUDIO_SOUNDS] = {1, 0.15f, 0.03f};
+	Uint32 state = 1;
+	float t, *samples;
+	int sound, i;
+
+	for (sound = 0; sound < AUDIO_SOUNDS; sound++)
+	{
+		audio->lengths[sound] = seconds[sound] * AUDIO_RATE;
+		samples = malloc(audio->lengths[sound] * sizeof(*samples));
+		if (!samples)
+			return (false);
+		audio->sounds[sound] = samples;
+		for (i = 0; i < audio->lengths[sound]; i++)
+		{
+			t = (float)i / AUDIO_RATE;
+			if (sound == AUDIO_HUM)
+				samples[i] = 0.2f * sinf(2 * PI * 100 * t) + 0.1f *
+					sinf(2 * PI * 200 * t) + 0.05f * sinf(2 * PI * 300 * t) +
+					0.02f * audio_noise(&state);
+			else if (sound == AUDIO_STEP)
+				samples[i] = expf(-t * 40) * (0.6f * sinf(2 * PI * 70 * t) +
+						0.3f * expf(-t * 60) * audio_noise(&state));
+			else
+				samples[i] = 0.5f * expf(-t * 300) * audio_noise(&state);
+		}
+	}
+	return (true);
+}
+
+/**
+ * audio_noise - Draws white noise.
+ * @state: State of the generator, advanced.
+ *
+ * Return: Sample between -1 and 1.
+ */
+static float audio_noise(Uint32 *state)
+{
+	*state = *state * 1664525u + 1013904223u;
+	return ((*state >> 8) / (float)(1 << 23) - 1);
+}
@@ -0,0 +1,176 @@
+#include "../inc/game.h"
+
+static int camera_plan_cast(struct Game *game, struct Camera *camera);
+static int camera_batches(const struct Camera *camera);
+static void cast_camera_batch(void *context, int index);
+
+/**
+ * setup_cameras - Gives every local player a camera.
+ * @game: Pointer to the Game structure, its player count already set.
+ *
+ * The window is split into side by side viewports of equal width. The
+ * field of view stays FOV_DEGREES wide, so the projection plane is
+ * recomputed from each viewport's width. The cast and column kernels are
+ * picked here, once, for the configured tile size and window height.
+ */
+void setup_cameras(struct Game *game)
+{
+	int i, width = WINDOW_WIDTH / game->player_count;
+	struct Camera *camera;
+
+	game->camera_count = game->player_count;
+	for (i = 0; i < game->camera_count; i++)
+	{
+		camera = &game->cameras[i];
+		camera->player = &game->players[i];
+		camera->viewport = (SDL_Rect){i * width, 0, width, WINDOW_HEIGHT};
+		camera->projection = (width / 2) / tan(FOV_HALF_RADIAN);
+		camera->cast_columns = cast_kernel();
+		camera->draw_column = column_kernel(WINDOW_HEIGHT);
+		camera->cached = false;
+	}
+}
+
+/**
+ * render_cameras - Renders every camera of the game in one pass.
+ * @game: Pointer to the Game structure.
+ *
+ * The rays of all cameras are cast first, split into batches of
+ * CAST_BATCH_COLUMNS columns that the job pool spreads across threads, so
+ * K cameras cost about K single views no matter how the columns divide
+ * among them. Only the columns the previous frame cannot provide are
+ * cast, at a variable rate when the options ask for it, and their hits
+ * reveal the tiles they crossed to every camera's minimap. The renderer is
+ * then driven from this thread only, one viewport at a time; batched
+ * strips are drawn before the map and weapon go over the view.
+ */
+void render_cameras(struct Game *game)
+{
+	struct Camera *camera;
+	int i, column, cast, batches = 0;
+
+	arena_reset(&game->frame_arena);
+	if (game->fixed)
+		fixed_sync_players(game);
+	for (i = 0; i < game->camera_count; i++)
+		batches += camera_plan_cast(game, &game->cameras[i]);
+	job_pool_run(game->jobs, cast_camera_batch, game, batches);
+	for (i = 0; i < game->camera_count; i++)
+		fog_reveal(game, &game->cameras[i], game->cameras[i].cast_first,
+				game->cameras[i].cast_last);
+
+	for (i = 0; i < game->camera_count; i++)
+	{
+		camera = &game->cameras[i];
+		cast = SDL_AtomicGet(&camera->rays_cast);
+		game->stats.columns_cast += cast;
+		game->stats.columns_interpolated += camera->cast_last -
+			camera->cast_first - cast;
+		SDL_RenderSetViewport(game->renderer, &camera->viewport);
+		for (column = 0; column < camera->viewport.w; column++)
+			camera->draw_column(game, camera, column);
+		render_flush(game);
+		if (game->show_map)
+			draw_2d_map(game, camera);
+		draw_weapon(game, camera);
+	}
+	SDL_RenderSetViewport(game->renderer, NULL);
+}
+
+/**
+ * camera_plan_cast - Reuses what it can of the previous frame's hits and
+ *		picks the columns left to cast.
+ * @game: Pointer to the Game structure.
+ * @camera: Pointer to the Camera.
+ *
+ * Column rays sit on a grid of world angles angle_step apart, so a pure
+ * rotation moves hits by a whole number of columns: they are shifted and
+ * only the newly exposed columns are cast. A frame where neither the
+ * viewer nor the map changed casts nothing. The fixed-point engine keeps
+ * its own angle grid, and the layer lists of maps with thin walls or
+ * grates live in the frame arena, so both always cast every column.
+ *
+ * Return: Number of cast batches of the camera.
+ */
+static int camera_plan_cast(struct Game *game, struct Camera *camera)
+{
+	int width = camera->viewport.w, shift;
+	float angle_step = FOV_RADIAN / (width - 1);
+
+	camera->angle_index = (int)lroundf((camera->player->angle -
+				FOV_HALF_RADIAN) / angle_step);
+	shift = camera->angle_index - camera->cached_angle_index;
+	camera->cast_first = 0;
+	camera->cast_last = width;
+	camera->layers = game->map_has_layers ? arena_alloc(&game->frame_arena,
+			width * CAST_MAX_LAYERS * sizeof(*camera->layers)) : NULL;
+	if (!game->fixed && !game->map_has_layers && camera->cached &&
+			abs(shift) < width && camera->cached_x == camera->player->x &&
+			camera->cached_y == camera->player->y &&
+			camera->cached_revision == game->map_revision)
+	{
+		if (shift > 0)
+			memmove(camera->hits, camera->hits + shift,
+					(width - shift) * sizeof(*camera->hits));
+		else if (shift < 0)
+			memmove(camera->hits - shift, camera->hits,
+					(width + shift) * sizeof(*camera->hits));
+		camera->cast_first = shift > 0 ? width - shift : 0;
+		camera->cast_last = shift > 0 ? width : -shift;
+	}
+	camera->cached = true;
+	camera->cached_x = camera->player->x;
+	camera->cached_y = camera->player->y;
+	camera->cached_revision = game->map_revision;
+	camera->cached_angle_index = camera->angle_index;
+	SDL_AtomicSet(&camera->rays_cast, 0);
+	game->stats.columns += width;
+	return (camera_batches(camera));
+}
+
+/**
+ * camera_batches - Counts the cast batches of a camera.
+ * @camera: Pointer to the Camera.
+ *
+ * Return: Number of CAST_BATCH_COLUMNS wide batches covering the columns
+ * to cast this frame.
+ */
+static int camera_batches(const struct Camera *camera)
+{
+	return ((camera->cast_last - camera->cast_first + CAST_BATCH_COLUMNS - 1)
+		/ CAST_BATCH_COLUMNS);
+}
+
+/**
+ * cast_camera_batch - Job casting one batch of columns.
+ * @context: Pointer to the Game structure.
+ * @index: Batch index, counted across every camera in order.
+ */
+static void cast_camera_batch(void *context, int index)
+{
+	struct Game *game = context;
+	struct Camera *camera = game->cameras;
+	int first, last, column, cast;
+
+	while (index >= camera_batches(camera))
+		index -= camera_batches(camera++);
+	first = camera->cast_first + index * CAST_BATCH_COLUMNS;
+	last = first + CAST_BATCH_COLUMNS;
+	if (last > camera->cast_last)
+		last = camera->cast_last;
+	cast = last - first;
+	if (game->fixed)
+		fixed_cast_rays(game, camera, first, last);
+	else if (game->options.cast_step > 1)
+		cast = cast_rays_variable(game, camera, first, last,
+				game->options.cast_step);
+	else
+		camera->cast_columns(game, camera, first, last);
+	SDL_AtomicAdd(&camera->rays_cast, cast);
+	for (column = first; column < last; column++)
+		if (camera->layers)
+			cast_layers(game, camera->player, &camera->hits[column],
+					camera->layers + column * CAST_MAX_LAYERS);
+		else
+			camera->hits[column].layer_count = 0;
+}
@@ -0,0 +1,186 @@
+#include "../inc/capture.h"
+
+static bool capture_open(struct Capture *capture, const char *path);
+static int capture_worker(void *data);
+static void capture_targets(struct Capture *capture);
+
+/**
+ * capture_create - Starts recording the frames of a renderer.
+ * @renderer: Renderer whose output is captured.
+ * @path: Output file. A name ending in CAPTURE_Y4M_SUFFIX is written as
+ *		Y4M video, anything else as raw RGB frames with a sidecar index at
+ *		path + CAPTURE_INDEX_SUFFIX.
+ *
+ * Return: Pointer to the Capture, or NULL on failure.
+ */
+struct Capture *capture_create(SDL_Renderer *renderer, const char *path)
+{
+	struct Capture *capture = calloc(1, sizeof(*capture));
+	int i;
+
+	if (!capture)
+		return (NULL);
+	capture->renderer = renderer;
+	if (SDL_GetRendererOutputSize(renderer, &capture->width,
+				&capture->height) != 0 || !capture_open(capture, path))
+	{
+		capture_destroy(capture);
+		return (NULL);
+	}
+	for (i = 0; i < CAPTURE_SLOTS; i++)
+	{
+		capture->frames[i].pixels = malloc((size_t)capture->width *
+				capture->height * sizeof(*capture->frames[i].pixels));
+		if (!capture->frames[i].pixels)
+			break;
+	}
+	capture->planes = malloc((size_t)capture->width * capture->height * 3);
+	capture->ready = SDL_CreateSemaphore(0);
+	if (i < CAPTURE_SLOTS || !capture->planes || !capture->ready ||
+			!capture_write_header(capture) ||
+			!(capture->thread = SDL_CreateThread(capture_worker, "capture",
+					capture)))
+	{
+		fprintf(stderr, "Error starting the capture to %s\n", path);
+		capture_destroy(capture);
+		return (NULL);
+	}
+	capture_targets(capture);
+	return (capture);
+}
+
+/**
+ * capture_destroy - Writes the frames still queued and stops recording.
+ * @capture: Pointer to the Capture, may be NULL.
+ */
+void capture_destroy(struct Capture *capture)
+{
+	int i;
+
+	if (!capture)
+		return;
+	if (capture->thread)
+	{
+		capture_flush(capture);
+		SDL_AtomicSet(&capture->quit, 1);
+		SDL_SemPost(capture->ready);
+		SDL_WaitThread(capture->thread, NULL);
+		printf("Captured %d frames, %ld dropped%s\n",
+				SDL_AtomicGet(&capture->tail), capture->dropped,
+				SDL_AtomicGet(&capture->failed) ? ", stopped by a write error" :
+				"");
+	}
+	for (i = 0; i < CAPTURE_TARGETS; i++)
+		if (capture->targets[i])
+			SDL_DestroyTexture(capture->targets[i]);
+	if (capture->ready)
+		SDL_DestroySemaphore(capture->ready);
+	for (i = 0; i < CAPTURE_SLOTS; i++)
+		free(capture->frames[i].pixels);
+	free(capture->planes);
+	if (capture->index)
+		fclose(capture->index);
+	if (capture->file)
+		fclose(capture->file);
+	free(capture);
+}
+
+/**
+ * capture_open - Opens the output files of a capture.
+ * @capture: Pointer to the Capture.
+ * @path: Output file.
+ *
+ * Return: true on success, false otherwise.
+ */
+static bool capture_open(struct Capture *capture, const char *path)
+{
+	size_t length = strlen(path), suffix = strlen(CAPTURE_Y4M_SUFFIX);
+	char *index_path;
+
+	capture->file = fopen(path, "wb");
+	if (capture->file && (length < suffix ||
+				strcmp(path + length - suffix, CAPTURE_Y4M_SUFFIX) != 0))
+	{
+		index_path = malloc(length + strlen(CAPTURE_INDEX_SUFFIX) + 1);
+		if (index_path)
+		{
+			strcpy(index_path, path);
+			strcat(index_path, CAPTURE_INDEX_SUFFIX);
+			capture->index = fopen(index_path, "w");
+			free(index_path);
+		}
+		if (!capture->index)
+		{
+			fprintf(stderr, "Error opening the capture index of %s\n", path);
+			return (false);
+		}
+	}
+	if (!capture->file)
+		fprintf(stderr, "Error opening capture file: %s\n", path);
+	return (capture->file != NULL);
+}
+
+/**
+ * capture_worker - Writer thread encoding queued frames.
+ * @data: Pointer to the Capture.
+ *
+ * The semaphore is posted once per queued frame and once more to quit,
+ * so the frames queued before quitting are always written. After a
+ * write error frames are still consumed, but no longer written.
+ *
+ * Return: Always 0.
+ */
+static int capture_worker(void *data)
+{
+	struct Capture *capture = data;
+	int tail;
+
+	while (true)
+	{
+		SDL_SemWait(capture->ready);
+		tail = SDL_AtomicGet(&capture->tail);
+		if (tail == SDL_AtomicGet(&capture->head))
+		{
+			if (SDL_AtomicGet(&capture->quit))
+				break;
+			continue;
+		}
+		SDL_MemoryBarrierAcquire();
+		if (!SDL_AtomicGet(&capture->failed) && !capture_encode(capture,
+					&capture->frames[tail % CAPTURE_SLOTS]))
+			SDL_AtomicSet(&capture->failed, 1);
+		SDL_MemoryBarrierRelease();
+		SDL_AtomicSet(&capture->tail, tail + 1);
+	}
+	return (0);
+}
+
+/**
+ * capture_targets - Creates the textures frames are drawn to.
+ * @capture: Pointer to the Capture, its frame size known.
+ *
+ * When the renderer cannot make them, they are left NULL and frames are
+ * read from the back buffer right before they are presented.
+ */
+static void capture_targets(struct Capture *capture)
+{
+	int i;
+
+	for (i = 0; i < CAPTURE_TARGETS; i++)
+	{
+		capture->targets[i] = SDL_CreateTexture(capture->renderer,
+				SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+				capture->width, capture->height);
+		if (!capture->targets[i])
+			break;
+		SDL_SetTextureBlendMode(capture->targets[i], SDL_BLENDMODE_NONE);
+	}
+	if (i == CAPTURE_TARGETS)
+		return;
+	for (i = 0; i < CAPTURE_TARGETS; i++)
+	{
+		if (capture->targets[i])
+			SDL_DestroyTexture(capture->targets[i]);
+		capture->targets[i] = NULL;
+	}
+}
@@ -0,0 +1,121 @@
+#include "../inc/capture.h"
+
+static void capture_convert_yuv(const struct Capture *capture,
+		const Uint32 *pixels, Uint8 *planes);
+static void capture_convert_rgb(const struct Capture *capture,
+		const Uint32 *pixels, Uint8 *planes);
+
+/**
+ * capture_write_header - Writes the stream header of a capture.
+ * @capture: Pointer to the Capture, its files open.
+ *
+ * Y4M needs a frame rate; CAPTURE_FPS is the rate the game loop aims
+ * for. C420jpeg only gives the chroma siting, so XCOLORRANGE=FULL tells
+ * readers the samples use the full 0-255 range. Raw captures record the
+ * actual tick of every frame in the index.
+ *
+ * Return: true on success, false on a write error.
+ */
+bool capture_write_header(struct Capture *capture)
+{
+	if (capture->index)
+		return (fprintf(capture->index, "# rgb24 %dx%d\n# frame ticks offset\n",
+					capture->width, capture->height) > 0);
+	return (fprintf(capture->file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg"
+				" XCOLORRANGE=FULL\n", capture->width, capture->height,
+				CAPTURE_FPS) > 0);
+}
+
+/**
+ * capture_encode - Converts a frame and appends it to the capture.
+ * @capture: Pointer to the Capture.
+ * @frame: Pointer to the frame, owned by the writer until it returns.
+ *
+ * Return: true on success, false on a write error.
+ */
+bool capture_encode(struct Capture *capture, const struct CaptureFrame *frame)
+{
+	size_t pixels = (size_t)capture->width * capture->height, size;
+	long offset;
+
+	if (capture->index)
+	{
+		offset = ftell(capture->file);
+		capture_convert_rgb(capture, frame->pixels, capture->planes);
+		size = pixels * 3;
+		return (offset >= 0 && fwrite(capture->planes, 1, size,
+					capture->file) == size && fprintf(capture->index,
+						"%u %u %ld\n", frame->number, frame->ticks, offset) > 0);
+	}
+	capture_convert_yuv(capture, frame->pixels, capture->planes);
+	size = pixels + 2 * (size_t)((capture->width + 1) / 2) *
+		((capture->height + 1) / 2);
+	return (fputs("FRAME\n", capture->file) >= 0 &&
+			fwrite(capture->planes, 1, size, capture->file) == size);
+}
+
+/**
+ * capture_convert_yuv - Converts ARGB pixels to full range 4:2:0 planes.
+ * @capture: Pointer to the Capture giving the frame size.
+ * @pixels: ARGB8888 pixels.
+ * @planes: Receives the Y plane, then the U and V planes at half size.
+ *
+ * BT.601 coefficients in 8.8 fixed point; chroma is taken from the
+ * average of each 2x2 block, edge pixels repeated on odd sizes.
+ */
+static void capture_convert_yuv(const struct Capture *capture,
+		const Uint32 *pixels, Uint8 *planes)
+{
+	int width = capture->width, height = capture->height, x, y, dx, dy;
+	int chroma_width = (width + 1) / 2, chroma_height = (height + 1) / 2;
+	int red, green, blue;
+	Uint32 pixel;
+	Uint8 *u = planes + (size_t)width * height;
+	Uint8 *v = u + (size_t)chroma_width * chroma_height;
+
+	for (y = 0; y < height; y++)
+		for (x = 0; x < width; x++)
+		{
+			pixel = pixels[(size_t)y * width + x];
+			planes[(size_t)y * width + x] = (77 * (pixel >> 16 & 0xff) +
+					150 * (pixel >> 8 & 0xff) + 29 * (pixel & 0xff) + 128) >> 8;
+		}
+	for (y = 0; y < chroma_height; y++)
+		for (x = 0; x < chroma_width; x++)
+		{
+			red = green = blue = 0;
+			for (dy = 0; dy < 2; dy++)
+				for (dx = 0; dx < 2; dx++)
+				{
+					pixel = pixels[(size_t)(2 * y + dy < height ? 2 * y + dy :
+							height - 1) * width + (2 * x + dx < width ?
+								2 * x + dx : width - 1)];
+					red += pixel >> 16 & 0xff;
+					green += pixel >> 8 & 0xff;
+					blue += pixel & 0xff;
+				}
+			u[(size_t)y * chroma_width + x] = (-43 * red - 85 * green +
+					128 * blue + 4 * 32895) >> 10;
+			v[(size_t)y * chroma_width + x] = (128 * red - 107 * green -
+					21 * blue + 4 * 32895) >> 10;
+		}
+}
+
+/**
+ * capture_convert_rgb - Packs ARGB pixels as 24-bit RGB.
+ * @capture: Pointer to the Capture giving the frame size.
+ * @pixels: ARGB8888 pixels.
+ * @planes: Receives the packed pixels, red first.
+ */
+static void capture_convert_rgb(const struct Capture *capture,
+		const Uint32 *pixels, Uint8 *planes)
+{
+	size_t i, count = (size_t)capture->width * capture->height;
+
+	for (i = 0; i < count; i++)
+	{
+		planes[3 * i] = pixels[i] >> 16 & 0xff;
+		planes[3 * i + 1] = pixels[i] >> 8 & 0xff;
+		planes[3 * i + 2] = pixels[i] & 0xff;
+	}
+}
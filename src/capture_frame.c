@@ -0,0 +1,106 @@
+#include "../inc/capture.h"
+
+static bool capture_queue(struct Capture *capture, Uint32 number,
+		Uint32 ticks);
+
+/**
+ * capture_begin - Points the renderer at the texture the frame is drawn to.
+ * @capture: Pointer to the Capture.
+ *
+ * Called before anything of the frame is drawn. Without textures the
+ * frame is drawn to the back buffer as usual.
+ */
+void capture_begin(struct Capture *capture)
+{
+	if (capture->targets[0])
+		SDL_SetRenderTarget(capture->renderer,
+				capture->targets[capture->target]);
+}
+
+/**
+ * capture_frame - Puts the frame just drawn on screen and queues the
+ *		frame before it for the writer.
+ * @capture: Pointer to the Capture.
+ *
+ * The texture the frame was drawn to is copied to the back buffer, not
+ * presented yet, and the frame drawn to the other texture on the call
+ * before is read back. Without textures the frame just drawn is read
+ * from the back buffer instead. When the writer has fallen CAPTURE_SLOTS
+ * frames behind, the frame is dropped rather than waited for.
+ *
+ * Return: true unless a frame was dropped.
+ */
+bool capture_frame(struct Capture *capture)
+{
+	Uint32 number = capture->number++, ticks = SDL_GetTicks();
+	bool queued = true;
+
+	if (!capture->targets[0])
+		return (capture_queue(capture, number, ticks));
+	SDL_SetRenderTarget(capture->renderer, NULL);
+	SDL_RenderCopy(capture->renderer, capture->targets[capture->target],
+			NULL, NULL);
+	capture->target = (capture->target + 1) % CAPTURE_TARGETS;
+	if (capture->pending)
+	{
+		SDL_SetRenderTarget(capture->renderer,
+				capture->targets[capture->target]);
+		queued = capture_queue(capture, capture->pending_number,
+				capture->pending_ticks);
+		SDL_SetRenderTarget(capture->renderer, NULL);
+	}
+	capture->pending = true;
+	capture->pending_number = number;
+	capture->pending_ticks = ticks;
+	return (queued);
+}
+
+/**
+ * capture_flush - Queues the frame drawn last, not read back yet.
+ * @capture: Pointer to the Capture.
+ *
+ * Called once no more frames are drawn, so the last one is not lost.
+ */
+void capture_flush(struct Capture *capture)
+{
+	if (!capture->pending)
+		return;
+	SDL_SetRenderTarget(capture->renderer,
+			capture->targets[(capture->target + CAPTURE_TARGETS - 1) %
+			CAPTURE_TARGETS]);
+	capture_queue(capture, capture->pending_number, capture->pending_ticks);
+	SDL_SetRenderTarget(capture->renderer, NULL);
+	capture->pending = false;
+}
+
+/**
+ * capture_queue - Reads the current render target into the ring.
+ * @capture: Pointer to the Capture.
+ * @number: Number of the frame read.
+ * @ticks: SDL tick the frame was presented at.
+ *
+ * Return: true if the frame was queued, false if it was dropped.
+ */
+static bool capture_queue(struct Capture *capture, Uint32 number,
+		Uint32 ticks)
+{
+	int head = SDL_AtomicGet(&capture->head);
+	struct CaptureFrame *frame = &capture->frames[head % CAPTURE_SLOTS];
+
+	if (SDL_AtomicGet(&capture->failed))
+		return (false);
+	if (head - SDL_AtomicGet(&capture->tail) == CAPTURE_SLOTS ||
+			SDL_RenderReadPixels(capture->renderer, NULL,
+				SDL_PIXELFORMAT_ARGB8888, frame->pixels,
+				capture->width * sizeof(*frame->pixels)) != 0)
+	{
+		capture->dropped++;
+		return (false);
+	}
+	frame->number = number;
+	frame->ticks = ticks;
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&capture->head, head + 1);
+	SDL_SemPost(capture->ready);
+	return (true);
+}
@@ -0,0 +1,121 @@
+#include "../inc/game.h"
+
+static bool layer_hit(const struct Game *game, int map_x, int map_y,
+		const float origin[2], const float direction[2], float enter,
+		float leave, struct RayLayer *layer);
+static bool layer_keep(struct RayLayer *layers, int *count,
+		const struct RayLayer *layer);
+
+/**
+ * cast_layers - Collects the thin walls and grates a column's ray crosses.
+ * @game: Pointer to the Game structure.
+ * @viewer: Pointer to the Player the ray starts from.
+ * @hit: Pointer to the column's RayHit, its angle set; receives the
+ *		number of layers.
+ * @layers: CAST_MAX_LAYERS entries, filled nearest first.
+ *
+ * The ray walks the grid cell by cell up to a wall nothing can be seen
+ * over, or the map edge. Layers past the cap are dropped, except a thin
+ * wall: it hides everything behind it, so it always takes the last entry
+ * and ends the walk. Only the map is read, so columns can be collected
+ * from several threads at once.
+ */
+void cast_layers(const struct Game *game, const struct Player *viewer,
+		struct RayHit *hit, struct RayLayer *layers)
+{
+	float origin[2] = {viewer->x / TILE_SIZE, viewer->y / TILE_SIZE};
+	float direction[2] = {cosf(hit->angle), sinf(hit->angle)};
+	float delta_x = direction[0] ? fabsf(1 / direction[0]) : HUGE_VALF;
+	float delta_y = direction[1] ? fabsf(1 / direction[1]) : HUGE_VALF;
+	int map_x = (int)origin[0], map_y = (int)origin[1], type, count = 0;
+	float side_x = direction[0] ? (direction[0] < 0 ? origin[0] - map_x :
+			map_x + 1 - origin[0]) * delta_x : HUGE_VALF;
+	float side_y = direction[1] ? (direction[1] < 0 ? origin[1] - map_y :
+			map_y + 1 - origin[1]) * delta_y : HUGE_VALF;
+	float enter = 0, leave;
+	struct RayLayer layer;
+
+	while (map_in_bounds(game, map_x, map_y))
+	{
+		type = map_cell(game, map_x, map_y);
+		if (type == MAP_WALL && (!game->map_has_heights ||
+					map_cell_top(game, map_x, map_y) >= game->map_max_top))
+			break;
+		leave = fminf(side_x, side_y);
+		if (type != MAP_WALL && type != MAP_FLOOR && layer_hit(game, map_x,
+					map_y, origin, direction, enter, leave, &layer) &&
+				layer_keep(layers, &count, &layer))
+			break;
+		enter = leave;
+		if (side_x < side_y)
+		{
+			side_x += delta_x;
+			map_x += direction[0] < 0 ? -1 : 1;
+		}
+		else
+		{
+			side_y += delta_y;
+			map_y += direction[1] < 0 ? -1 : 1;
+		}
+	}
+	hit->layer_count = count;
+}
+
+/**
+ * layer_hit - Intersects a ray with the layer across the middle of a cell.
+ * @game: Pointer to the Game structure.
+ * @map_x: Tile column of the cell.
+ * @map_y: Tile row of the cell.
+ * @origin: Start of the ray, in tiles.
+ * @direction: Unit direction of the ray.
+ * @enter: Distance where the ray enters the cell, in tiles.
+ * @leave: Distance where the ray leaves the cell, in tiles.
+ * @layer: Pointer to the RayLayer to fill.
+ *
+ * Return: true if the ray crosses the layer inside the cell.
+ */
+static bool layer_hit(const struct Game *game, int map_x, int map_y,
+		const float origin[2], const float direction[2], float enter,
+		float leave, struct RayLayer *layer)
+{
+	int type = map_cell(game, map_x, map_y);
+	int axis = type == MAP_THIN_X || type == MAP_GRATE_X ? 0 : 1;
+	float plane = (axis == 0 ? map_x : map_y) + 0.5f, distance;
+
+	if (direction[axis] == 0)
+		return (false);
+	distance = (plane - origin[axis]) / direction[axis];
+	if (distance < enter || distance > leave)
+		return (false);
+	layer->distance = distance * TILE_SIZE;
+	layer->hit_x = fmodf((origin[1 - axis] + direction[1 - axis] * distance) *
+			TILE_SIZE, TILE_SIZE);
+	layer->type = type;
+	layer->base = map_cell_top(game, map_x, map_y);
+	layer->clip = 0;
+	layer->light = lighting_at(game->lighting, map_x, map_y, LIGHT_TOP);
+	return (true);
+}
+
+/**
+ * layer_keep - Adds a layer to those of a column.
+ * @layers: CAST_MAX_LAYERS entries.
+ * @count: Pointer to the number of entries filled.
+ * @layer: Pointer to the RayLayer to add.
+ *
+ * Past the cap the layer is dropped, unless it is a thin wall, which
+ * replaces the last entry.
+ *
+ * Return: true if the layer is a thin wall, hiding everything behind it.
+ */
+static bool layer_keep(struct RayLayer *layers, int *count,
+		const struct RayLayer *layer)
+{
+	bool thin = layer->type == MAP_THIN_X || layer->type == MAP_THIN_Y;
+
+	if (*count < CAST_MAX_LAYERS)
+		layers[(*count)++] = *layer;
+	else if (thin)
+		layers[*count - 1] = *layer;
+	return (thin);
+}
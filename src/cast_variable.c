@@ -0,0 +1,142 @@
+#include "../inc/raycasting.h"
+
+static bool cast_span_agrees(const struct RayHit *a, const struct RayHit *b,
+		float gap);
+static void cast_hit_tile(const struct RayHit *hit, int *map_x, int *map_y);
+static void cast_on_face(const struct Player *viewer,
+		const struct RayHit *face, float ray_angle, struct RayHit *hit);
+
+/**
+ * cast_rays_variable - Casts a range of camera columns at a variable rate.
+ * @game: Pointer to the Game structure containing game state.
+ * @camera: Pointer to the Camera whose hits are filled.
+ * @first: First column to cast.
+ * @last: Column after the last one to cast.
+ * @step: Columns between two rays of the coarse pass, the quality knob:
+ *		1 casts every column.
+ *
+ * A coarse pass casts every @step-th column and the last one. Between two
+ * coarse columns that hit the same face of the same tile, the rays in
+ * between can only hit that face too, unless something stands in front
+ * of it; they are intersected with the face's line instead of being
+ * walked through the grid. Every other span is refined with full-rate
+ * casts. Like cast_rays(), disjoint ranges can be cast from several
+ * threads at once.
+ *
+ * Return: Number of rays walked through the grid.
+ */
+int cast_rays_variable(const struct Game *game, struct Camera *camera,
+		int first, int last, int step)
+{
+	float angle_step = FOV_RADIAN / (camera->viewport.w - 1);
+	struct RayHit *hits = camera->hits;
+	int start, end, column, cast = 1;
+	bool agrees;
+
+	cast_single_ray(game, camera->player,
+			(camera->angle_index + first) * angle_step, &hits[first]);
+	for (start = first; start < last - 1; start = end)
+	{
+		end = SDL_min(start + step, last - 1);
+		cast_single_ray(game, camera->player,
+				(camera->angle_index + end) * angle_step, &hits[end]);
+		cast++;
+		agrees = cast_span_agrees(&hits[start], &hits[end],
+				(end - start) * angle_step);
+		for (column = start + 1; column < end; column++)
+			if (agrees)
+				cast_on_face(camera->player, &hits[start],
+						(camera->angle_index + column) * angle_step, &hits[column]);
+			else
+			{
+				cast_single_ray(game, camera->player,
+						(camera->angle_index + column) * angle_step, &hits[column]);
+				cast++;
+			}
+	}
+	return (cast);
+}
+
+/**
+ * cast_span_agrees - Checks whether the columns between two coarse hits
+ *		can be taken from their face.
+ * @a: Pointer to the first coarse RayHit.
+ * @b: Pointer to the second coarse RayHit.
+ * @gap: Angle between the two rays.
+ *
+ * Both rays must hit the same side of the same tile, away from the tile's
+ * edges where a corner could show. The check is depth-aware: a tile in
+ * front of the face is at least TILE_SIZE / distance radians wide, so as
+ * long as that is more than @gap, one of the two rays would have hit it.
+ * Far enough away, a whole tile fits between the rays and the span is
+ * refined.
+ *
+ * Return: true if the span can be filled from the face, false otherwise.
+ */
+static bool cast_span_agrees(const struct RayHit *a, const struct RayHit *b,
+		float gap)
+{
+	int a_x, a_y, b_x, b_y;
+	float a_offset, b_offset;
+
+	if (a->is_vertical != b->is_vertical || isinf(a->distance) ||
+			isinf(b->distance) || fmaxf(a->distance, b->distance) * gap >=
+			TILE_SIZE)
+		return (false);
+	cast_hit_tile(a, &a_x, &a_y);
+	cast_hit_tile(b, &b_x, &b_y);
+	a_offset = fmodf(a->is_vertical ? a->end_y : a->end_x, TILE_SIZE);
+	b_offset = fmodf(b->is_vertical ? b->end_y : b->end_x, TILE_SIZE);
+	return (a_x == b_x && a_y == b_y &&
+			fminf(a_offset, b_offset) >= VARIABLE_RATE_EDGE &&
+			fmaxf(a_offset, b_offset) <= TILE_SIZE - VARIABLE_RATE_EDGE);
+}
+
+/**
+ * cast_hit_tile - Finds the wall tile a ray hit.
+ * @hit: Pointer to the RayHit, which hit a wall.
+ * @map_x: Pointer to store the tile column.
+ * @map_y: Pointer to store the tile row.
+ *
+ * The hit lies on the tile's edge; the ray's direction tells on which
+ * side of the edge the wall is, as in the casts.
+ */
+static void cast_hit_tile(const struct RayHit *hit, int *map_x, int *map_y)
+{
+	bool facing_down = hit->angle > 0 && hit->angle < PI;
+	bool facing_right = hit->angle < 0.5 * PI || hit->angle > 1.5 * PI;
+
+	*map_x = (int)((hit->end_x - (hit->is_vertical && !facing_right)) /
+			TILE_SIZE);
+	*map_y = (int)((hit->end_y - (!hit->is_vertical && !facing_down)) /
+			TILE_SIZE);
+}
+
+/**
+ * cast_on_face - Intersects a ray with the line of a face already hit.
+ * @viewer: Pointer to the Player the ray starts from.
+ * @face: Pointer to a RayHit on the face.
+ * @ray_angle: Angle of the ray.
+ * @hit: Pointer to the RayHit to fill.
+ */
+static void cast_on_face(const struct Player *viewer,
+		const struct RayHit *face, float ray_angle, struct RayHit *hit)
+{
+	ray_angle = fmodf(ray_angle, 2 * PI);
+	if (ray_angle < 0)
+		ray_angle += 2 * PI;
+	hit->angle = ray_angle;
+	hit->is_vertical = face->is_vertical;
+	if (face->is_vertical)
+	{
+		hit->end_x = face->end_x;
+		hit->end_y = viewer->y + (face->end_x - viewer->x) * tanf(ray_angle);
+	}
+	else
+	{
+		hit->end_y = face->end_y;
+		hit->end_x = viewer->x + (face->end_y - viewer->y) / tanf(ray_angle);
+	}
+	hit->distance = sqrtf((hit->end_x - viewer->x) * (hit->end_x - viewer->x)
+			+ (hit->end_y - viewer->y) * (hit->end_y - viewer->y));
+}
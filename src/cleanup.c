@@ -7,14 +7,31 @@
  */
 void game_cleanup(struct Game *game, int exit_status)
 {
+	net_client_destroy(game->client);
+	net_server_destroy(game->server);
+	audio_destroy(game->audio);
+	metrics_destroy(game->metrics);
+	capture_destroy(game->capture);
+	level_set_destroy(game);
 	SDL_DestroyTexture(game->pistol_texture);
 	SDL_DestroyTexture(game->shotgun_texture);
 	SDL_DestroyTexture(game->rifle_texture);
 	SDL_DestroyTexture(game->wall_texture);
 	SDL_DestroyTexture(game->sky_texture);
 	SDL_DestroyTexture(game->ground_texture);
+	SDL_DestroyTexture(game->grate_texture);
 	SDL_DestroyRenderer(game->renderer);
 	SDL_DestroyWindow(game->window);
+	job_pool_destroy(game->jobs);
+	fixed_tables_destroy(game->fixed);
+	render_batches_destroy(game->batches);
+	world_destroy(game->world);
+	pathfinder_destroy(game->pathfinder);
+	lighting_destroy(game->lighting);
+	fog_destroy(game->fog);
+	snapshot_destroy(game->snapshots);
+	arena_free(&game->frame_arena);
+	free(game->map);
 	IMG_Quit();
 	SDL_Quit();
 	exit(exit_status);
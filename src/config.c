@@ -0,0 +1,133 @@
+#include "../inc/constants.h"
+
+static bool config_int(const char *text, int min, int max, int *value);
+static bool config_float(const char *text, float min, float max,
+		float *value);
+
+struct Config config = {
+	.window_width = 1200,
+	.window_height = 500,
+	.fov_degrees = 60,
+	.tile_size = 128,
+	.player_speed = 200.0f,
+	.rotation_speed = 2.0f,
+	.fov = DEGREE_TO_RADIAN(60),
+	.fov_half = DEGREE_TO_RADIAN(60) / 2
+};
+
+static const char *const config_keys[] = {
+	"width", "height", "fov", "tile-size", "speed", "rotation-speed", NULL
+};
+
+/**
+ * config_set - Changes one setting.
+ * @settings: Pointer to the Config.
+ * @key: Name of the setting, as in the config file and without the
+ *		leading dashes of its command line flag.
+ * @value: Text of the new value.
+ *
+ * The window is between 320x200 and CONFIG_MAX_WIDTH x CONFIG_MAX_HEIGHT
+ * pixels, the field of view between 30 and 120 degrees and the tiles
+ * between 32 and 1024 units. The derived settings are left alone until
+ * config_derive() is called.
+ *
+ * Return: true if the key exists and the value is valid, false otherwise,
+ * leaving the setting unchanged.
+ */
+bool config_set(struct Config *settings, const char *key, const char *value)
+{
+	int number;
+
+	if (strcmp(key, "width") == 0)
+		return (config_int(value, 320, CONFIG_MAX_WIDTH,
+					&settings->window_width));
+	if (strcmp(key, "height") == 0)
+		return (config_int(value, 200, CONFIG_MAX_HEIGHT,
+					&settings->window_height));
+	if (strcmp(key, "fov") == 0)
+	{
+		if (!config_int(value, 30, 120, &number) || 360 % number != 0)
+			return (false);
+		settings->fov_degrees = number;
+		return (true);
+	}
+	if (strcmp(key, "tile-size") == 0)
+		return (config_int(value, 32, 1024, &settings->tile_size));
+	if (strcmp(key, "speed") == 0)
+		return (config_float(value, 1.0f, 100000.0f,
+					&settings->player_speed));
+	if (strcmp(key, "rotation-speed") == 0)
+		return (config_float(value, 0.01f, 100.0f,
+					&settings->rotation_speed));
+	return (false);
+}
+
+/**
+ * config_is_key - Checks whether a setting exists.
+ * @key: Name of the setting.
+ *
+ * Return: true if config_set() knows the key, false otherwise.
+ */
+bool config_is_key(const char *key)
+{
+	int i;
+
+	for (i = 0; config_keys[i]; i++)
+		if (strcmp(key, config_keys[i]) == 0)
+			return (true);
+	return (false);
+}
+
+/**
+ * config_derive - Computes the settings that follow from the others.
+ * @settings: Pointer to the Config, its settings all set.
+ *
+ * Called once the config file and command line are read, so the angles
+ * are worked out once rather than wherever they are used.
+ */
+void config_derive(struct Config *settings)
+{
+	settings->fov = DEGREE_TO_RADIAN(settings->fov_degrees);
+	settings->fov_half = settings->fov / 2;
+}
+
+/**
+ * config_int - Parses an integer setting.
+ * @text: Value text.
+ * @min: Smallest valid value.
+ * @max: Largest valid value.
+ * @value: Pointer to store the value, untouched on failure.
+ *
+ * Return: true if the whole text is an integer within [min, max].
+ */
+static bool config_int(const char *text, int min, int max, int *value)
+{
+	char *end;
+	long number = strtol(text, &end, 10);
+
+	if (end == text || *end != '\0' || number < min || number > max)
+		return (false);
+	*value = (int)number;
+	return (true);
+}
+
+/**
+ * config_float - Parses a real setting.
+ * @text: Value text.
+ * @min: Smallest valid value.
+ * @max: Largest valid value.
+ * @value: Pointer to store the value, untouched on failure.
+ *
+ * Return: true if the whole text is a number within [min, max].
+ */
+static bool config_float(const char *text, float min, float max,
+		float *value)
+{
+	char *end;
+	float number = strtof(text, &end);
+
+	if (end == text || *end != '\0' || !(number >= min && number <= max))
+		return (false);
+	*value = number;
+	return (true);
+}
@@ -0,0 +1,41 @@
+#include "../inc/constants.h"
+
+/**
+ * config_load - Reads settings from a config file.
+ * @settings: Pointer to the Config to change.
+ * @path: Path to the file.
+ *
+ * Every non-empty line not starting with '#' is one "key = value"
+ * setting, the keys being those of config_set(). Settings the file does
+ * not mention keep their value.
+ *
+ * Return: true if every line is a valid setting, false otherwise.
+ */
+bool config_load(struct Config *settings, const char *path)
+{
+	char *line = NULL, key[CONFIG_FIELD_SIZE], value[CONFIG_FIELD_SIZE];
+	char extra;
+	size_t line_capacity = 0;
+	int fields, number = 0;
+	bool ok = true;
+	FILE *file = fopen(path, "r");
+
+	if (!file)
+	{
+		fprintf(stderr, "Error opening config file: %s\n", path);
+		return (false);
+	}
+	while (ok && getline(&line, &line_capacity, file) != -1)
+	{
+		number++;
+		fields = sscanf(line, CONFIG_LINE_FORMAT, key, value, &extra);
+		if (fields < 1)
+			continue;
+		ok = fields == 2 && config_set(settings, key, value);
+	}
+	free(line);
+	fclose(file);
+	if (!ok)
+		fprintf(stderr, "Invalid setting in %s, line %d\n", path, number);
+	return (ok);
+}
@@ -1,4 +1,4 @@
-#include "../inc/rendering.h"
+#include "../inc/game.h"
 
 /**
  * calculate_texture_rect - Calculate the SDL_Rect for the texture
@@ -27,68 +27,109 @@ SDL_Rect calculate_texture_rect(int texture_width,
 }
 
 /**
- * apply_shading - Apply shading to the texture based on distance
- * @texture: Pointer to the SDL_Texture
+ * shade_level - Compute the shading of a strip based on distance
  * @corrected_distance: Corrected distance for shading calculation
+ * @light: Light level of the face drawn, 255 for full brightness
+ *
+ * Return: Level the texture color is scaled by, 255 for full brightness
  */
-void apply_shading(SDL_Texture *texture, float corrected_distance)
+Uint8 shade_level(float corrected_distance, int light)
 {
-	float shade_factor = 1.0 - (corrected_distance / (MAP_WIDTH * TILE_SIZE));
+	float shade_factor = 1.0 - (corrected_distance / SHADE_DISTANCE);
 
 	shade_factor = fmaxf(0.3f, shade_factor);
 	if (shade_factor > 1)
 		shade_factor = 1;
+	shade_factor *= light / 255.0f;
 
-	SDL_SetTextureColorMod(texture, (Uint8)(255 * shade_factor),
-			(Uint8)(255 * shade_factor), (Uint8)(255 * shade_factor));
+	return ((Uint8)(255 * shade_factor));
 }
 
+#define COLUMN_TILE TILE_SIZE
+#define COLUMN_WORDS ((camera->viewport.h + 63) / 64)
+#define COLUMN_NAME draw_3d_view
+#define COLUMN_LINKAGE
+#define COLUMN_WRAP(position) fmod(position, TILE_SIZE)
+#include "../inc/column_kernel.h"
+
+#define COLUMN_TILE 128
+#define COLUMN_WORDS 8
+#define COLUMN_NAME draw_3d_view_128_512
+#define COLUMN_LINKAGE static
+#include "../inc/column_kernel.h"
+
+#define COLUMN_TILE 128
+#define COLUMN_WORDS 12
+#define COLUMN_NAME draw_3d_view_128_768
+#define COLUMN_LINKAGE static
+#include "../inc/column_kernel.h"
+
+#define COLUMN_TILE 128
+#define COLUMN_WORDS 17
+#define COLUMN_NAME draw_3d_view_128_1088
+#define COLUMN_LINKAGE static
+#include "../inc/column_kernel.h"
+
+#define COLUMN_TILE 64
+#define COLUMN_WORDS 8
+#define COLUMN_NAME draw_3d_view_64_512
+#define COLUMN_LINKAGE static
+#include "../inc/column_kernel.h"
+
+#define COLUMN_TILE 64
+#define COLUMN_WORDS 12
+#define COLUMN_NAME draw_3d_view_64_768
+#define COLUMN_LINKAGE static
+#include "../inc/column_kernel.h"
+
+#define COLUMN_TILE 64
+#define COLUMN_WORDS 17
+#define COLUMN_NAME draw_3d_view_64_1088
+#define COLUMN_LINKAGE static
+#include "../inc/column_kernel.h"
+
+#define COLUMN_TILE 256
+#define COLUMN_WORDS 8
+#define COLUMN_NAME draw_3d_view_256_512
+#define COLUMN_LINKAGE static
+#include "../inc/column_kernel.h"
+
+#define COLUMN_TILE 256
+#define COLUMN_WORDS 12
+#define COLUMN_NAME draw_3d_view_256_768
+#define COLUMN_LINKAGE static
+#include "../inc/column_kernel.h"
+
+#define COLUMN_TILE 256
+#define COLUMN_WORDS 17
+#define COLUMN_NAME draw_3d_view_256_1088
+#define COLUMN_LINKAGE static
+#include "../inc/column_kernel.h"
+
 /**
- * draw_3d_view - Render the 3D view for the game
- * @game: Pointer to the Game structure
- * @ray_angle: Angle of the current ray
- * @distance: Distance from the player to the wall
- * @ray_index: Index of the current ray
- * @is_vertical: Flag indicating if the hit was vertical
+ * column_kernel - Picks the column renderer of a view.
+ * @view_height: Height of the view, in pixels.
+ *
+ * Instances exist for tiles of 64, 128 and 256 units and views up to 512,
+ * 768 and 1088 rows high, covering 480p to 1080p; each view uses the
+ * smallest one it fits.
+ *
+ * Return: The instance built for TILE_SIZE and @view_height, or the
+ * generic draw_3d_view() when there is none.
  */
-void draw_3d_view(struct Game *game, float ray_angle, float distance,
-		int ray_index, int is_vertical)
+ColumnKernel column_kernel(int view_height)
 {
-	float step, texture_y_start, hit_x;
-	float corrected_distance = calculate_corrected_distance(distance, ray_angle,
-			game->player.angle);
-	float line_height = calculate_line_height(corrected_distance);
-	float line_offset = calculate_line_offset(line_height);
-	int texture_width, texture_height;
-	SDL_Rect wall_strip, texture_rect;
-	SDL_Rect ground_rect = {
-		.x = ray_index * (WINDOW_WIDTH / NUM_RAYS),
-		.y = WINDOW_HEIGHT / 2,
-		.w = WINDOW_WIDTH / NUM_RAYS,
-		.h = WINDOW_HEIGHT / 2
+	static const ColumnKernel kernels[][3] = {
+		{draw_3d_view_64_512, draw_3d_view_64_768, draw_3d_view_64_1088},
+		{draw_3d_view_128_512, draw_3d_view_128_768, draw_3d_view_128_1088},
+		{draw_3d_view_256_512, draw_3d_view_256_768, draw_3d_view_256_1088}
 	};
+	int tile = TILE_SIZE == 64 ? 0 : TILE_SIZE == 128 ? 1 :
+		TILE_SIZE == 256 ? 2 : -1;
+	int rows = view_height <= 512 ? 0 : view_height <= 768 ? 1 :
+		view_height <= 1088 ? 2 : -1;
 
-	SDL_QueryTexture(game->wall_texture, NULL, NULL,
-			&texture_width, &texture_height);
-	step = (float)texture_height / line_height;
-	texture_y_start = 0;
-	if (line_offset < 0)
-	{
-		texture_y_start = -line_offset * step;
-		line_offset = 0;
-	}
-	if (line_height > WINDOW_HEIGHT)
-		line_height = WINDOW_HEIGHT;
-
-	wall_strip = setup_wall_strip(ray_index, line_offset, line_height);
-	hit_x = is_vertical ? fmod(game->player.y + distance * sin(ray_angle),
-			TILE_SIZE)
-		: fmod(game->player.x + distance * cos(ray_angle), TILE_SIZE);
-	texture_rect = calculate_texture_rect(texture_width,
-			hit_x, texture_y_start, line_height, step);
-
-	SDL_RenderCopy(game->renderer, game->ground_texture, NULL, &ground_rect);
-	apply_shading(game->wall_texture, corrected_distance);
-	SDL_RenderCopy(game->renderer, game->wall_texture,
-			&texture_rect, &wall_strip);
+	if (tile < 0 || rows < 0)
+		return (draw_3d_view);
+	return (kernels[tile][rows]);
 }
@@ -1,33 +1,76 @@
-#include "../inc/map.h"
+#include "../inc/game.h"
+
+static int minimap_first_tile(float position, int extent);
 
 /**
  * draw_2d_map - Draws the 2D map including background,
- *		tiles, player, and FOV rays.
+ *		tiles, players, and FOV rays.
  * @game: Pointer to the Game structure.
+ * @camera: Pointer to the Camera whose viewport the map is drawn in.
+ *
+ * Maps larger than MINIMAP_TILES are shown through a window that follows
+ * the camera's player; everything is clipped to the minimap square.
+ * Only the tiles some player has seen are drawn.
+ * Players of other games in sight are drawn with the local ones.
  */
-void draw_2d_map(struct Game *game)
+void draw_2d_map(struct Game *game, const struct Camera *camera)
 {
-	int player_size, player_x, player_y;
-	int map_size = WINDOW_HEIGHT / 4;
-	int tile_size = map_size / MAP_HEIGHT;
-	int map_x = WINDOW_WIDTH - map_size;
-	int map_y = WINDOW_HEIGHT - map_size;
+	const struct Player *viewer = camera->player, *player;
+	int player_size, player_x, player_y, i;
+	int map_size = camera->viewport.h / 4;
+	int tile_size = map_size / MINIMAP_TILES;
+	int map_x = camera->viewport.w - map_size;
+	int map_y = camera->viewport.h - map_size;
+	SDL_Rect clip_rect = {map_x, map_y, map_size, map_size};
 
 	draw_map_background(game, map_x, map_y, map_size);
-	draw_map_tiles(game, map_x, map_y, tile_size);
+	map_x -= minimap_first_tile(viewer->x, game->map_width) * tile_size;
+	map_y -= minimap_first_tile(viewer->y, game->map_height) * tile_size;
+	SDL_RenderSetClipRect(game->renderer, &clip_rect);
+	draw_map_tiles(game, viewer, map_x, map_y, tile_size);
 
 	player_size = tile_size / 4;
-	player_x = (map_x + (game->player.x * tile_size / TILE_SIZE)
+	for (i = 0; i < game->player_count + game->remote_count; i++)
+	{
+		player = i < game->player_count ? &game->players[i] :
+			&game->remote[i - game->player_count];
+		player_x = (map_x + (player->x * tile_size / TILE_SIZE)
+			- player_size / 2);
+		player_y = (map_y + (player->y * tile_size / TILE_SIZE)
+			- player_size / 2);
+		draw_player(game, player_x, player_y, player_size, player == viewer);
+	}
+	player_x = (map_x + (viewer->x * tile_size / TILE_SIZE)
 		- player_size / 2);
-	player_y = (map_y + (game->player.y * tile_size / TILE_SIZE)
+	player_y = (map_y + (viewer->y * tile_size / TILE_SIZE)
 		- player_size / 2);
+	draw_fov_rays(game, viewer, map_x, map_y, tile_size, player_x, player_y,
+			player_size);
+	SDL_RenderSetClipRect(game->renderer, NULL);
+}
+
+/**
+ * minimap_first_tile - Computes the first tile shown by the minimap window.
+ * @position: Player coordinate along one axis, in world units.
+ * @extent: Map size along the same axis, in tiles.
+ *
+ * Return: Index of the first visible tile along that axis.
+ */
+static int minimap_first_tile(float position, int extent)
+{
+	int first = (int)(position / TILE_SIZE) - MINIMAP_TILES / 2;
+	int last = extent - MINIMAP_TILES;
 
-	draw_player(game, player_x, player_y, player_size);
-	draw_fov_rays(game, map_x, map_y, tile_size, player_x, player_y, player_size);
+	if (first > last)
+		first = last;
+	if (first < 0)
+		first = 0;
+	return (first);
 }
 
 /**
- * draw_map_background - Draws the background of the map.
+ * draw_map_background - Draws the background of the map, which is what
+ *		unexplored tiles look like.
  * @game: Pointer to the Game structure.
  * @map_x: X-coordinate of the map's top-left corner.
  * @map_y: Y-coordinate of the map's top-left corner.
@@ -37,109 +80,72 @@ void draw_map_background(struct Game *game, int map_x, int map_y, int map_size)
 {
 	SDL_Rect map_rect = {map_x, map_y, map_size, map_size};
 
-	SDL_SetRenderDrawColor(game->renderer, 100, 100, 100, 128);
+	SDL_SetRenderDrawColor(game->renderer, 30, 30, 30, 160);
 	SDL_RenderFillRect(game->renderer, &map_rect);
 }
 
 /**
- * draw_map_tiles - Draws the tiles of the map based on the game's map data.
+ * draw_map_tiles - Draws the tiles of the map the players have explored.
  * @game: Pointer to the Game structure.
+ * @viewer: Pointer to the Player the minimap follows.
  * @map_x: X-coordinate of the map's top-left corner.
  * @map_y: Y-coordinate of the map's top-left corner.
  * @tile_size: Size of each tile in pixels.
+ *
+ * Only the MINIMAP_TILES x MINIMAP_TILES window around the viewer is
+ * drawn, scaled from the fog's texture; worlds and maps too large for a
+ * texture are drawn a tile at a time instead.
  */
-void draw_map_tiles(struct Game *game, int map_x, int map_y, int tile_size)
+void draw_map_tiles(struct Game *game, const struct Player *viewer,
+		int map_x, int map_y, int tile_size)
 {
 	int y, x;
-	SDL_Rect *wall_rect = &(SDL_Rect){0};
+	int first_x = minimap_first_tile(viewer->x, game->map_width);
+	int first_y = minimap_first_tile(viewer->y, game->map_height);
+	int width = SDL_min(game->map_width, MINIMAP_TILES);
+	int height = SDL_min(game->map_height, MINIMAP_TILES);
+	SDL_Rect *tile_rect = &(SDL_Rect){0};
+	Uint32 pixel;
 
-	for (y = 0; y < MAP_HEIGHT; y++)
+	fog_update_texture(game);
+	if (game->fog->texture)
 	{
-		for (x = 0; x < MAP_WIDTH; x++)
+		*tile_rect = (SDL_Rect){map_x + first_x * tile_size,
+			map_y + first_y * tile_size, width * tile_size,
+			height * tile_size};
+		SDL_RenderCopy(game->renderer, game->fog->texture,
+				&(SDL_Rect){first_x, first_y, width, height}, tile_rect);
+		return;
+	}
+	for (y = first_y; y < first_y + height; y++)
+		for (x = first_x; x < first_x + width; x++)
 		{
-			if (game->map[y * MAP_WIDTH + x] == MAP_WALL)
-			{
-				*wall_rect = (SDL_Rect){
-					map_x + x * tile_size,
-					map_y + y * tile_size,
-					tile_size,
-					tile_size
-				};
-				SDL_SetRenderDrawColor(game->renderer, 200, 200, 200, 255);
-				SDL_RenderFillRect(game->renderer, wall_rect);
-			}
+			if (!fog_explored(game->fog, x, y))
+				continue;
+			pixel = map_cell(game, x, y) == MAP_FLOOR ? FOG_FLOOR_PIXEL :
+				FOG_WALL_PIXEL;
+			*tile_rect = (SDL_Rect){map_x + x * tile_size,
+				map_y + y * tile_size, tile_size, tile_size};
+			SDL_SetRenderDrawColor(game->renderer, pixel >> 16 & 0xff,
+					pixel >> 8 & 0xff, pixel & 0xff, pixel >> 24);
+			SDL_RenderFillRect(game->renderer, tile_rect);
 		}
-	}
 }
 
 /**
- * draw_player - Draws the player on the 2D map.
+ * draw_player - Draws a player on the 2D map.
  * @game: Pointer to the Game structure.
  * @player_x: X-coordinate of the player's center.
  * @player_y: Y-coordinate of the player's center.
  * @player_size: Size of the player in pixels.
+ * @is_viewer: true for the player the minimap follows, drawn in red;
+ *		the other players are drawn in yellow.
  */
 void draw_player(struct Game *game, int player_x,
-		int player_y, int player_size)
+		int player_y, int player_size, bool is_viewer)
 {
 	SDL_Rect player_rect = {player_x, player_y, player_size, player_size};
 
-	SDL_SetRenderDrawColor(game->renderer, 255, 0, 0, 255);
+	SDL_SetRenderDrawColor(game->renderer, 255, is_viewer ? 0 : 255, 0, 255);
 	SDL_RenderFillRect(game->renderer, &player_rect);
 }
-
-/**
- * draw_fov_rays - Draws the FOV (Field of View) rays
- *		from the player's perspective.
- * @game: Pointer to the Game structure.
- * @map_x: X-coordinate of the map's top-left corner.
- * @map_y: Y-coordinate of the map's top-left corner.
- * @tile_size: Size of each tile in pixels.
- * @player_x: X-coordinate of the player's center.
- * @player_y: Y-coordinate of the player's center.
- * @player_size: Size of the player in pixels.
- */
-void draw_fov_rays(struct Game *game, int map_x, int map_y, int tile_size,
-		int player_x, int player_y, int player_size)
-{
-	float ray_angle, end_x, end_y, ray_dx, ray_dy, ray_distance, step_x;
-	float step_y, ray_x, ray_y;
-	float ray_length = tile_size * 3;
-	float angle_step = DEGREE_TO_RADIAN(FOV_DEGREES) / 19;
-	int i, map_x_check, map_y_check, ray_end_x, ray_end_y;
-
-	SDL_SetRenderDrawColor(game->renderer, 0, 255, 0, 255);
-	for (i = -11; i <= 11; i++)
-	{
-		if (i == 0)
-			continue;
-		ray_angle = game->player.angle + i * angle_step;
-		end_x = game->player.x + cosf(ray_angle) * ray_length;
-		end_y = game->player.y + sinf(ray_angle) * ray_length;
-		ray_dx = end_x - game->player.x;
-		ray_dy = end_y - game->player.y;
-		ray_distance = sqrt(ray_dx * ray_dx + ray_dy * ray_dy);
-		step_x = ray_dx / ray_distance;
-		step_y = ray_dy / ray_distance;
-		ray_x = game->player.x;
-		ray_y = game->player.y;
-
-		while (ray_x >= 0 && ray_x < MAP_WIDTH * TILE_SIZE &&
-				ray_y >= 0 && ray_y < MAP_HEIGHT * TILE_SIZE)
-		{
-			map_x_check = (int)(ray_x / TILE_SIZE);
-			map_y_check = (int)(ray_y / TILE_SIZE);
-			if (game->map[map_y_check * MAP_WIDTH + map_x_check] == MAP_WALL)
-				break;
-			ray_x += step_x;
-			ray_y += step_y;
-		}
-		ray_end_x = map_x + (ray_x * tile_size / TILE_SIZE);
-		ray_end_y = map_y + (ray_y * tile_size / TILE_SIZE);
-		SDL_RenderDrawLine(game->renderer,
-				player_x + player_size / 2,
-				player_y + player_size / 2,
-				ray_end_x,
-				ray_end_y);
-	}
-}
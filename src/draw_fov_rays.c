@@ -0,0 +1,58 @@
+#include "../inc/game.h"
+
+/**
+ * draw_fov_rays - Draws the FOV (Field of View) rays
+ *		from the player's perspective.
+ * @game: Pointer to the Game structure.
+ * @viewer: Pointer to the Player the rays start from.
+ * @map_x: X-coordinate of the map's top-left corner.
+ * @map_y: Y-coordinate of the map's top-left corner.
+ * @tile_size: Size of each tile in pixels.
+ * @player_x: X-coordinate of the player's center.
+ * @player_y: Y-coordinate of the player's center.
+ * @player_size: Size of the player in pixels.
+ */
+void draw_fov_rays(struct Game *game, const struct Player *viewer, int map_x,
+		int map_y, int tile_size, int player_x, int player_y, int player_size)
+{
+	float ray_angle, end_x, end_y, ray_dx, ray_dy, ray_distance, step_x;
+	float step_y, ray_x, ray_y;
+	float ray_length = tile_size * 3;
+	float angle_step = FOV_RADIAN / 19;
+	int i, map_x_check, map_y_check, ray_end_x, ray_end_y;
+
+	SDL_SetRenderDrawColor(game->renderer, 0, 255, 0, 255);
+	for (i = -11; i <= 11; i++)
+	{
+		if (i == 0)
+			continue;
+		ray_angle = viewer->angle + i * angle_step;
+		end_x = viewer->x + cosf(ray_angle) * ray_length;
+		end_y = viewer->y + sinf(ray_angle) * ray_length;
+		ray_dx = end_x - viewer->x;
+		ray_dy = end_y - viewer->y;
+		ray_distance = sqrt(ray_dx * ray_dx + ray_dy * ray_dy);
+		step_x = ray_dx / ray_distance;
+		step_y = ray_dy / ray_distance;
+		ray_x = viewer->x;
+		ray_y = viewer->y;
+
+		while (ray_x >= 0 && ray_x < game->map_width * TILE_SIZE &&
+				ray_y >= 0 && ray_y < game->map_height * TILE_SIZE)
+		{
+			map_x_check = (int)(ray_x / TILE_SIZE);
+			map_y_check = (int)(ray_y / TILE_SIZE);
+			if (map_cell(game, map_x_check, map_y_check) == MAP_WALL)
+				break;
+			ray_x += step_x;
+			ray_y += step_y;
+		}
+		ray_end_x = map_x + (ray_x * tile_size / TILE_SIZE);
+		ray_end_y = map_y + (ray_y * tile_size / TILE_SIZE);
+		SDL_RenderDrawLine(game->renderer,
+				player_x + player_size / 2,
+				player_y + player_size / 2,
+				ray_end_x,
+				ray_end_y);
+	}
+}
@@ -0,0 +1,184 @@
+#include "../inc/game.h"
+
+/**
+ * struct HeightWalk - A column's ray walking the grid cell by cell
+ * @x: start of the ray, in tiles
+ * @y: start of the ray, in tiles
+ * @dir_x: unit direction of the ray
+ * @dir_y: unit direction of the ray
+ * @delta_x: distance between two vertical grid lines along the ray
+ * @delta_y: distance between two horizontal grid lines along the ray
+ * @side_x: distance to the next vertical grid line
+ * @side_y: distance to the next horizontal grid line
+ * @map_x: tile column of the current cell
+ * @map_y: tile row of the current cell
+ * @is_vertical: the last step crossed a vertical grid line
+ * @distance: distance of the last grid line crossed, in tiles
+ */
+struct HeightWalk
+{
+	float x;
+	float y;
+	float dir_x;
+	float dir_y;
+	float delta_x;
+	float delta_y;
+	float side_x;
+	float side_y;
+	int map_x;
+	int map_y;
+	int is_vertical;
+	float distance;
+};
+
+static void height_walk_start(struct HeightWalk *walk,
+		const struct Player *player, float angle);
+static void height_walk_step(struct HeightWalk *walk);
+static void draw_height_face(struct Game *game, struct ColumnSpan *span,
+		const struct HeightWalk *walk, int bottom, int top);
+static void draw_height_layer(struct Game *game, struct ColumnSpan *span,
+		const struct RayLayer *last, int surface, int surface_light);
+
+/**
+ * draw_height_column - Draws one column of a map with cell heights.
+ * @game: Pointer to the Game structure.
+ * @camera: Pointer to the Camera, its viewport already set on the renderer.
+ * @span: Pointer to the column's ColumnSpan, every row still open.
+ *
+ * The column's ray walks the grid cell by cell, nearest first. Where the
+ * height of the cells changes, the surface left behind is drawn, then the
+ * face rising to a taller cell; the span keeps every row from being drawn
+ * twice. Short walls and steps do not stop the ray: it ends at a cell
+ * tall enough to hide everything behind it, at a thin wall, when the
+ * column is full, or at the map edge. Every see-through layer passed on
+ * the way records the rows nearer geometry hides from it. A surface also
+ * ends where the light level of its tiles changes.
+ */
+void draw_height_column(struct Game *game, const struct Camera *camera,
+		struct ColumnSpan *span)
+{
+	const struct RayHit *hit = &camera->hits[span->column];
+	struct RayLayer *layers = hit->layer_count ?
+		camera->layers + span->column * CAST_MAX_LAYERS : NULL;
+	const struct RayLayer *last = layers ? &layers[hit->layer_count - 1] : NULL;
+	float limit = last && (last->type == MAP_THIN_X ||
+			last->type == MAP_THIN_Y) ? last->distance : HUGE_VALF;
+	struct HeightWalk walk;
+	int passed = 0, top, light, surface, surface_light, inside = true;
+
+	height_walk_start(&walk, camera->player, hit->angle);
+	surface = map_cell_top(game, walk.map_x, walk.map_y);
+	surface_light = lighting_at(game->lighting, walk.map_x, walk.map_y,
+			LIGHT_TOP);
+	while (inside && span->bottom > 0)
+	{
+		height_walk_step(&walk);
+		while (passed < hit->layer_count &&
+				layers[passed].distance <= walk.distance * TILE_SIZE)
+			layers[passed++].clip = span->bottom;
+		if (walk.distance * TILE_SIZE >= limit)
+		{
+			draw_height_layer(game, span, last, surface, surface_light);
+			break;
+		}
+		inside = map_in_bounds(game, walk.map_x, walk.map_y);
+		top = map_cell_top(game, walk.map_x, walk.map_y);
+		light = lighting_at(game->lighting, walk.map_x, walk.map_y, LIGHT_TOP);
+		if (top == surface && light == surface_light && inside)
+			continue;
+		draw_span_surface(game, span, surface,
+				walk.distance * TILE_SIZE * span->cosine, surface_light);
+		if (top > surface)
+			draw_height_face(game, span, &walk, surface, top);
+		if (top >= game->map_max_top && top >= span->eye)
+			break;
+		surface = top;
+		surface_light = light;
+	}
+}
+
+/**
+ * height_walk_start - Starts a ray from a player's cell.
+ * @walk: Pointer to the HeightWalk to fill.
+ * @player: Pointer to the Player the ray starts from.
+ * @angle: Angle of the ray.
+ */
+static void height_walk_start(struct HeightWalk *walk,
+		const struct Player *player, float angle)
+{
+	walk->x = player->x / TILE_SIZE;
+	walk->y = player->y / TILE_SIZE;
+	walk->dir_x = cosf(angle);
+	walk->dir_y = sinf(angle);
+	walk->delta_x = walk->dir_x ? fabsf(1 / walk->dir_x) : HUGE_VALF;
+	walk->delta_y = walk->dir_y ? fabsf(1 / walk->dir_y) : HUGE_VALF;
+	walk->map_x = (int)walk->x;
+	walk->map_y = (int)walk->y;
+	walk->side_x = walk->dir_x ? (walk->dir_x < 0 ? walk->x - walk->map_x :
+			walk->map_x + 1 - walk->x) * walk->delta_x : HUGE_VALF;
+	walk->side_y = walk->dir_y ? (walk->dir_y < 0 ? walk->y - walk->map_y :
+			walk->map_y + 1 - walk->y) * walk->delta_y : HUGE_VALF;
+}
+
+/**
+ * height_walk_step - Moves a ray into the next cell it crosses.
+ * @walk: Pointer to the HeightWalk.
+ */
+static void height_walk_step(struct HeightWalk *walk)
+{
+	walk->is_vertical = walk->side_x < walk->side_y;
+	walk->distance = walk->is_vertical ? walk->side_x : walk->side_y;
+	if (walk->is_vertical)
+	{
+		walk->side_x += walk->delta_x;
+		walk->map_x += walk->dir_x < 0 ? -1 : 1;
+	}
+	else
+	{
+		walk->side_y += walk->delta_y;
+		walk->map_y += walk->dir_y < 0 ? -1 : 1;
+	}
+}
+
+/**
+ * draw_height_face - Draws the face rising to the cell a ray entered.
+ * @game: Pointer to the Game structure.
+ * @span: Pointer to the column's ColumnSpan.
+ * @walk: Pointer to the HeightWalk, just stepped into the taller cell.
+ * @bottom: Height of the cell left, in world units.
+ * @top: Height of the cell entered, in world units.
+ *
+ * The face is lit from the side of the cell the ray came from.
+ */
+static void draw_height_face(struct Game *game, struct ColumnSpan *span,
+		const struct HeightWalk *walk, int bottom, int top)
+{
+	float across = walk->is_vertical ? walk->y + walk->dir_y *
+		walk->distance : walk->x + walk->dir_x * walk->distance;
+	int side = walk->is_vertical ?
+		(walk->dir_x < 0 ? LIGHT_EAST : LIGHT_WEST) :
+		(walk->dir_y < 0 ? LIGHT_SOUTH : LIGHT_NORTH);
+
+	draw_span_face(game, span, bottom, top,
+			walk->distance * TILE_SIZE * span->cosine,
+			fmodf(across * TILE_SIZE, TILE_SIZE),
+			lighting_at(game->lighting, walk->map_x, walk->map_y, side));
+}
+
+/**
+ * draw_height_layer - Ends a column on the thin wall that hides the rest.
+ * @game: Pointer to the Game structure.
+ * @span: Pointer to the column's ColumnSpan.
+ * @last: Pointer to the RayLayer of the thin wall.
+ * @surface: Height of the surface up to the wall, in world units.
+ * @surface_light: Light level of that surface.
+ */
+static void draw_height_layer(struct Game *game, struct ColumnSpan *span,
+		const struct RayLayer *last, int surface, int surface_light)
+{
+	draw_span_surface(game, span, surface, last->distance * span->cosine,
+			surface_light);
+	if (last->base + TILE_SIZE > surface)
+		draw_span_face(game, span, surface, last->base + TILE_SIZE,
+				last->distance * span->cosine, last->hit_x, last->light);
+}
@@ -0,0 +1,136 @@
+#include "../inc/game.h"
+
+/**
+ * draw_span_surface - Draws the open part of a horizontal surface.
+ * @game: Pointer to the Game structure.
+ * @span: Pointer to the column's ColumnSpan.
+ * @top: Height of the surface, in world units.
+ * @depth: Depth where the surface ends, in world units.
+ * @light: Light level of the surface, 255 for full brightness.
+ *
+ * Seen from above, a surface covers every open row from its far edge
+ * down to the span bottom; nearer parts were either drawn already or are
+ * hidden. The ground texture is laid on rows the way a flat floor is,
+ * lit by the one light level given for the whole strip.
+ */
+void draw_span_surface(struct Game *game, struct ColumnSpan *span, int top,
+		float depth, int light)
+{
+	int first = span_row(span, top, depth), texture_width, texture_height;
+	float scale;
+	SDL_Rect source;
+
+	if (top >= span->eye || first >= span->bottom)
+		return;
+	if (first < 0)
+		first = 0;
+	SDL_QueryTexture(game->ground_texture, NULL, NULL,
+			&texture_width, &texture_height);
+	scale = texture_height / span->horizon;
+	source = (SDL_Rect){0, (int)((first - span->horizon) * scale),
+		texture_width, (int)((span->bottom - first) * scale)};
+	if (source.h < 1)
+		source.h = 1;
+	span_write(game, span, game->ground_texture, &source, first, light);
+}
+
+/**
+ * draw_span_face - Draws the open part of a vertical wall face.
+ * @game: Pointer to the Game structure.
+ * @span: Pointer to the column's ColumnSpan.
+ * @bottom: Height of the lowest visible point of the face, in world units.
+ * @top: Height of the top of the face, in world units.
+ * @depth: Depth of the face, in world units.
+ * @hit_x: Position of the ray hit along the face, in world units.
+ * @light: Light level of the face, 255 for full brightness.
+ *
+ * The wall texture repeats every TILE_SIZE of height, so the face is
+ * drawn in tile-high bands from the bottom up; each band only fills rows
+ * that are still open.
+ */
+void draw_span_face(struct Game *game, struct ColumnSpan *span, int bottom,
+		int top, float depth, float hit_x, int light)
+{
+	int band, band_bottom, band_top, first, last;
+	int texture_width, texture_height;
+	float step, texture_y;
+	Uint8 shade = shade_level(depth, light);
+	SDL_Rect source;
+
+	SDL_QueryTexture(game->wall_texture, NULL, NULL,
+			&texture_width, &texture_height);
+	step = texture_height * depth / (TILE_SIZE * span->projection);
+	for (band = bottom / TILE_SIZE * TILE_SIZE; band < top && span->bottom > 0;
+			band += TILE_SIZE)
+	{
+		band_bottom = bottom > band ? bottom : band;
+		band_top = top < band + TILE_SIZE ? top : band + TILE_SIZE;
+		first = span_row(span, band_top, depth);
+		last = span_row(span, band_bottom, depth);
+		if (last > span->bottom)
+			last = span->bottom;
+		texture_y = (float)(band + TILE_SIZE - band_top) * texture_height /
+			TILE_SIZE;
+		if (first < 0)
+		{
+			texture_y -= first * step;
+			first = 0;
+		}
+		if (first >= last)
+			continue;
+		source = calculate_texture_rect(texture_width, hit_x, texture_y,
+				last - first, step);
+		if (source.h < 1)
+			source.h = 1;
+		span_write(game, span, game->wall_texture, &source, first, shade);
+	}
+}
+
+/**
+ * draw_span_layers - Blends the grates of a column over what is drawn.
+ * @game: Pointer to the Game structure.
+ * @span: Pointer to the column's ColumnSpan, its opaque geometry drawn.
+ * @layers: The column's layers, nearest first, their clip rows set.
+ * @count: Number of layers.
+ *
+ * Grates are drawn back to front, each clipped to the rows nearer
+ * geometry leaves visible, so nearer grates blend over farther ones. A
+ * thin wall is always the farthest layer and was drawn as the column's
+ * wall.
+ */
+void draw_span_layers(struct Game *game, struct ColumnSpan *span,
+		const struct RayLayer *layers, int count)
+{
+	const struct RayLayer *layer;
+	int first, last;
+	float depth, step, texture_y;
+	SDL_Rect source, strip;
+
+	if (count <= 0)
+		return;
+	for (layer = layers + count - 1; layer >= layers; layer--)
+	{
+		if (layer->type == MAP_THIN_X || layer->type == MAP_THIN_Y)
+			continue;
+		depth = layer->distance * span->cosine;
+		step = GRATE_TEXTURE_SIZE * depth / (TILE_SIZE * span->projection);
+		first = span_row(span, layer->base + TILE_SIZE, depth);
+		last = span_row(span, layer->base, depth);
+		if (last > layer->clip)
+			last = layer->clip;
+		texture_y = first < 0 ? -first * step : 0;
+		if (first < 0)
+			first = 0;
+		if (first >= last)
+			continue;
+		source = calculate_texture_rect(GRATE_TEXTURE_SIZE, layer->hit_x,
+				texture_y, last - first, step);
+		if (source.h < 1)
+			source.h = 1;
+		strip = setup_wall_strip(span->column, first, last - first);
+		render_strip(game, game->grate_texture, &source, &strip,
+				shade_level(depth, layer->light));
+		span_mark(span, first, last);
+		game->stats.layers++;
+	}
+}
@@ -0,0 +1,50 @@
+#include "../inc/game.h"
+
+/**
+ * span_row - Projects a height at a depth onto a row of the column.
+ * @span: Pointer to the column's ColumnSpan.
+ * @height: Height above the ground, in world units.
+ * @depth: Depth, in world units.
+ *
+ * Return: Row index, outside the viewport for points above or below it.
+ */
+int span_row(const struct ColumnSpan *span, int height, float depth)
+{
+	return ((int)lroundf(span->horizon + (span->eye - height) *
+				span->projection / fmaxf(depth, 1.0f)));
+}
+
+/**
+ * span_write - Fills rows of the column and closes them.
+ * @game: Pointer to the Game structure.
+ * @span: Pointer to the column's ColumnSpan.
+ * @texture: Texture to draw from.
+ * @source: Part of the texture stretched over the rows.
+ * @first: First row to fill; rows up to the span bottom are filled.
+ * @shade: Level the texture color is scaled by.
+ */
+void span_write(struct Game *game, struct ColumnSpan *span,
+		SDL_Texture *texture, const SDL_Rect *source, int first, Uint8 shade)
+{
+	SDL_Rect strip = setup_wall_strip(span->column, first,
+			span->bottom - first);
+
+	render_strip(game, texture, source, &strip, shade);
+	span_mark(span, first, span->bottom);
+	span->bottom = first;
+}
+
+/**
+ * span_mark - Counts rows of a column as written.
+ * @span: Pointer to the column's ColumnSpan.
+ * @first: First row written.
+ * @last: Row after the last one written.
+ */
+void span_mark(struct ColumnSpan *span, int first, int last)
+{
+	int row;
+
+	span->drawn += last - first;
+	for (row = first; row < last; row++)
+		span->written[row / 64] |= (Uint64)1 << (row % 64);
+}
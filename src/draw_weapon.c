@@ -1,10 +1,11 @@
 #include "../inc/rendering.h"
 
 /**
- * draw_weapon - Draws the current weapon on the screen.
+ * draw_weapon - Draws the current weapon at the bottom of a camera's view.
  * @game: Pointer to the Game structure.
+ * @camera: Pointer to the Camera, its viewport already set on the renderer.
  */
-void draw_weapon(struct Game *game)
+void draw_weapon(struct Game *game, const struct Camera *camera)
 {
 	int texture_width, texture_height;
 	int weapon_width, weapon_height, weapon_x, weapon_y;
@@ -28,10 +29,10 @@ void draw_weapon(struct Game *game)
 	}
 
 	SDL_QueryTexture(weapon_texture, NULL, NULL, &texture_width, &texture_height);
-	weapon_width = (int)(WINDOW_WIDTH * scale_factor);
+	weapon_width = (int)(camera->viewport.w * scale_factor);
 	weapon_height = weapon_width * texture_height / texture_width;
-	weapon_x = (WINDOW_WIDTH - weapon_width) / 2;
-	weapon_y = WINDOW_HEIGHT - weapon_height;
+	weapon_x = (camera->viewport.w - weapon_width) / 2;
+	weapon_y = camera->viewport.h - weapon_height;
 
 	*weapon_rect = (SDL_Rect){weapon_x, weapon_y, weapon_width, weapon_height};
 
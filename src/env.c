@@ -0,0 +1,109 @@
+#include "../inc/env.h"
+#include "../inc/maze_gen.h"
+
+static void env_spawn(struct Env *env, struct Player *agent,
+		struct MazeRng *rng);
+
+/**
+ * env_create - Creates a headless environment.
+ * @map_path: Map file or maze specification. Streamed worlds are refused:
+ *		their chunks only follow the game's players.
+ * @agent_count: Number of agents.
+ * @columns: Number of rays cast per agent and step, spread over the
+ *		FOV_DEGREES field of view.
+ * @thread_count: Number of worker threads, 0 to step on the calling
+ *		thread only.
+ *
+ * Return: Pointer to the Env, reset with seed MAZE_DEFAULT_SEED, or NULL
+ * on failure.
+ */
+struct Env *env_create(const char *map_path, int agent_count, int columns,
+		int thread_count)
+{
+	struct Env *env;
+
+	if (agent_count <= 0 || columns <= 0)
+		return (NULL);
+	env = calloc(1, sizeof(*env));
+	if (!env)
+		return (NULL);
+	env->agent_count = agent_count;
+	env->columns = columns;
+	env->agents = calloc(agent_count, sizeof(*env->agents));
+	env->observations = calloc((size_t)agent_count * columns * ENV_HIT_SIZE,
+			sizeof(*env->observations));
+	env->jobs = job_pool_create(thread_count);
+	if (!env->agents || !env->observations || !env->jobs ||
+			!parse_map_file(&env->game, map_path) || !env->game.map)
+	{
+		env_destroy(env);
+		return (NULL);
+	}
+	env_reset(env, MAZE_DEFAULT_SEED);
+	return (env);
+}
+
+/**
+ * env_destroy - Releases an environment.
+ * @env: Pointer to the Env, may be NULL.
+ */
+void env_destroy(struct Env *env)
+{
+	if (!env)
+		return;
+	job_pool_destroy(env->jobs);
+	world_destroy(env->game.world);
+	free(env->game.map);
+	free(env->observations);
+	free(env->agents);
+	free(env);
+}
+
+/**
+ * env_reset - Places every agent on a random floor tile.
+ * @env: Pointer to the Env.
+ * @seed: Seed of the placement, the same seed gives the same placement.
+ *
+ * Return: Observations of the new placement.
+ */
+const float *env_reset(struct Env *env, Uint64 seed)
+{
+	struct MazeRng rng = {seed};
+	const float *observations;
+	int i;
+
+	for (i = 0; i < env->agent_count; i++)
+		env_spawn(env, &env->agents[i], &rng);
+	observations = env_step(env, NULL, 0);
+	env->steps = 0;
+	return (observations);
+}
+
+/**
+ * env_spawn - Places one agent at the center of a random floor tile.
+ * @env: Pointer to the Env.
+ * @agent: Pointer to the agent's Player.
+ * @rng: Pointer to the random generator.
+ *
+ * Falls back to tile (1, 1), the game's own start, when no floor tile
+ * turns up within ENV_SPAWN_ATTEMPTS draws.
+ */
+static void env_spawn(struct Env *env, struct Player *agent,
+		struct MazeRng *rng)
+{
+	int attempt, x = 1, y = 1;
+
+	for (attempt = 0; attempt < ENV_SPAWN_ATTEMPTS; attempt++)
+	{
+		x = maze_rng_below(rng, env->game.map_width);
+		y = maze_rng_below(rng, env->game.map_height);
+		if (map_cell(&env->game, x, y) == MAP_FLOOR)
+			break;
+		x = 1;
+		y = 1;
+	}
+	agent->x = x * TILE_SIZE + TILE_SIZE / 2;
+	agent->y = y * TILE_SIZE + TILE_SIZE / 2;
+	agent->angle = maze_rng_below(rng, 360) * PI / 180;
+	update_direction(agent);
+}
@@ -0,0 +1,92 @@
+#include "../inc/env.h"
+
+static void env_step_batch(void *context, int index);
+static void env_observe(const struct Env *env, const struct Player *agent,
+		float *observation);
+
+/**
+ * env_step - Advances every agent by one step and casts their rays.
+ * @env: Pointer to the Env.
+ * @actions: agent_count * ENV_ACTION_SIZE floats, or NULL to only observe.
+ *		Every agent's forward, strafe-right and turn-clockwise inputs,
+ *		each in [-1, 1], scaled like a held key: PLAYER_SPEED and
+ *		ROTATION_SPEED per second.
+ * @delta_time: Duration of the step, in seconds.
+ *
+ * Agents move with the same rules as a player: move_player() and its
+ * wall collision. Batches of ENV_BATCH_AGENTS agents are stepped in
+ * parallel; agents never collide with each other, so the result does not
+ * depend on the thread count.
+ *
+ * Return: The observations, valid until the next step or reset.
+ */
+const float *env_step(struct Env *env, const float *actions,
+		float delta_time)
+{
+	env->actions = actions;
+	env->delta_time = delta_time;
+	job_pool_run(env->jobs, env_step_batch, env,
+			(env->agent_count + ENV_BATCH_AGENTS - 1) / ENV_BATCH_AGENTS);
+	env->steps++;
+	return (env->observations);
+}
+
+/**
+ * env_step_batch - Job stepping one batch of agents.
+ * @context: Pointer to the Env.
+ * @index: Batch index.
+ */
+static void env_step_batch(void *context, int index)
+{
+	struct Env *env = context;
+	struct Player *agent;
+	const float *action;
+	int i, last = (index + 1) * ENV_BATCH_AGENTS;
+
+	if (last > env->agent_count)
+		last = env->agent_count;
+	for (i = index * ENV_BATCH_AGENTS; i < last; i++)
+	{
+		agent = &env->agents[i];
+		if (env->actions)
+		{
+			action = env->actions + (size_t)i * ENV_ACTION_SIZE;
+			rotate_player(agent, action[2] * ROTATION_SPEED * env->delta_time);
+			update_direction(agent);
+			move_player(&env->game, agent,
+					action[0] * PLAYER_SPEED * env->delta_time,
+					action[1] * PLAYER_SPEED * env->delta_time);
+			keep_player_in_bounds(&env->game, agent);
+		}
+		env_observe(env, agent, env->observations +
+				(size_t)i * env->columns * ENV_HIT_SIZE);
+	}
+}
+
+/**
+ * env_observe - Casts the rays of one agent.
+ * @env: Pointer to the Env.
+ * @agent: Pointer to the agent's Player.
+ * @observation: Array receiving columns * ENV_HIT_SIZE floats.
+ *
+ * Rays that leave the map without hitting a wall report a distance of -1.
+ */
+static void env_observe(const struct Env *env, const struct Player *agent,
+		float *observation)
+{
+	float fov = FOV_RADIAN;
+	float angle_step = env->columns > 1 ? fov / (env->columns - 1) : 0;
+	float start_angle = env->columns > 1 ? agent->angle - fov / 2 :
+		agent->angle;
+	struct RayHit hit;
+	int column;
+
+	for (column = 0; column < env->columns; column++)
+	{
+		cast_single_ray(&env->game, agent, start_angle + column * angle_step,
+				&hit);
+		observation[column * ENV_HIT_SIZE] = isinf(hit.distance) ? -1 :
+			hit.distance / TILE_SIZE;
+		observation[column * ENV_HIT_SIZE + 1] = hit.is_vertical;
+	}
+}
@@ -0,0 +1,111 @@
+#include "../inc/fixed.h"
+#include "../inc/map.h"
+
+#define FIX_NO_CROSSING ((Sint64)1 << 62)
+
+static Sint64 fixed_first_crossing(fixed_t position, fixed_t direction,
+		Sint64 delta);
+
+/**
+ * fixed_cast_ray - Casts one ray with integer arithmetic only.
+ * @game: Pointer to the Game structure holding the map.
+ * @tables: Pointer to the FixedTables.
+ * @player: Pointer to the FixedPlayer the ray starts from.
+ * @angle: Ray angle, in angle units within [0, angles).
+ * @hit: Pointer to the FixedHit to fill.
+ *
+ * The ray walks the grid one tile border at a time (DDA), always crossing
+ * the nearer of the next vertical and horizontal borders, until it enters
+ * a wall. Tiles outside the map read as walls, so the walk always ends.
+ */
+void fixed_cast_ray(const struct Game *game, const struct FixedTables *tables,
+		const struct FixedPlayer *player, int angle, struct FixedHit *hit)
+{
+	fixed_t dir_x = tables->cos[angle], dir_y = tables->sin[angle];
+	int map_x = player->x >> FIX_SHIFT, map_y = player->y >> FIX_SHIFT;
+	Sint64 delta_x = dir_x ? ((Sint64)FIX_ONE << FIX_SHIFT) / abs(dir_x) :
+		FIX_NO_CROSSING;
+	Sint64 delta_y = dir_y ? ((Sint64)FIX_ONE << FIX_SHIFT) / abs(dir_y) :
+		FIX_NO_CROSSING;
+	Sint64 side_x = fixed_first_crossing(player->x, dir_x, delta_x);
+	Sint64 side_y = fixed_first_crossing(player->y, dir_y, delta_y);
+	Sint64 distance;
+
+	do {
+		if (side_x < side_y)
+		{
+			distance = side_x;
+			side_x += delta_x;
+			map_x += dir_x < 0 ? -1 : 1;
+			hit->is_vertical = 1;
+		}
+		else
+		{
+			distance = side_y;
+			side_y += delta_y;
+			map_y += dir_y < 0 ? -1 : 1;
+			hit->is_vertical = 0;
+		}
+	} while (map_cell(game, map_x, map_y) != MAP_WALL);
+	if (distance > SDL_MAX_SINT32)
+		distance = SDL_MAX_SINT32;
+	hit->distance = (fixed_t)distance;
+	hit->x = player->x + (fixed_t)((dir_x * distance) >> FIX_SHIFT);
+	hit->y = player->y + (fixed_t)((dir_y * distance) >> FIX_SHIFT);
+}
+
+/**
+ * fixed_cast_rays - Casts a range of camera columns with the fixed-point
+ *		engine, for drawing.
+ * @game: Pointer to the Game structure, its fixed tables created.
+ * @camera: Pointer to the Camera whose hits are filled.
+ * @first: First column to cast.
+ * @last: Column after the last one to cast.
+ *
+ * The rays start from the camera's fixed player, never from the float
+ * one drawn, and the hits are converted to floats for the renderer.
+ */
+void fixed_cast_rays(const struct Game *game, struct Camera *camera,
+		int first, int last)
+{
+	const struct FixedTables *tables = game->fixed;
+	const struct FixedPlayer *viewer = &game->fixed_players[camera->player -
+		game->players];
+	struct FixedHit hit;
+	struct RayHit *out;
+	int column, angle;
+
+	for (column = first; column < last; column++)
+	{
+		angle = fixed_angle_wrap(tables, viewer->angle - tables->columns / 2 +
+				column * tables->columns / camera->viewport.w);
+		fixed_cast_ray(game, tables, viewer, angle, &hit);
+		out = &camera->hits[column];
+		out->angle = angle * 2 * PI / tables->angles;
+		out->distance = FIX_TO_FLOAT(hit.distance) * TILE_SIZE;
+		out->end_x = FIX_TO_FLOAT(hit.x) * TILE_SIZE;
+		out->end_y = FIX_TO_FLOAT(hit.y) * TILE_SIZE;
+		out->is_vertical = hit.is_vertical;
+	}
+}
+
+/**
+ * fixed_first_crossing - Distance along a ray to its first tile border on
+ *		one axis.
+ * @position: Start coordinate on that axis.
+ * @direction: Ray direction component on that axis.
+ * @delta: Distance along the ray between two borders on that axis.
+ *
+ * Return: Distance in tiles, 16.16 fixed point.
+ */
+static Sint64 fixed_first_crossing(fixed_t position, fixed_t direction,
+		Sint64 delta)
+{
+	Sint64 fraction = position & FIX_FRACTION_MASK;
+
+	if (direction == 0)
+		return (FIX_NO_CROSSING);
+	if (direction > 0)
+		fraction = FIX_ONE - fraction;
+	return ((fraction * delta) >> FIX_SHIFT);
+}
@@ -0,0 +1,89 @@
+#include "../inc/game.h"
+
+static void fixed_player_derive(const struct FixedTables *tables,
+		const struct FixedPlayer *fixed, struct Player *player);
+
+/**
+ * fixed_handle_input - Moves every player with the fixed-point engine.
+ * @game: Pointer to the Game structure, its fixed tables created.
+ *
+ * The speeds become whole 16.16 steps per second and the frame time
+ * whole milliseconds, so the same keys held for the same frame times
+ * move the fixed players to the same bits on every build. The float
+ * players are only written back from them, for drawing.
+ */
+void fixed_handle_input(struct Game *game)
+{
+	const struct FixedTables *tables = game->fixed;
+	struct FixedPlayer *fixed;
+	long ms = lroundf(game->delta_time * 1000);
+	fixed_t step = lroundf(PLAYER_SPEED * FIX_ONE / TILE_SIZE) * ms / 1000;
+	int turn = lroundf(ROTATION_SPEED * tables->angles / (2 * PI)) * ms /
+		1000;
+	int i, buttons;
+
+	fixed_sync_players(game);
+	for (i = 0; i < game->player_count; i++)
+	{
+		fixed = &game->fixed_players[i];
+		buttons = input_buttons(game, i);
+		if (buttons & INPUT_TURN_LEFT)
+			fixed_rotate_player(tables, fixed, -turn);
+		if (buttons & INPUT_TURN_RIGHT)
+			fixed_rotate_player(tables, fixed, turn);
+		fixed_move_player(game, tables, fixed,
+				(buttons & INPUT_FORWARD ? step : 0) -
+				(buttons & INPUT_BACKWARD ? step : 0),
+				(buttons & INPUT_STRAFE_RIGHT ? step : 0) -
+				(buttons & INPUT_STRAFE_LEFT ? step : 0));
+		fixed_player_derive(tables, fixed, &game->players[i]);
+	}
+}
+
+/**
+ * fixed_sync_players - Takes over the float players moved by something
+ *		other than the fixed-point engine.
+ * @game: Pointer to the Game structure, its fixed tables created.
+ *
+ * Spawning, level switches, rewinds and the server place the float
+ * players. A float player that no longer matches its fixed one is
+ * rounded into the engine, then snapped onto what the engine holds.
+ */
+void fixed_sync_players(struct Game *game)
+{
+	const struct FixedTables *tables = game->fixed;
+	struct FixedPlayer *fixed;
+	struct Player *player, derived;
+	int i;
+
+	for (i = 0; i < game->player_count; i++)
+	{
+		fixed = &game->fixed_players[i];
+		player = &game->players[i];
+		fixed_player_derive(tables, fixed, &derived);
+		if (derived.x == player->x && derived.y == player->y &&
+				derived.angle == player->angle)
+			continue;
+		fixed->x = (fixed_t)(player->x * FIX_ONE / TILE_SIZE);
+		fixed->y = (fixed_t)(player->y * FIX_ONE / TILE_SIZE);
+		fixed->angle = fixed_angle_wrap(tables,
+				(int)lroundf(player->angle * tables->angles / (2 * PI)));
+		fixed_player_derive(tables, fixed, player);
+	}
+}
+
+/**
+ * fixed_player_derive - Writes the float player of a fixed one.
+ * @tables: Pointer to the FixedTables.
+ * @fixed: Pointer to the FixedPlayer.
+ * @player: Pointer to the Player to write, in world units and radians.
+ */
+static void fixed_player_derive(const struct FixedTables *tables,
+		const struct FixedPlayer *fixed, struct Player *player)
+{
+	player->x = FIX_TO_FLOAT(fixed->x) * TILE_SIZE;
+	player->y = FIX_TO_FLOAT(fixed->y) * TILE_SIZE;
+	player->angle = fixed->angle * 2 * PI / tables->angles;
+	player->dirX = FIX_TO_FLOAT(tables->cos[fixed->angle]);
+	player->dirY = FIX_TO_FLOAT(tables->sin[fixed->angle]);
+}
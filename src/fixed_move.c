@@ -0,0 +1,63 @@
+#include "../inc/fixed.h"
+#include "../inc/map.h"
+
+/**
+ * fixed_rotate_player - Turns a fixed-point player.
+ * @tables: Pointer to the FixedTables.
+ * @player: Pointer to the FixedPlayer.
+ * @amount: Angle units to add; positive turns clockwise.
+ */
+void fixed_rotate_player(const struct FixedTables *tables,
+		struct FixedPlayer *player, int amount)
+{
+	player->angle = fixed_angle_wrap(tables, player->angle + amount);
+}
+
+/**
+ * fixed_check_collision - Fixed-point twin of check_collision().
+ * @game: Pointer to the Game structure holding the map.
+ * @tables: Pointer to the FixedTables.
+ * @player: Pointer to the moving FixedPlayer.
+ * @new_x: Potential new x position, in tiles.
+ * @new_y: Potential new y position, in tiles.
+ *
+ * Return: true if no collision, false if collision detected.
+ */
+bool fixed_check_collision(const struct Game *game,
+		const struct FixedTables *tables, const struct FixedPlayer *player,
+		fixed_t new_x, fixed_t new_y)
+{
+	fixed_t reach_x = FIX_MUL(FIX_PLAYER_RADIUS, tables->cos[player->angle]);
+	fixed_t reach_y = FIX_MUL(FIX_PLAYER_RADIUS, tables->sin[player->angle]);
+
+	return (map_cell(game, (new_x + reach_x) >> FIX_SHIFT,
+				(new_y + reach_y) >> FIX_SHIFT) == MAP_FLOOR &&
+		map_cell(game, (new_x - reach_x) >> FIX_SHIFT,
+				(new_y - reach_y) >> FIX_SHIFT) == MAP_FLOOR);
+}
+
+/**
+ * fixed_move_player - Fixed-point twin of move_player().
+ * @game: Pointer to the Game structure holding the map.
+ * @tables: Pointer to the FixedTables.
+ * @player: Pointer to the FixedPlayer.
+ * @forward: Distance to move forward in tiles, negative to move backward.
+ * @strafe: Distance to step right in tiles, negative to step left.
+ */
+void fixed_move_player(const struct Game *game,
+		const struct FixedTables *tables, struct FixedPlayer *player,
+		fixed_t forward, fixed_t strafe)
+{
+	fixed_t dir_x = tables->cos[player->angle];
+	fixed_t dir_y = tables->sin[player->angle];
+	fixed_t new_x = player->x + FIX_MUL(dir_x, forward) -
+		FIX_MUL(dir_y, strafe);
+	fixed_t new_y = player->y + FIX_MUL(dir_y, forward) +
+		FIX_MUL(dir_x, strafe);
+
+	if (fixed_check_collision(game, tables, player, new_x, new_y))
+	{
+		player->x = new_x;
+		player->y = new_y;
+	}
+}
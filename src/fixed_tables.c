@@ -0,0 +1,115 @@
+#include "../inc/fixed.h"
+
+static void fixed_sin_cos_q30(Sint64 x, Sint64 *sine, Sint64 *cosine);
+static fixed_t fixed_from_q30(Sint64 value);
+
+/**
+ * fixed_tables_create - Builds the trig tables of the fixed-point engine.
+ * @columns: Number of columns across the FOV_DEGREES field of view,
+ *		normally NUM_RAYS.
+ *
+ * Every angle is split into a quadrant and a remainder with integer
+ * arithmetic, and the remainder's sine and cosine come from a Taylor
+ * series evaluated in 2.30 fixed point.
+ *
+ * Return: Pointer to the FixedTables, or NULL on failure.
+ */
+struct FixedTables *fixed_tables_create(int columns)
+{
+	struct FixedTables *tables = calloc(1, sizeof(*tables));
+	Sint64 sine, cosine, remainder;
+	int angle, quadrant;
+
+	if (!tables)
+		return (NULL);
+	tables->columns = columns;
+	tables->angles = columns * 360 / FOV_DEGREES;
+	tables->sin = malloc(tables->angles * sizeof(*tables->sin));
+	tables->cos = malloc(tables->angles * sizeof(*tables->cos));
+	if (columns <= 0 || !tables->sin || !tables->cos)
+	{
+		fixed_tables_destroy(tables);
+		return (NULL);
+	}
+	for (angle = 0; angle < tables->angles; angle++)
+	{
+		quadrant = (int)((Sint64)angle * 4 / tables->angles);
+		remainder = (Sint64)angle * 4 - (Sint64)quadrant * tables->angles;
+		fixed_sin_cos_q30(remainder * FIX_Q30_HALF_PI / tables->angles,
+				&sine, &cosine);
+		tables->sin[angle] = fixed_from_q30(quadrant == 0 ? sine :
+				quadrant == 1 ? cosine : quadrant == 2 ? -sine : -cosine);
+		tables->cos[angle] = fixed_from_q30(quadrant == 0 ? cosine :
+				quadrant == 1 ? -sine : quadrant == 2 ? -cosine : sine);
+	}
+	return (tables);
+}
+
+/**
+ * fixed_tables_destroy - Releases the trig tables.
+ * @tables: Pointer to the FixedTables, may be NULL.
+ */
+void fixed_tables_destroy(struct FixedTables *tables)
+{
+	if (!tables)
+		return;
+	free(tables->sin);
+	free(tables->cos);
+	free(tables);
+}
+
+/**
+ * fixed_angle_wrap - Brings an angle back into [0, angles).
+ * @tables: Pointer to the FixedTables.
+ * @angle: Angle in angle units, possibly negative or past a full turn.
+ *
+ * Return: Equivalent angle usable as a table index.
+ */
+int fixed_angle_wrap(const struct FixedTables *tables, int angle)
+{
+	angle %= tables->angles;
+	return (angle < 0 ? angle + tables->angles : angle);
+}
+
+/**
+ * fixed_sin_cos_q30 - Sine and cosine of an angle in [0, PI / 2).
+ * @x: Angle in radians, 2.30 fixed point.
+ * @sine: Pointer to store the sine, 2.30 fixed point.
+ * @cosine: Pointer to store the cosine, 2.30 fixed point.
+ *
+ * The terms are kept positive and alternately added and subtracted, so no
+ * negative value is ever shifted.
+ */
+static void fixed_sin_cos_q30(Sint64 x, Sint64 *sine, Sint64 *cosine)
+{
+	Sint64 x2 = (x * x) >> FIX_Q30_SHIFT, term;
+	int n;
+
+	*sine = 0;
+	for (term = x, n = 1; term > 0; n += 2)
+	{
+		*sine += (n & 2) ? -term : term;
+		term = ((term * x2) >> FIX_Q30_SHIFT) / ((n + 1) * (n + 2));
+	}
+	*cosine = 0;
+	for (term = (Sint64)1 << FIX_Q30_SHIFT, n = 0; term > 0; n += 2)
+	{
+		*cosine += (n & 2) ? -term : term;
+		term = ((term * x2) >> FIX_Q30_SHIFT) / ((n + 1) * (n + 2));
+	}
+}
+
+/**
+ * fixed_from_q30 - Rounds a 2.30 fixed-point value to 16.16.
+ * @value: Value in 2.30 fixed point.
+ *
+ * Return: Nearest 16.16 value, rounding halves away from zero.
+ */
+static fixed_t fixed_from_q30(Sint64 value)
+{
+	Sint64 half = (Sint64)1 << (FIX_Q30_SHIFT - FIX_SHIFT - 1);
+
+	if (value < 0)
+		return (-(fixed_t)((-value + half) >> (FIX_Q30_SHIFT - FIX_SHIFT)));
+	return ((fixed_t)((value + half) >> (FIX_Q30_SHIFT - FIX_SHIFT)));
+}
@@ -0,0 +1,125 @@
+#include "../inc/game.h"
+
+static void fog_dirty(struct Fog *fog, int map_y, int first_x, int last_x);
+
+/**
+ * fog_reset - Forgets every explored tile, sizing the fog to a map.
+ * @game: Pointer to the Game structure; the fog is created on first use.
+ * @width: Width of the map, in tiles.
+ * @height: Height of the map, in tiles.
+ *
+ * Called when a map is loaded and on every level switch, as a new level
+ * starts unexplored. The new tiles are allocated before the old ones are
+ * freed, so on failure the fog still matches the map it was sized to.
+ *
+ * Return: true on success, false if memory runs out.
+ */
+bool fog_reset(struct Game *game, int width, int height)
+{
+	struct Fog *fog = game->fog;
+	Uint64 *explored = calloc(((size_t)width * height + 63) / 64,
+			sizeof(*explored));
+
+	if (!fog && explored)
+		fog = game->fog = calloc(1, sizeof(*fog));
+	if (!fog || !explored)
+	{
+		free(explored);
+		fprintf(stderr, "Error allocating the explored tiles\n");
+		return (false);
+	}
+	SDL_DestroyTexture(fog->texture);
+	fog->texture = NULL;
+	free(fog->explored);
+	fog->explored = explored;
+	fog->width = width;
+	fog->height = height;
+	fog->untextured = game->world || width > FOG_TEXTURE_MAX ||
+		height > FOG_TEXTURE_MAX;
+	fog->dirty_first_x = width;
+	fog->dirty_first_y = height;
+	fog->dirty_last_x = 0;
+	fog->dirty_last_y = 0;
+	return (true);
+}
+
+/**
+ * fog_destroy - Releases a fog.
+ * @fog: Pointer to the Fog, may be NULL.
+ */
+void fog_destroy(struct Fog *fog)
+{
+	if (!fog)
+		return;
+	SDL_DestroyTexture(fog->texture);
+	free(fog->explored);
+	free(fog);
+}
+
+/**
+ * fog_explored - Checks whether a tile has been seen.
+ * @fog: Pointer to the Fog.
+ * @map_x: Tile column.
+ * @map_y: Tile row.
+ *
+ * Return: true if a ray crossed the tile, false otherwise or outside the
+ * map.
+ */
+bool fog_explored(const struct Fog *fog, int map_x, int map_y)
+{
+	size_t bit = (size_t)map_y * fog->width + map_x;
+
+	if (map_x < 0 || map_x >= fog->width || map_y < 0 ||
+			map_y >= fog->height)
+		return (false);
+	return ((fog->explored[bit / 64] >> (bit % 64)) & 1);
+}
+
+/**
+ * fog_mark - Marks a span of a row explored.
+ * @fog: Pointer to the Fog.
+ * @map_y: Tile row.
+ * @first_x: First tile column of the span.
+ * @last_x: Column after the last one of the span.
+ *
+ * The span is clipped to the map and set a word at a time; the dirty
+ * rectangle only grows when a bit was not set yet.
+ */
+void fog_mark(struct Fog *fog, int map_y, int first_x, int last_x)
+{
+	size_t bit, end, word;
+	Uint64 mask, fresh = 0;
+
+	first_x = SDL_max(first_x, 0);
+	last_x = SDL_min(last_x, fog->width);
+	if (map_y < 0 || map_y >= fog->height || first_x >= last_x)
+		return;
+	bit = (size_t)map_y * fog->width + first_x;
+	end = bit + (last_x - first_x);
+	for (; bit < end; bit = (word + 1) * 64)
+	{
+		word = bit / 64;
+		mask = ~(Uint64)0 << (bit % 64);
+		if (end - word * 64 < 64)
+			mask &= ((Uint64)1 << (end - word * 64)) - 1;
+		fresh |= mask & ~fog->explored[word];
+		fog->explored[word] |= mask;
+	}
+	if (fresh)
+		fog_dirty(fog, map_y, first_x, last_x);
+}
+
+/**
+ * fog_dirty - Grows the rectangle of tiles the texture lacks.
+ * @fog: Pointer to the Fog.
+ * @map_y: Tile row revealed.
+ * @first_x: First tile column revealed.
+ * @last_x: Column after the last one revealed.
+ */
+static void fog_dirty(struct Fog *fog, int map_y, int first_x, int last_x)
+{
+	fog->dirty_first_x = SDL_min(fog->dirty_first_x, first_x);
+	fog->dirty_last_x = SDL_max(fog->dirty_last_x, last_x);
+	fog->dirty_first_y = SDL_min(fog->dirty_first_y, map_y);
+	fog->dirty_last_y = SDL_max(fog->dirty_last_y, map_y + 1);
+}
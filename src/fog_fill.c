@@ -0,0 +1,102 @@
+#include "../inc/game.h"
+
+static void fog_sort(const float **top, const float **middle,
+		const float **bottom);
+static float fog_short_x(const float *top, const float *middle,
+		const float *bottom, float y);
+
+/**
+ * fog_triangle - Marks every tile a triangle touches.
+ * @fog: Pointer to the Fog.
+ * @corners: x and y of the three corners, in tiles, inside the map.
+ *
+ * The triangle being convex, its part inside one row of tiles spans
+ * from the leftmost to the rightmost of the points where its two sides
+ * cross the row's top and bottom, and of the middle corner if the row
+ * holds it. Both sides are followed top to bottom, the long one from the
+ * top corner to the bottom one, the short one through the middle corner.
+ */
+void fog_triangle(struct Fog *fog, const float *corners)
+{
+	const float *top = corners, *middle = corners + 2, *bottom = corners + 4;
+	float y, next_y, long_slope, low, high, x[5];
+	int row;
+
+	fog_sort(&top, &middle, &bottom);
+	row = (int)top[1];
+	if (top[1] == bottom[1])
+	{
+		fog_mark(fog, row, (int)SDL_min(top[0], SDL_min(middle[0],
+						bottom[0])), (int)SDL_max(top[0],
+						SDL_max(middle[0], bottom[0])) + 1);
+		return;
+	}
+	long_slope = (bottom[0] - top[0]) / (bottom[1] - top[1]);
+	for (; row <= (int)bottom[1]; row++)
+	{
+		y = SDL_max(top[1], row);
+		next_y = SDL_min(bottom[1], row + 1);
+		x[0] = top[0] + (y - top[1]) * long_slope;
+		x[1] = top[0] + (next_y - top[1]) * long_slope;
+		x[2] = fog_short_x(top, middle, bottom, y);
+		x[3] = fog_short_x(top, middle, bottom, next_y);
+		x[4] = middle[1] >= y && middle[1] <= next_y ? middle[0] : x[3];
+		low = SDL_min(SDL_min(x[0], x[1]), SDL_min(x[2], SDL_min(x[3],
+						x[4])));
+		high = SDL_max(SDL_max(x[0], x[1]), SDL_max(x[2], SDL_max(x[3],
+						x[4])));
+		fog_mark(fog, row, (int)low, (int)high + 1);
+	}
+}
+
+/**
+ * fog_sort - Orders the corners of a triangle from top to bottom.
+ * @top: Pointer to the corner to end up with the smallest y.
+ * @middle: Pointer to the corner to end up in the middle.
+ * @bottom: Pointer to the corner to end up with the largest y.
+ */
+static void fog_sort(const float **top, const float **middle,
+		const float **bottom)
+{
+	const float *swap;
+
+	if ((*middle)[1] < (*top)[1])
+	{
+		swap = *top;
+		*top = *middle;
+		*middle = swap;
+	}
+	if ((*bottom)[1] < (*middle)[1])
+	{
+		swap = *middle;
+		*middle = *bottom;
+		*bottom = swap;
+	}
+	if ((*middle)[1] < (*top)[1])
+	{
+		swap = *top;
+		*top = *middle;
+		*middle = swap;
+	}
+}
+
+/**
+ * fog_short_x - Finds where the short side of a triangle crosses a line.
+ * @top: x and y of the top corner, in tiles.
+ * @middle: x and y of the middle corner.
+ * @bottom: x and y of the bottom corner.
+ * @y: y of the line, between the top and the bottom corner.
+ *
+ * Return: x of the crossing, in tiles.
+ */
+static float fog_short_x(const float *top, const float *middle,
+		const float *bottom, float y)
+{
+	if (y < middle[1])
+		return (top[0] + (y - top[1]) * (middle[0] - top[0]) /
+				(middle[1] - top[1]));
+	if (bottom[1] == middle[1])
+		return (middle[0]);
+	return (middle[0] + (y - middle[1]) * (bottom[0] - middle[0]) /
+			(bottom[1] - middle[1]));
+}
@@ -0,0 +1,139 @@
+#include "../inc/game.h"
+
+static int fog_run_end(const struct Camera *camera, int first, int last);
+static bool fog_same_wall(const struct RayHit *a, const struct RayHit *b,
+		int columns);
+static void fog_face(struct Fog *fog, const struct Player *viewer,
+		const struct RayHit *start, const struct RayHit *end);
+
+/**
+ * fog_reveal - Marks the tiles the rays of a range of columns crossed.
+ * @game: Pointer to the Game structure, its fog NULL when nothing is
+ *		explored.
+ * @camera: Pointer to the Camera, its columns just cast.
+ * @first: First column cast.
+ * @last: Column after the last one cast.
+ *
+ * Neighbouring columns ending on the same straight wall sweep the
+ * triangle between the viewer and the two ends of the run, so the rays
+ * are not walked again: each run fills the tiles of its triangle row by
+ * row, then marks the wall tiles it ended on. The work follows the walls
+ * in view rather than the rays, whatever engine cast them.
+ */
+void fog_reveal(struct Game *game, const struct Camera *camera, int first,
+		int last)
+{
+	const struct Player *viewer = camera->player;
+	const struct RayHit *start, *end;
+	float corners[6];
+	int run_end;
+
+	if (!game->fog)
+		return;
+	for (; first < last; first = run_end)
+	{
+		run_end = fog_run_end(camera, first, last);
+		start = &camera->hits[first];
+		end = &camera->hits[run_end - 1];
+		if (isinf(start->distance))
+			continue;
+		corners[0] = viewer->x / TILE_SIZE;
+		corners[1] = viewer->y / TILE_SIZE;
+		corners[2] = start->end_x / TILE_SIZE;
+		corners[3] = start->end_y / TILE_SIZE;
+		corners[4] = end->end_x / TILE_SIZE;
+		corners[5] = end->end_y / TILE_SIZE;
+		fog_triangle(game->fog, corners);
+		fog_face(game->fog, viewer, start, end);
+	}
+}
+
+/**
+ * fog_run_end - Finds where a run of columns ending on one wall stops.
+ * @camera: Pointer to the Camera.
+ * @first: First column of the run.
+ * @last: Column after the last one that may belong to it.
+ *
+ * The run grows by leaps of up to FOG_RUN_STRIDE columns while the
+ * column leapt to ends on the same wall, halving the leap when it does
+ * not, so a long run is found without reading all of its columns.
+ *
+ * Return: Column after the last one of the run; a column that hit
+ * nothing is a run of its own.
+ */
+static int fog_run_end(const struct Camera *camera, int first, int last)
+{
+	const struct RayHit *hits = camera->hits;
+	int end = first, stride = FOG_RUN_STRIDE;
+
+	if (isinf(hits[first].distance))
+		return (first + 1);
+	while (stride > 0)
+		if (end + stride < last && fog_same_wall(&hits[end],
+					&hits[end + stride], stride))
+			end += stride;
+		else
+			stride /= 2;
+	return (end + 1);
+}
+
+/**
+ * fog_same_wall - Checks whether the columns between two hits all end on
+ *		the wall of the first one.
+ * @a: Pointer to the RayHit of the first column, which hit a wall.
+ * @b: Pointer to the RayHit of a later column.
+ * @columns: Number of columns from @a to @b.
+ *
+ * Both hits must lie exactly on one grid line, every engine stopping its
+ * rays on the lines, and less than a tile apart so no gap fits between.
+ * As in the variable-rate cast, a tile standing in front of the wall is
+ * at least TILE_SIZE / distance radians wide, so while that is more than
+ * the angle between the rays one of the two would have hit it.
+ *
+ * Return: true if every column from @a to @b ends on that wall.
+ */
+static bool fog_same_wall(const struct RayHit *a, const struct RayHit *b,
+		int columns)
+{
+	float gap = fabsf(b->angle - a->angle);
+
+	if (b->is_vertical != a->is_vertical || isinf(b->distance) ||
+			(a->is_vertical ? b->end_x != a->end_x : b->end_y != a->end_y) ||
+			fabsf(a->is_vertical ? b->end_y - a->end_y :
+				b->end_x - a->end_x) >= TILE_SIZE)
+		return (false);
+	if (gap > PI)
+		gap = 2 * PI - gap;
+	return (columns == 1 || SDL_max(a->distance, b->distance) * gap <
+			TILE_SIZE);
+}
+
+/**
+ * fog_face - Marks the wall tiles a run of columns ended on.
+ * @fog: Pointer to the Fog.
+ * @viewer: Pointer to the Player the rays started from.
+ * @start: Pointer to the first hit of the run.
+ * @end: Pointer to the last hit of the run.
+ *
+ * The walls lie past the grid line of the hits, on the far side from
+ * the viewer, as in the casts.
+ */
+static void fog_face(struct Fog *fog, const struct Player *viewer,
+		const struct RayHit *start, const struct RayHit *end)
+{
+	int line, first, last, row;
+
+	if (start->is_vertical)
+	{
+		line = (int)((start->end_x - (start->end_x < viewer->x)) / TILE_SIZE);
+		first = (int)(SDL_min(start->end_y, end->end_y) / TILE_SIZE);
+		last = (int)(SDL_max(start->end_y, end->end_y) / TILE_SIZE);
+		for (row = first; row <= last; row++)
+			fog_mark(fog, row, line, line + 1);
+		return;
+	}
+	line = (int)((start->end_y - (start->end_y < viewer->y)) / TILE_SIZE);
+	first = (int)(SDL_min(start->end_x, end->end_x) / TILE_SIZE);
+	last = (int)(SDL_max(start->end_x, end->end_x) / TILE_SIZE);
+	fog_mark(fog, line, first, last + 1);
+}
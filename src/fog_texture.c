@@ -0,0 +1,69 @@
+#include "../inc/game.h"
+
+static bool fog_create_texture(struct Game *game);
+
+/**
+ * fog_update_texture - Brings the minimap texture up to date.
+ * @game: Pointer to the Game structure, its fog created.
+ *
+ * Only the rectangle spanned by the tiles revealed since the last update
+ * is rewritten; a frame that revealed nothing uploads nothing.
+ */
+void fog_update_texture(struct Game *game)
+{
+	struct Fog *fog = game->fog;
+	SDL_Rect rect;
+	Uint32 *pixels;
+	int pitch, x, y;
+
+	if (!fog->texture && !fog_create_texture(game))
+		return;
+	rect = (SDL_Rect){fog->dirty_first_x, fog->dirty_first_y,
+		fog->dirty_last_x - fog->dirty_first_x,
+		fog->dirty_last_y - fog->dirty_first_y};
+	if (rect.w <= 0 || rect.h <= 0 || SDL_LockTexture(fog->texture, &rect,
+				(void **)&pixels, &pitch) != 0)
+		return;
+	for (y = rect.y; y < rect.y + rect.h; y++)
+		for (x = rect.x; x < rect.x + rect.w; x++)
+			pixels[(y - rect.y) * (pitch / 4) + x - rect.x] =
+				!fog_explored(fog, x, y) ? 0 : map_cell(game, x, y) ==
+				MAP_FLOOR ? FOG_FLOOR_PIXEL : FOG_WALL_PIXEL;
+	SDL_UnlockTexture(fog->texture);
+	fog->dirty_first_x = fog->width;
+	fog->dirty_first_y = fog->height;
+	fog->dirty_last_x = 0;
+	fog->dirty_last_y = 0;
+}
+
+/**
+ * fog_create_texture - Creates the minimap texture of a map.
+ * @game: Pointer to the Game structure.
+ *
+ * The texture starts with undefined pixels, so all of it is marked dirty.
+ * A map that cannot have one is drawn tile by tile from then on.
+ *
+ * Return: true if the texture exists, false otherwise.
+ */
+static bool fog_create_texture(struct Game *game)
+{
+	struct Fog *fog = game->fog;
+
+	if (fog->untextured)
+		return (false);
+	fog->texture = SDL_CreateTexture(game->renderer, SDL_PIXELFORMAT_ARGB8888,
+			SDL_TEXTUREACCESS_STREAMING, fog->width, fog->height);
+	if (!fog->texture)
+	{
+		fprintf(stderr, "Unable to create the minimap texture! Error: %s\n",
+				SDL_GetError());
+		fog->untextured = true;
+		return (false);
+	}
+	SDL_SetTextureBlendMode(fog->texture, SDL_BLENDMODE_BLEND);
+	fog->dirty_first_x = 0;
+	fog->dirty_first_y = 0;
+	fog->dirty_last_x = fog->width;
+	fog->dirty_last_y = fog->height;
+	return (true);
+}
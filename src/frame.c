@@ -0,0 +1,53 @@
+#include "../inc/game.h"
+
+/**
+ * update_world - Streams the world chunks around every player.
+ * @game: Pointer to the Game structure.
+ *
+ * A chunk loaded or evicted changes the map the frame is cast on.
+ */
+void update_world(struct Game *game)
+{
+	int i;
+
+	for (i = 0; game->world && i < game->player_count; i++)
+		if (world_update(game->world, game->players[i].x, game->players[i].y,
+					game->players[i].dirX, game->players[i].dirY))
+			game->map_revision++;
+}
+
+/**
+ * update_lights - Moves every player's lantern to the player.
+ * @game: Pointer to the Game structure.
+ *
+ * The lightmap only changes when a lantern is switched or moved far
+ * enough, and then only around it.
+ */
+void update_lights(struct Game *game)
+{
+	int i;
+
+	for (i = 0; game->lighting && i < game->player_count; i++)
+		lighting_move(game->lighting, i, game->players[i].x, game->players[i].y,
+				game->lantern, game->jobs);
+}
+
+/**
+ * print_usage - Prints the command line the game takes.
+ * @name: Name the game was run as.
+ */
+void print_usage(const char *name)
+{
+	fprintf(stderr, "Usage: %s [--split-screen] [--fixed-point] [--stats] "
+			"[--low-latency] [--batched] [--chunk-cache-mb <N>] "
+			"[--capture <file>] "
+			"[--metrics <socket>] [--serve <port> | --connect <host:port>] "
+			"[--variable-rate <step>] "
+			"[--config <file>] [--width <px>] [--height <px>] "
+			"[--fov <degrees>] [--tile-size <units>] [--speed <units/s>] "
+			"[--rotation-speed <rad/s>] "
+			"<map_file_path | "
+			"maze:<algorithm>:<W>x<H>[:<seed>] | world:<seed>[:<W>x<H>] | "
+			"levels:<manifest_path>>\n",
+			name);
+}
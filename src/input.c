@@ -1,75 +1,100 @@
 #include "../inc/input.h"
 
 /**
- * handle_input - Handles player input for movement and rotation.
+ * handle_input - Handles input for movement and rotation of every player.
  * @game: Pointer to the Game structure.
+ *
+ * With the fixed-point engine on, its players are moved instead and the
+ * float ones derived from them.
  */
 void handle_input(struct Game *game)
 {
 	float movement_speed = PLAYER_SPEED * game->delta_time;
 	float rotation_speed = ROTATION_SPEED * game->delta_time;
+	int i;
 
-	handle_rotation(game, rotation_speed);
-	handle_movement(game, movement_speed);
-	update_direction(&game->player);
-	keep_player_in_bounds(&game->player);
+	if (game->fixed)
+	{
+		fixed_handle_input(game);
+		return;
+	}
+	for (i = 0; i < game->player_count; i++)
+	{
+		handle_rotation(game, i, rotation_speed);
+		handle_movement(game, i, movement_speed);
+		update_direction(&game->players[i]);
+		keep_player_in_bounds(game, &game->players[i]);
+	}
 }
 
 /**
- * handle_rotation - Handles rotation of the player based on input.
+ * handle_rotation - Handles rotation of a player based on input.
  * @game: Pointer to the Game structure.
+ * @index: Index of the player.
  * @rotation_speed: Speed of rotation.
  */
-void handle_rotation(struct Game *game, float rotation_speed)
+void handle_rotation(struct Game *game, int index, float rotation_speed)
 {
-	if (game->keyboard_state[SDL_SCANCODE_LEFT])
-	{
-		game->player.angle -= rotation_speed;
-		if (game->player.angle < 0)
-			game->player.angle += 2 * PI;
-	}
-	if (game->keyboard_state[SDL_SCANCODE_RIGHT])
-	{
-		game->player.angle += rotation_speed;
-		if (game->player.angle > 2 * PI)
-			game->player.angle -= 2 * PI;
-	}
+	int buttons = input_buttons(game, index);
+
+	if (buttons & INPUT_TURN_LEFT)
+		rotate_player(&game->players[index], -rotation_speed);
+	if (buttons & INPUT_TURN_RIGHT)
+		rotate_player(&game->players[index], rotation_speed);
 }
 
 /**
- * handle_movement - Handles movement of the player based on input.
+ * handle_movement - Handles movement of a player based on input.
  * @game: Pointer to the Game structure.
+ * @index: Index of the player.
  * @movement_speed: Speed of movement.
  */
-void handle_movement(struct Game *game, float movement_speed)
+void handle_movement(struct Game *game, int index, float movement_speed)
 {
-	float newX = game->player.x;
-	float newY = game->player.y;
+	int buttons = input_buttons(game, index);
+	float forward = 0, strafe = 0;
 
-	if (game->keyboard_state[SDL_SCANCODE_W])
-	{
-		newX += game->player.dirX * movement_speed;
-		newY += game->player.dirY * movement_speed;
-	}
-	if (game->keyboard_state[SDL_SCANCODE_S])
-	{
-		newX -= game->player.dirX * movement_speed;
-		newY -= game->player.dirY * movement_speed;
-	}
-	if (game->keyboard_state[SDL_SCANCODE_D])
-	{
-		newX -= game->player.dirY * movement_speed;
-		newY += game->player.dirX * movement_speed;
-	}
-	if (game->keyboard_state[SDL_SCANCODE_A])
-	{
-		newX += game->player.dirY * movement_speed;
-		newY -= game->player.dirX * movement_speed;
-	}
+	if (buttons & INPUT_FORWARD)
+		forward += movement_speed;
+	if (buttons & INPUT_BACKWARD)
+		forward -= movement_speed;
+	if (buttons & INPUT_STRAFE_RIGHT)
+		strafe += movement_speed;
+	if (buttons & INPUT_STRAFE_LEFT)
+		strafe -= movement_speed;
+	move_player(game, &game->players[index], forward, strafe);
+}
+
+/**
+ * rotate_player - Turns a player, keeping its angle within [0, 2 * PI].
+ * @player: Pointer to the Player.
+ * @amount: Angle to add, in radians; positive turns clockwise.
+ */
+void rotate_player(struct Player *player, float amount)
+{
+	player->angle += amount;
+	if (player->angle < 0)
+		player->angle += 2 * PI;
+	if (player->angle > 2 * PI)
+		player->angle -= 2 * PI;
+}
+
+/**
+ * move_player - Moves a player along its direction unless a wall is hit.
+ * @game: Pointer to the Game structure holding the map.
+ * @player: Pointer to the Player.
+ * @forward: Distance to move forward, negative to move backward.
+ * @strafe: Distance to step right, negative to step left.
+ */
+void move_player(const struct Game *game, struct Player *player,
+		float forward, float strafe)
+{
+	float newX = player->x + player->dirX * forward - player->dirY * strafe;
+	float newY = player->y + player->dirY * forward + player->dirX * strafe;
 
-	if (check_collision(game, newX, newY))
+	if (check_collision(game, player, newX, newY))
 	{
-		game->player.x = newX;
-		game->player.y = newY;
+		player->x = newX;
+		player->y = newY;
 	}
 }
@@ -0,0 +1,144 @@
+#include "../inc/jobs.h"
+
+static int job_worker(void *data);
+static void job_drain(struct JobPool *pool);
+
+/**
+ * job_pool_create - Starts a pool of worker threads.
+ * @thread_count: Number of workers, at most JOB_MAX_THREADS.
+ *
+ * Return: Pointer to the JobPool, or NULL on failure.
+ */
+struct JobPool *job_pool_create(int thread_count)
+{
+	struct JobPool *pool = calloc(1, sizeof(*pool));
+	int i;
+
+	if (!pool)
+		return (NULL);
+	pool->lock = SDL_CreateMutex();
+	pool->start = SDL_CreateCond();
+	pool->finished = SDL_CreateCond();
+	if (!pool->lock || !pool->start || !pool->finished)
+	{
+		job_pool_destroy(pool);
+		return (NULL);
+	}
+	if (thread_count > JOB_MAX_THREADS)
+		thread_count = JOB_MAX_THREADS;
+	for (i = 0; i < thread_count; i++)
+	{
+		pool->threads[i] = SDL_CreateThread(job_worker, "jobs", pool);
+		if (!pool->threads[i])
+		{
+			job_pool_destroy(pool);
+			return (NULL);
+		}
+		pool->thread_count++;
+	}
+	return (pool);
+}
+
+/**
+ * job_pool_destroy - Stops the workers and releases the pool.
+ * @pool: Pointer to the JobPool, may be NULL.
+ */
+void job_pool_destroy(struct JobPool *pool)
+{
+	int i;
+
+	if (!pool)
+		return;
+	if (pool->lock)
+	{
+		SDL_LockMutex(pool->lock);
+		pool->quit = true;
+		if (pool->start)
+			SDL_CondBroadcast(pool->start);
+		SDL_UnlockMutex(pool->lock);
+	}
+	for (i = 0; i < pool->thread_count; i++)
+		SDL_WaitThread(pool->threads[i], NULL);
+	if (pool->finished)
+		SDL_DestroyCond(pool->finished);
+	if (pool->start)
+		SDL_DestroyCond(pool->start);
+	if (pool->lock)
+		SDL_DestroyMutex(pool->lock);
+	free(pool);
+}
+
+/**
+ * job_pool_run - Runs a batch of jobs and waits for all of them.
+ * @pool: Pointer to the JobPool, or NULL to run the batch inline.
+ * @function: Job function.
+ * @context: Pointer passed to every job.
+ * @count: Number of jobs.
+ */
+void job_pool_run(struct JobPool *pool, JobFunction function, void *context,
+		int count)
+{
+	int i;
+
+	if (!pool || pool->thread_count == 0 || count <= 1)
+	{
+		for (i = 0; i < count; i++)
+			function(context, i);
+		return;
+	}
+	SDL_LockMutex(pool->lock);
+	pool->function = function;
+	pool->context = context;
+	pool->count = count;
+	SDL_AtomicSet(&pool->next, 0);
+	pool->busy = pool->thread_count;
+	pool->generation++;
+	SDL_CondBroadcast(pool->start);
+	SDL_UnlockMutex(pool->lock);
+	job_drain(pool);
+	SDL_LockMutex(pool->lock);
+	while (pool->busy > 0)
+		SDL_CondWait(pool->finished, pool->lock);
+	SDL_UnlockMutex(pool->lock);
+}
+
+/**
+ * job_worker - Worker thread loop.
+ * @data: Pointer to the JobPool.
+ *
+ * Return: Always 0.
+ */
+static int job_worker(void *data)
+{
+	struct JobPool *pool = data;
+	Uint32 seen = 0;
+
+	SDL_LockMutex(pool->lock);
+	while (true)
+	{
+		while (!pool->quit && pool->generation == seen)
+			SDL_CondWait(pool->start, pool->lock);
+		if (pool->quit)
+			break;
+		seen = pool->generation;
+		SDL_UnlockMutex(pool->lock);
+		job_drain(pool);
+		SDL_LockMutex(pool->lock);
+		if (--pool->busy == 0)
+			SDL_CondSignal(pool->finished);
+	}
+	SDL_UnlockMutex(pool->lock);
+	return (0);
+}
+
+/**
+ * job_drain - Runs jobs of the current batch until none is left.
+ * @pool: Pointer to the JobPool.
+ */
+static void job_drain(struct JobPool *pool)
+{
+	int index;
+
+	while ((index = SDL_AtomicAdd(&pool->next, 1)) < pool->count)
+		pool->function(pool->context, index);
+}
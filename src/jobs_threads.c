@@ -0,0 +1,16 @@
+#include "../inc/jobs.h"
+
+/**
+ * job_pool_default_threads - Picks a worker count for this machine.
+ *
+ * Return: One worker per CPU besides the calling thread, at most
+ * JOB_MAX_THREADS.
+ */
+int job_pool_default_threads(void)
+{
+	int threads = SDL_GetCPUCount() - 1;
+
+	if (threads < 0)
+		threads = 0;
+	return (threads > JOB_MAX_THREADS ? JOB_MAX_THREADS : threads);
+}
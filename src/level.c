@@ -0,0 +1,131 @@
+#include "../inc/game.h"
+
+static bool level_switch(struct Game *game, struct Level *level);
+
+/**
+ * level_set_create - Starts playing the levels of a manifest.
+ * @game: Pointer to the Game structure, its renderer and default wall
+ *		texture already created.
+ * @spec_text: Level set specification, "levels:<manifest_path>".
+ *
+ * The first level is loaded before returning; the level after it starts
+ * loading in the background right away. Levels that fail to load are
+ * skipped as they are on a switch, so only a manifest none of whose
+ * levels loads fails.
+ *
+ * Return: true on success, false otherwise. game_cleanup() releases a
+ * partly created set.
+ */
+bool level_set_create(struct Game *game, const char *spec_text)
+{
+	struct LevelSet *set = calloc(1, sizeof(*set));
+
+	if (!set)
+		return (false);
+	game->levels = set;
+	set->default_wall_texture = game->wall_texture;
+	if (!level_read_manifest(set, spec_text + strlen(LEVEL_SPEC_PREFIX)) ||
+			!level_preload(set, 0, 0) || !level_switch(game, &set->slots[0]))
+		return (false);
+	return (level_preload(set, 1, (set->slots[0].index + 1) % set->count));
+}
+
+/**
+ * level_set_destroy - Stops playing a level set and releases it.
+ * @game: Pointer to the Game structure; its level set may be NULL.
+ *
+ * Must run while the renderer is alive. The default wall texture goes
+ * back to the Game, which owns it.
+ */
+void level_set_destroy(struct Game *game)
+{
+	struct LevelSet *set = game->levels;
+	int i;
+
+	if (!set)
+		return;
+	if (set->loader)
+		SDL_WaitThread(set->loader, NULL);
+	game->wall_texture = set->default_wall_texture;
+	game->map = NULL;
+	game->pathfinder = NULL;
+	game->lighting = NULL;
+	for (i = 0; i < LEVEL_SLOTS; i++)
+	{
+		if (set->slots[i].wall_texture)
+			SDL_DestroyTexture(set->slots[i].wall_texture);
+		arena_free(&set->slots[i].arena);
+	}
+	free(set->entries);
+	free(set);
+	game->levels = NULL;
+}
+
+/**
+ * level_set_next - Switches to the preloaded level.
+ * @game: Pointer to the Game structure playing a level set.
+ *
+ * Only waits if the preload has not finished yet. The level left behind
+ * is freed by one arena reset, and the level after the new one starts
+ * loading into its slot. Levels that fail to load are skipped, loading
+ * the following ones in place; the current level is kept if none loads.
+ *
+ * Return: true if the level changed, false otherwise.
+ */
+bool level_set_next(struct Game *game)
+{
+	struct LevelSet *set = game->levels;
+	struct Level *previous = &set->slots[set->current];
+	struct Level *next = &set->slots[1 - set->current];
+	Uint64 start = SDL_GetPerformanceCounter();
+
+	if (!level_switch(game, next))
+		return (false);
+	if (previous->wall_texture)
+		SDL_DestroyTexture(previous->wall_texture);
+	previous->wall_texture = NULL;
+	arena_reset(&previous->arena);
+	SDL_AtomicSet(&previous->state, LEVEL_EMPTY);
+	set->current = 1 - set->current;
+	printf("Level %d/%d %s: %.1f MiB, switched in %.2f ms, lit in %.2f ms\n",
+			next->index + 1, set->count, next->entry->map_path,
+			level_set_memory(set, next->index, NULL) / 1048576.0,
+			(SDL_GetPerformanceCounter() - start) * 1000.0 /
+			SDL_GetPerformanceFrequency(),
+			next->lighting ? next->lighting->bake_ms : 0.0);
+	level_preload(set, previous - set->slots, (next->index + 1) % set->count);
+	return (true);
+}
+
+/**
+ * level_switch - Plays the level loading into a slot, or the first of the
+ *		levels after it that loads.
+ * @game: Pointer to the Game structure playing a level set.
+ * @level: Pointer to the slot, loading or loaded.
+ *
+ * Waits for the loader. A level that fails to load is skipped and the
+ * next one of the manifest loaded in its place, until one loads or every
+ * level was tried; the game keeps its level until then.
+ *
+ * Return: true if a level of the slot is now played, false otherwise.
+ */
+static bool level_switch(struct Game *game, struct Level *level)
+{
+	struct LevelSet *set = game->levels;
+	int attempts = 0;
+
+	while (true)
+	{
+		if (set->loader)
+			SDL_WaitThread(set->loader, NULL);
+		set->loader = NULL;
+		if (level_activate(game, level))
+			return (true);
+		if (level->wall_texture)
+			SDL_DestroyTexture(level->wall_texture);
+		level->wall_texture = NULL;
+		if (++attempts == set->count || !level_preload(set,
+					level - set->slots, (level->index + 1) % set->count))
+			return (false);
+	}
+}
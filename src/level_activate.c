@@ -0,0 +1,78 @@
+#include "../inc/game.h"
+
+static bool level_upload_texture(struct Game *game, struct Level *level);
+
+/**
+ * level_activate - Makes a loaded level the one being played.
+ * @game: Pointer to the Game structure.
+ * @level: Pointer to the Level, LEVEL_READY unless loading failed.
+ *
+ * Uploading the wall texture is the only work left to this thread.
+ * Players go back to the spawn tile, every camera recasts and the level
+ * starts unexplored, with no snapshot history. The texture and fog are
+ * made ready before the game points at the level, so a failed switch
+ * leaves the old level in play.
+ *
+ * Return: true on success, false if the level failed to load, or its
+ * texture or fog could not be created.
+ */
+bool level_activate(struct Game *game, struct Level *level)
+{
+	int i;
+
+	if (SDL_AtomicGet(&level->state) != LEVEL_READY)
+	{
+		fprintf(stderr, "Unable to load level %s\n", level->entry->map_path);
+		return (false);
+	}
+	if (!level_upload_texture(game, level) ||
+			!fog_reset(game, level->width, level->height))
+		return (false);
+	game->wall_texture = level->wall_texture ? level->wall_texture :
+		game->levels->default_wall_texture;
+	game->map = level->map;
+	game->map_width = level->width;
+	game->map_height = level->height;
+	game->map_max_top = level->max_top;
+	game->map_has_heights = level->has_heights;
+	game->map_has_layers = level->has_layers;
+	game->pathfinder = level->pathfinder;
+	game->lighting = level->lighting;
+	game->map_revision++;
+	snapshot_reset(game->snapshots);
+	for (i = 0; i < game->player_count; i++)
+	{
+		game->players[i].x = TILE_SIZE + TILE_SIZE / 2;
+		game->players[i].y = TILE_SIZE + TILE_SIZE / 2;
+	}
+	return (true);
+}
+
+/**
+ * level_upload_texture - Creates the wall texture of a level from the
+ *		pixels its loader decoded.
+ * @game: Pointer to the Game structure, its renderer created.
+ * @level: Pointer to the loaded Level.
+ *
+ * A level without its own texture, or whose texture was already
+ * uploaded, is left alone.
+ *
+ * Return: true on success, false if the texture could not be created.
+ */
+static bool level_upload_texture(struct Game *game, struct Level *level)
+{
+	if (!level->pixels || level->wall_texture)
+		return (true);
+	level->wall_texture = SDL_CreateTexture(game->renderer,
+			SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+			level->texture_width, level->texture_height);
+	if (!level->wall_texture || SDL_UpdateTexture(level->wall_texture,
+				NULL, level->pixels,
+				level->texture_width * sizeof(*level->pixels)) != 0)
+	{
+		fprintf(stderr, "Unable to create texture for level %s! Error: %s\n",
+				level->entry->map_path, SDL_GetError());
+		return (false);
+	}
+	return (true);
+}
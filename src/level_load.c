@@ -0,0 +1,178 @@
+#include "../inc/game.h"
+
+static int level_load(void *data);
+static SDL_Surface *level_load_surface(const char *path);
+static bool level_store(struct Level *level, const struct Game *scratch,
+		const SDL_Surface *surface);
+static bool level_light(struct Level *level);
+
+/**
+ * level_preload - Starts loading a level into a slot in the background.
+ * @set: Pointer to the LevelSet; no other load may be running.
+ * @slot: Slot to load into; it must not be the current one.
+ * @index: Manifest index of the level.
+ *
+ * The slot keeps its arena block, so loading a level no larger than the
+ * previous one of the slot allocates nothing.
+ *
+ * Return: true if the loader thread started, false otherwise.
+ */
+bool level_preload(struct LevelSet *set, int slot, int index)
+{
+	struct Level *level = &set->slots[slot];
+
+	level->index = index;
+	level->entry = &set->entries[index];
+	level->map = NULL;
+	level->pathfinder = NULL;
+	level->lighting = NULL;
+	level->pixels = NULL;
+	SDL_AtomicSet(&level->state, LEVEL_LOADING);
+	set->loader = SDL_CreateThread(level_load, "level", level);
+	if (!set->loader)
+	{
+		SDL_AtomicSet(&level->state, LEVEL_FAILED);
+		fprintf(stderr, "Error starting the level loader\n");
+	}
+	return (set->loader != NULL);
+}
+
+/**
+ * level_load - Loader thread building one level.
+ * @data: Pointer to the Level, in the LEVEL_LOADING state.
+ *
+ * The map is parsed or generated, moved into the level arena with the
+ * wall texture pixels, and the pathfinder and the lightmap are built in
+ * the same arena. A level too large for a pathfinder, or whose
+ * pathfinder fails, is played without one. Nothing here touches the
+ * renderer.
+ *
+ * Return: Always 0.
+ */
+static int level_load(void *data)
+{
+	struct Level *level = data;
+	struct Game scratch = {0};
+	SDL_Surface *surface = NULL;
+	bool ok;
+
+	ok = parse_map_file(&scratch, level->entry->map_path);
+	if (ok)
+		map_measure_cells(&scratch);
+	ok = ok && (!level->entry->texture_path[0] ||
+		 (surface = level_load_surface(level->entry->texture_path))) &&
+		level_store(level, &scratch, surface);
+	if (ok && PATH_FITS(level->width, level->height))
+		level->pathfinder = pathfinder_create(level->map, level->width,
+				level->height, &level->arena);
+	if (ok && !level->pathfinder)
+		fprintf(stderr, "No pathfinding for level %s\n",
+				level->entry->map_path);
+	ok = ok && level_light(level);
+	if (!ok && level->arena.base)
+		arena_reset(&level->arena);
+	SDL_FreeSurface(surface);
+	free(scratch.map);
+	SDL_AtomicSet(&level->state, ok ? LEVEL_READY : LEVEL_FAILED);
+	return (0);
+}
+
+/**
+ * level_load_surface - Loads an image as 32-bit ARGB pixels.
+ * @path: Path to the image file.
+ *
+ * Return: The converted surface, or NULL on failure.
+ */
+static SDL_Surface *level_load_surface(const char *path)
+{
+	SDL_Surface *loaded = IMG_Load(path), *converted = NULL;
+
+	if (loaded)
+		converted = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_ARGB8888, 0);
+	SDL_FreeSurface(loaded);
+	if (!converted)
+		fprintf(stderr, "Unable to load image %s! Error: %s\n",
+				path, IMG_GetError());
+	return (converted);
+}
+
+/**
+ * level_store - Sizes the level arena and copies the map and the wall
+ *		texture pixels into it.
+ * @level: Pointer to the Level.
+ * @scratch: Game holding the freshly loaded and measured map.
+ * @surface: ARGB8888 wall texture, or NULL for the default one.
+ *
+ * The arena is sized for the worst case of the HPA* graph, where every
+ * cluster border tile is a node linked to every other node of its
+ * cluster. Untouched pages of the block are never committed, so the
+ * reservation costs address space rather than memory.
+ *
+ * Return: true on success, false on allocation failure.
+ */
+static bool level_store(struct Level *level, const struct Game *scratch,
+		const SDL_Surface *surface)
+{
+	size_t tiles = (size_t)scratch->map_width * scratch->map_height;
+	size_t clusters = (size_t)((scratch->map_width + PATH_CLUSTER_SIZE - 1) /
+			PATH_CLUSTER_SIZE) * ((scratch->map_height + PATH_CLUSTER_SIZE - 1)
+				/ PATH_CLUSTER_SIZE);
+	size_t pixels = surface ? (size_t)surface->w * surface->h : 0;
+	int lights = lighting_count(scratch->map, scratch->map_width,
+			scratch->map_height);
+	size_t size = tiles * sizeof(*level->map) +
+		(PATH_FITS(scratch->map_width, scratch->map_height) ? tiles *
+		 PATH_TILE_BYTES + clusters * LEVEL_CLUSTER_BYTES +
+		 sizeof(struct Pathfinder) + PATH_SCRATCH_BYTES : 0) +
+		pixels * sizeof(*level->pixels) +
+		(lights ? LIGHTING_BYTES(lights, tiles) : 0) + 64 * ARENA_ALIGNMENT;
+	int y;
+
+	if (level->arena.size < size)
+	{
+		arena_free(&level->arena);
+		if (!arena_init(&level->arena, size))
+			return (false);
+	}
+	arena_reset(&level->arena);
+	level->map = arena_alloc(&level->arena, tiles * sizeof(*level->map));
+	level->pixels = pixels ? arena_alloc(&level->arena,
+			pixels * sizeof(*level->pixels)) : NULL;
+	if (!level->map || (pixels && !level->pixels))
+		return (false);
+	memcpy(level->map, scratch->map, tiles * sizeof(*level->map));
+	level->width = scratch->map_width;
+	level->height = scratch->map_height;
+	level->max_top = scratch->map_max_top;
+	level->has_heights = scratch->map_has_heights;
+	level->has_layers = scratch->map_has_layers;
+	level->texture_width = surface ? surface->w : 0;
+	level->texture_height = surface ? surface->h : 0;
+	for (y = 0; y < level->texture_height; y++)
+		memcpy(level->pixels + (size_t)y * surface->w,
+				(const Uint8 *)surface->pixels + (size_t)y * surface->pitch,
+				surface->w * sizeof(*level->pixels));
+	return (true);
+}
+
+/**
+ * level_light - Bakes the lightmap of a level with lights.
+ * @level: Pointer to the Level, its map stored.
+ *
+ * The loader thread runs the bake on a pool of its own: the render pool
+ * belongs to the main thread.
+ *
+ * Return: true on success or for a level without lights, false on failure.
+ */
+static bool level_light(struct Level *level)
+{
+	struct JobPool *jobs;
+
+	if (!lighting_count(level->map, level->width, level->height))
+		return (true);
+	jobs = job_pool_create(job_pool_default_threads());
+	level->lighting = lighting_create(level->map, level->width, level->height,
+			jobs, &level->arena);
+	job_pool_destroy(jobs);
+	return (level->lighting != NULL);
+}
@@ -0,0 +1,87 @@
+#include "../inc/game.h"
+
+/**
+ * level_read_manifest - Reads the levels of a manifest file.
+ * @set: Pointer to the LevelSet receiving the entries.
+ * @path: Path to the manifest.
+ *
+ * Every non-empty line not starting with '#' is one level: a map file or
+ * maze specification, optionally followed by a wall texture path.
+ * Streamed worlds and nested manifests are refused.
+ *
+ * Return: true if the manifest lists at least one valid level.
+ */
+bool level_read_manifest(struct LevelSet *set, const char *path)
+{
+	char *line = NULL, map_path[LEVEL_PATH_SIZE], texture_path[LEVEL_PATH_SIZE];
+	size_t line_capacity = 0;
+	int fields, capacity = 0;
+	struct LevelEntry *grown;
+	bool ok = true;
+	FILE *file = fopen(path, "r");
+
+	if (!file)
+	{
+		fprintf(stderr, "Error opening level manifest: %s\n", path);
+		return (false);
+	}
+	while (ok && getline(&line, &line_capacity, file) != -1)
+	{
+		fields = sscanf(line, LEVEL_MANIFEST_FORMAT, map_path, texture_path);
+		if (fields < 1 || map_path[0] == '#')
+			continue;
+		ok = strncmp(map_path, WORLD_SPEC_PREFIX,
+				strlen(WORLD_SPEC_PREFIX)) != 0 && strncmp(map_path,
+					LEVEL_SPEC_PREFIX, strlen(LEVEL_SPEC_PREFIX)) != 0;
+		if (ok && set->count == capacity)
+		{
+			capacity = capacity ? capacity * 2 : 8;
+			grown = realloc(set->entries, capacity * sizeof(*grown));
+			ok = grown != NULL;
+			set->entries = ok ? grown : set->entries;
+		}
+		if (ok)
+		{
+			strcpy(set->entries[set->count].map_path, map_path);
+			strcpy(set->entries[set->count++].texture_path,
+					fields == 2 ? texture_path : "");
+		}
+	}
+	free(line);
+	fclose(file);
+	if (!ok || set->count == 0)
+		fprintf(stderr, "Invalid level manifest: %s\n", path);
+	return (ok && set->count > 0);
+}
+
+/**
+ * level_set_memory - Reports the memory used by a level.
+ * @set: Pointer to the LevelSet.
+ * @index: Manifest index of the level.
+ * @reserved: Pointer to store the size of the level's arena block, may
+ *		be NULL.
+ *
+ * Return: Bytes of the level arena in use, 0 if the level is neither the
+ * current one nor fully preloaded.
+ */
+size_t level_set_memory(const struct LevelSet *set, int index,
+		size_t *reserved)
+{
+	const struct Level *level;
+	int i;
+
+	for (i = 0; i < LEVEL_SLOTS; i++)
+	{
+		level = &set->slots[i];
+		if (level->index == index &&
+				SDL_AtomicGet((SDL_atomic_t *)&level->state) == LEVEL_READY)
+		{
+			if (reserved)
+				*reserved = level->arena.size;
+			return (level->arena.used);
+		}
+	}
+	if (reserved)
+		*reserved = 0;
+	return (0);
+}
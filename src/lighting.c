@@ -0,0 +1,143 @@
+#include "../inc/lighting.h"
+
+/**
+ * lighting_count - Counts the lights of a map.
+ * @map: Row-major tiles.
+ * @width: Number of tiles per row.
+ * @height: Number of rows.
+ *
+ * Return: Number of tiles holding a light.
+ */
+int lighting_count(const int *map, int width, int height)
+{
+	size_t i, tiles = (size_t)width * height;
+	int count = 0;
+
+	for (i = 0; i < tiles; i++)
+		if (map[i] & MAP_LIGHT_FLAG)
+			count++;
+	return (count);
+}
+
+/**
+ * lighting_create - Bakes the lightmap of a map.
+ * @map: Row-major tiles, kept for the lanterns' shadows.
+ * @width: Number of tiles per row.
+ * @height: Number of rows.
+ * @jobs: Pool baking rows of tiles in parallel, NULL to bake inline.
+ * @parent: Arena to carve the lighting from, or NULL to use malloc.
+ *
+ * Every tile marked MAP_LIGHT_FLAG holds a static light at its center.
+ * The lanterns start off.
+ *
+ * Return: Pointer to the Lighting, or NULL on failure.
+ */
+struct Lighting *lighting_create(const int *map, int width, int height,
+		struct JobPool *jobs, struct Arena *parent)
+{
+	size_t tiles = (size_t)width * height;
+	int count = lighting_count(map, width, height);
+	struct Lighting *lighting = parent ?
+		arena_calloc(parent, 1, sizeof(*lighting)) :
+		calloc(1, sizeof(*lighting));
+	Uint64 start = SDL_GetPerformanceCounter();
+
+	if (!lighting)
+		return (NULL);
+	lighting->parent = parent;
+	if (!arena_init_from(&lighting->arena, parent, LIGHTING_BYTES(count,
+					tiles) - sizeof(*lighting)) ||
+			!(lighting->lights = arena_calloc(&lighting->arena,
+					count + MAX_PLAYERS, sizeof(*lighting->lights))) ||
+			!(lighting->baked = arena_alloc(&lighting->arena,
+					tiles * LIGHT_FACES)) ||
+			!(lighting->lightmap = arena_alloc(&lighting->arena,
+					tiles * LIGHT_FACES)))
+	{
+		lighting_destroy(lighting);
+		return (NULL);
+	}
+	lighting->map = map;
+	lighting->width = width;
+	lighting->height = height;
+	lighting_place(lighting, count);
+	lighting->last_x = width;
+	lighting->last_y = height;
+	lighting_bake(lighting, false, jobs);
+	memcpy(lighting->lightmap, lighting->baked, tiles * LIGHT_FACES);
+	lighting->bake_ms = (SDL_GetPerformanceCounter() - start) * 1000.0 /
+		SDL_GetPerformanceFrequency();
+	return (lighting);
+}
+
+/**
+ * lighting_destroy - Releases a lighting.
+ * @lighting: Pointer to the Lighting, may be NULL; a lighting carved from
+ *		a parent arena is left to that arena.
+ */
+void lighting_destroy(struct Lighting *lighting)
+{
+	if (!lighting || lighting->parent)
+		return;
+	arena_free(&lighting->arena);
+	free(lighting);
+}
+
+/**
+ * lighting_move - Moves, lights or puts out a player's lantern.
+ * @lighting: Pointer to the Lighting.
+ * @lantern: Index of the player carrying the lantern.
+ * @x: New x coordinate, in world units.
+ * @y: New y coordinate, in world units.
+ * @on: Whether the lantern shines.
+ * @jobs: Pool relighting rows of tiles in parallel, may be NULL.
+ *
+ * Moves shorter than LIGHT_MOVE_STEP are ignored. Otherwise only the
+ * tiles the lantern reached before or reaches now are relit.
+ *
+ * Return: true if the lightmap changed, false otherwise.
+ */
+bool lighting_move(struct Lighting *lighting, int lantern, float x, float y,
+		bool on, struct JobPool *jobs)
+{
+	struct Light *light = &lighting->lights[lighting->static_count + lantern];
+
+	if (on == light->on && (!on || (fabsf(x - light->x) < LIGHT_MOVE_STEP &&
+					fabsf(y - light->y) < LIGHT_MOVE_STEP)))
+		return (false);
+	lighting->first_x = lighting->width;
+	lighting->first_y = lighting->height;
+	lighting->last_x = 0;
+	lighting->last_y = 0;
+	if (light->on)
+		lighting_include(lighting, light);
+	light->x = x;
+	light->y = y;
+	light->on = on;
+	if (on)
+		lighting_include(lighting, light);
+	lighting_bake(lighting, true, jobs);
+	return (true);
+}
+
+/**
+ * lighting_at - Reads the light level of a tile face.
+ * @lighting: Pointer to the Lighting, NULL for an unlit map.
+ * @map_x: Tile column.
+ * @map_y: Tile row.
+ * @face: Face of the tile.
+ *
+ * Return: Light level, 255 being full brightness; 255 everywhere on an
+ * unlit map, LIGHT_AMBIENT outside a lit one.
+ */
+int lighting_at(const struct Lighting *lighting, int map_x, int map_y,
+		enum LightFace face)
+{
+	if (!lighting)
+		return (255);
+	if (map_x < 0 || map_x >= lighting->width || map_y < 0 ||
+			map_y >= lighting->height)
+		return (LIGHT_AMBIENT);
+	return (lighting->lightmap[((size_t)map_y * lighting->width + map_x) *
+			LIGHT_FACES + face]);
+}
@@ -0,0 +1,132 @@
+#include "../inc/lighting.h"
+
+static void lighting_job(void *context, int index);
+static int lighting_face(const struct Lighting *lighting, int map_x,
+		int map_y, enum LightFace face, int first, int last);
+static int lighting_first(const struct Lighting *lighting, float y);
+
+/**
+ * lighting_bake - Lights the current region of a lighting.
+ * @lighting: Pointer to the Lighting, its region set.
+ * @dynamic: false to bake the static lights into the baked map, true to
+ *		add the lanterns to it in the lightmap.
+ * @jobs: Pool lighting LIGHT_BAKE_ROWS rows per job, NULL to run inline.
+ *
+ * Jobs write disjoint rows and only read the map and the lights, so they
+ * need no locking. Each job only weighs the static lights close enough
+ * to its rows to reach them.
+ */
+void lighting_bake(struct Lighting *lighting, bool dynamic,
+		struct JobPool *jobs)
+{
+	int rows = lighting->last_y - lighting->first_y;
+
+	if (rows <= 0 || lighting->last_x <= lighting->first_x)
+		return;
+	lighting->dynamic = dynamic;
+	job_pool_run(jobs, lighting_job, lighting,
+			(rows + LIGHT_BAKE_ROWS - 1) / LIGHT_BAKE_ROWS);
+}
+
+/**
+ * lighting_job - Lights every face of a band of rows of the region.
+ * @context: Pointer to the Lighting.
+ * @index: Index of the band.
+ */
+static void lighting_job(void *context, int index)
+{
+	struct Lighting *lighting = context;
+	int y = lighting->first_y + index * LIGHT_BAKE_ROWS, x, face, level;
+	int last_y = SDL_min(y + LIGHT_BAKE_ROWS, lighting->last_y);
+	int first = lighting_first(lighting, (y - 1) * TILE_SIZE - LIGHT_RADIUS);
+	int last = lighting_first(lighting, (last_y + 1) * TILE_SIZE +
+			LIGHT_RADIUS);
+	size_t slot;
+
+	for (; y < last_y; y++)
+		for (x = lighting->first_x; x < lighting->last_x; x++)
+			for (face = 0; face < LIGHT_FACES; face++)
+			{
+				slot = ((size_t)y * lighting->width + x) * LIGHT_FACES + face;
+				if (lighting->dynamic)
+					level = lighting->baked[slot] + lighting_face(lighting, x, y,
+							face, lighting->static_count, lighting->count);
+				else
+					level = LIGHT_AMBIENT + lighting_face(lighting, x, y, face,
+							first, last);
+				(lighting->dynamic ? lighting->lightmap : lighting->baked)[slot] =
+					level > 255 ? 255 : level;
+			}
+}
+
+/**
+ * lighting_face - Adds up the light a range of lights sheds on a face.
+ * @lighting: Pointer to the Lighting.
+ * @map_x: Tile column.
+ * @map_y: Tile row.
+ * @face: Face of the tile.
+ * @first: First light of the range.
+ * @last: Light after the last one of the range.
+ *
+ * A face is sampled at its middle, just outside the tile for side
+ * faces. Light falls off with the square of the distance left to the
+ * light's radius, side faces only catch it in front of them, and a
+ * shadow ray through the grid drops lights a wall stands in front of.
+ *
+ * Return: Light added, not clamped.
+ */
+static int lighting_face(const struct Lighting *lighting, int map_x,
+		int map_y, enum LightFace face, int first, int last)
+{
+	static const float sample[LIGHT_FACES][2] = {{0.5f, 0.5f},
+		{-LIGHT_FACE_OFFSET, 0.5f}, {1 + LIGHT_FACE_OFFSET, 0.5f},
+		{0.5f, -LIGHT_FACE_OFFSET}, {0.5f, 1 + LIGHT_FACE_OFFSET}};
+	static const float normal[LIGHT_FACES][2] = {{0, 0}, {-1, 0}, {1, 0},
+		{0, -1}, {0, 1}};
+	float x = map_x + sample[face][0], y = map_y + sample[face][1];
+	float dx, dy, distance, falloff, facing, total = 0;
+	const struct Light *light;
+
+	for (light = lighting->lights + first; light < lighting->lights + last;
+			light++)
+	{
+		if (!light->on)
+			continue;
+		dx = light->x / TILE_SIZE - x;
+		dy = light->y / TILE_SIZE - y;
+		distance = sqrtf(dx * dx + dy * dy);
+		falloff = 1 - distance * TILE_SIZE / light->radius;
+		facing = face == LIGHT_TOP ? 1 : (dx * normal[face][0] +
+				dy * normal[face][1]) / fmaxf(distance, LIGHT_FACE_OFFSET);
+		if (falloff <= 0 || facing <= 0 || !lighting_visible(lighting,
+					light->x / TILE_SIZE, light->y / TILE_SIZE, x, y))
+			continue;
+		total += light->intensity * falloff * falloff * facing;
+	}
+	return ((int)total);
+}
+
+/**
+ * lighting_first - Finds the first static light at or below a row.
+ * @lighting: Pointer to the Lighting.
+ * @y: y coordinate, in world units.
+ *
+ * Static lights are stored in map order, so sorted by y.
+ *
+ * Return: Index of the first static light whose y is at least @y,
+ * static_count if there is none.
+ */
+static int lighting_first(const struct Lighting *lighting, float y)
+{
+	int low = 0, high = lighting->static_count, middle;
+
+	while (low < high)
+	{
+		middle = (low + high) / 2;
+		if (lighting->lights[middle].y < y)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return (low);
+}
@@ -0,0 +1,46 @@
+#include "../inc/lighting.h"
+
+/**
+ * lighting_place - Places the static lights of the map and the lanterns.
+ * @lighting: Pointer to the Lighting, its map set and its lights empty.
+ * @count: Number of static lights, as counted by lighting_count().
+ */
+void lighting_place(struct Lighting *lighting, int count)
+{
+	size_t i, tiles = (size_t)lighting->width * lighting->height;
+
+	for (i = 0; i < tiles; i++)
+		if (lighting->map[i] & MAP_LIGHT_FLAG)
+			lighting->lights[lighting->count++] = (struct Light){
+				(i % lighting->width + 0.5f) * TILE_SIZE,
+				(i / lighting->width + 0.5f) * TILE_SIZE,
+				LIGHT_RADIUS, LIGHT_INTENSITY, true};
+	lighting->static_count = lighting->count;
+	while (lighting->count < count + MAX_PLAYERS)
+		lighting->lights[lighting->count++] = (struct Light){0, 0,
+			LANTERN_RADIUS, LANTERN_INTENSITY, false};
+}
+
+/**
+ * lighting_include - Grows the region being lit to cover a light's reach.
+ * @lighting: Pointer to the Lighting.
+ * @light: Pointer to the Light.
+ *
+ * One tile of margin covers the side faces of the tiles next to the
+ * reach, which are lit from outside their tile.
+ */
+void lighting_include(struct Lighting *lighting,
+		const struct Light *light)
+{
+	int first_x = (int)floorf((light->x - light->radius) / TILE_SIZE) - 1;
+	int first_y = (int)floorf((light->y - light->radius) / TILE_SIZE) - 1;
+	int last_x = (int)floorf((light->x + light->radius) / TILE_SIZE) + 2;
+	int last_y = (int)floorf((light->y + light->radius) / TILE_SIZE) + 2;
+
+	lighting->first_x = SDL_max(0, SDL_min(lighting->first_x, first_x));
+	lighting->first_y = SDL_max(0, SDL_min(lighting->first_y, first_y));
+	lighting->last_x = SDL_min(lighting->width, SDL_max(lighting->last_x,
+				last_x));
+	lighting->last_y = SDL_min(lighting->height, SDL_max(lighting->last_y,
+				last_y));
+}
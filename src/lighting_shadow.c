@@ -0,0 +1,24 @@
+#include "../inc/lighting.h"
+#include "../inc/map.h"
+
+/**
+ * lighting_visible - Casts a shadow ray through the grid.
+ * @lighting: Pointer to the Lighting.
+ * @from_x: Light x coordinate, in tiles.
+ * @from_y: Light y coordinate, in tiles.
+ * @to_x: Lit point x coordinate, in tiles.
+ * @to_y: Lit point y coordinate, in tiles.
+ *
+ * Walls, thin walls and tiles outside the map block light; grates let
+ * it through. The tiles of both ends never block, so a light shines on
+ * the top of the wall it stands next to, and the top of a wall is lit by
+ * the lights that see it.
+ *
+ * Return: true if no tile between the two points blocks light.
+ */
+bool lighting_visible(const struct Lighting *lighting, float from_x,
+		float from_y, float to_x, float to_y)
+{
+	return (map_segment_clear(lighting->map, lighting->width,
+				lighting->height, from_x, from_y, to_x, to_y));
+}
@@ -2,8 +2,7 @@
 
 static void handle_event(struct Game *game, SDL_Event *event);
 static void update_game_state(struct Game *game);
-static void render_game(struct Game *game, float ray_ends_x[],
-		float ray_ends_y[]);
+static void render_game(struct Game *game);
 
 /**
  * main - Entry point for the game.
@@ -15,33 +14,41 @@ static void render_game(struct Game *game, float ray_ends_x[],
 int main(int argc, char *argv[])
 {
 	struct Game game = {0};
-	float ray_ends_x[NUM_RAYS];
-	float ray_ends_y[NUM_RAYS];
 	SDL_Event event;
 
-	if (argc != 2)
+	if (!parse_options(argc, argv, &game.options))
 	{
-		fprintf(stderr, "Usage: %s <map_file_path>\n", argv[0]);
+		print_usage(argv[0]);
 		return (EXIT_FAILURE);
 	}
 	game.previous_time = SDL_GetTicks();
-	putenv("SDL_AUDIODRIVER=alsa");
+	setenv("SDL_AUDIODRIVER", "alsa", 0);
 
-	if (sdl_initialize(&game, argv[1]))
+	if (sdl_initialize(&game, game.options.map_path))
 		game_cleanup(&game, EXIT_FAILURE);
 
 	game.keyboard_state = SDL_GetKeyboardState(NULL);
 
 	while (true)
 	{
+		if (game.options.low_latency)
+			pacing_wait(&game);
 		update_game_state(&game);
+		game.pacing.sample_start = SDL_GetPerformanceCounter();
 
 		while (SDL_PollEvent(&event))
 			handle_event(&game, &event);
 
-		handle_input(&game);
-		render_game(&game, ray_ends_x, ray_ends_y);
-		SDL_Delay(16);
+		if (!game.client)
+			handle_input(&game);
+		net_frame(&game);
+		snapshot_frame(&game);
+		update_world(&game);
+		update_lights(&game);
+		audio_update(&game);
+		render_game(&game);
+		if (!game.options.low_latency)
+			SDL_Delay(FRAME_PERIOD_MS);
 	}
 	game_cleanup(&game, EXIT_SUCCESS);
 	return (0);
@@ -55,6 +62,7 @@ int main(int argc, char *argv[])
  */
 static void handle_event(struct Game *game, SDL_Event *event)
 {
+	pacing_input(game, event);
 	if (event->type == SDL_QUIT)
 		game_cleanup(game, EXIT_SUCCESS);
 	else if (event->type == SDL_KEYDOWN)
@@ -69,6 +77,23 @@ static void handle_event(struct Game *game, SDL_Event *event)
 				break;
 			case SDL_SCANCODE_P:
 				game->current_weapon = (game->current_weapon + 1) % 3;
+				audio_click(game);
+				break;
+			case SDL_SCANCODE_N:
+				if (game->levels)
+					level_set_next(game);
+				break;
+			case SDL_SCANCODE_F:
+				game->lantern = !game->lantern;
+				audio_click(game);
+				break;
+			case SDL_SCANCODE_F5:
+				if (game->snapshots)
+					snapshot_save(game, SNAPSHOT_SAVE_PATH);
+				break;
+			case SDL_SCANCODE_F9:
+				if (game->snapshots)
+					snapshot_load(game, SNAPSHOT_SAVE_PATH);
 				break;
 			default:
 				break;
@@ -90,22 +115,35 @@ static void update_game_state(struct Game *game)
 /**
  * render_game - Renders the game.
  * @game: Pointer to the Game structure.
- * @ray_ends_x: Array of x coordinates where rays end.
- * @ray_ends_y: Array of y coordinates where rays end.
+ *
+ * A captured frame is drawn to a texture of the capture, put on screen
+ * and read back one frame later, by when the GPU has finished it.
  */
-static void render_game(struct Game *game, float ray_ends_x[],
-		float ray_ends_y[])
+static void render_game(struct Game *game)
 {
+	long cast = game->stats.columns_cast;
+	Uint64 start, present;
+
+	if (game->capture)
+		capture_begin(game->capture);
 	SDL_SetRenderDrawColor(game->renderer, 0, 0, 0, 255);
 	SDL_RenderClear(game->renderer);
 
-	cast_rays(game, ray_ends_x, ray_ends_y);
-
-	SDL_RenderSetViewport(game->renderer, NULL);
-
-	if (game->show_map)
-		draw_2d_map(game);
+	render_cameras(game);
+	cast = game->stats.columns_cast - cast;
 
-	draw_weapon(game);
+	if (game->capture)
+	{
+		start = SDL_GetPerformanceCounter();
+		if (!capture_frame(game->capture))
+			game->stats.frames_dropped++;
+		game->stats.capture_ticks += SDL_GetPerformanceCounter() - start;
+	}
+	start = SDL_GetPerformanceCounter();
 	SDL_RenderPresent(game->renderer);
+	present = SDL_GetPerformanceCounter() - start;
+	pacing_present(game);
+	if (game->metrics)
+		metrics_frame(game, present, cast);
+	stats_frame_end(game);
 }
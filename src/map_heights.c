@@ -0,0 +1,54 @@
+#include "../inc/game.h"
+
+/**
+ * map_cell_top - Height of the top of one map cell.
+ * @game: Pointer to the Game structure.
+ * @map_x: Tile column.
+ * @map_y: Tile row.
+ *
+ * A wall without a height of its own is one tile tall; a floor without
+ * one lies at ground level. Cells outside the map and world chunks are
+ * plain walls.
+ *
+ * Return: Height of the cell's top surface, in world units.
+ */
+int map_cell_top(const struct Game *game, int map_x, int map_y)
+{
+	int cell, height;
+
+	if (!map_in_bounds(game, map_x, map_y) || game->world)
+		return (map_cell(game, map_x, map_y) == MAP_WALL ? TILE_SIZE : 0);
+	cell = game->map[map_y * game->map_width + map_x];
+	height = MAP_CELL_HEIGHT(cell) * TILE_SIZE / MAP_HEIGHT_UNITS;
+	if (MAP_CELL_TYPE(cell) == MAP_WALL && height == 0)
+		return (TILE_SIZE);
+	return (height);
+}
+
+/**
+ * map_measure_cells - Finds the tallest cell of the loaded map and
+ *		whether rays can cross any cell.
+ * @game: Pointer to the Game structure; sets map_max_top, map_has_heights
+ *		and map_has_layers.
+ */
+void map_measure_cells(struct Game *game)
+{
+	size_t i, tiles = game->map ? (size_t)game->map_width * game->map_height : 0;
+	int top;
+
+	game->map_max_top = TILE_SIZE;
+	game->map_has_heights = false;
+	game->map_has_layers = false;
+	for (i = 0; i < tiles; i++)
+	{
+		if (MAP_CELL_TYPE(game->map[i]) != MAP_WALL &&
+				MAP_CELL_TYPE(game->map[i]) != MAP_FLOOR)
+			game->map_has_layers = true;
+		if (MAP_CELL_HEIGHT(game->map[i]) == 0)
+			continue;
+		game->map_has_heights = true;
+		top = map_cell_top(game, i % game->map_width, i / game->map_width);
+		if (top > game->map_max_top)
+			game->map_max_top = top;
+	}
+}
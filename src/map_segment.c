@@ -0,0 +1,108 @@
+#include "../inc/map.h"
+
+/**
+ * struct SegmentGrid - The grid a clear segment is checked against
+ * @map: cells, row by row
+ * @width: width of the grid, in tiles
+ * @height: height of the grid, in tiles
+ */
+struct SegmentGrid
+{
+	const int *map;
+	int width;
+	int height;
+};
+
+static bool map_segment_open(int map_x, int map_y, void *data);
+
+/**
+ * map_segment_walk - Visits the tiles a segment crosses between its ends.
+ * @from_x: x coordinate of the first end, in tiles.
+ * @from_y: y coordinate of the first end, in tiles.
+ * @to_x: x coordinate of the second end, in tiles.
+ * @to_y: y coordinate of the second end, in tiles.
+ * @visit: Called on each tile in order, nearest @from first; the walk
+ *		stops when it returns false.
+ * @data: Passed to @visit.
+ *
+ * The tiles of both ends are never visited.
+ *
+ * Return: true if the walk reached the second end, false if @visit
+ * stopped it.
+ */
+bool map_segment_walk(float from_x, float from_y, float to_x, float to_y,
+		bool (*visit)(int map_x, int map_y, void *data), void *data)
+{
+	float dir_x = to_x - from_x, dir_y = to_y - from_y;
+	float delta_x = dir_x ? fabsf(1 / dir_x) : HUGE_VALF;
+	float delta_y = dir_y ? fabsf(1 / dir_y) : HUGE_VALF;
+	int map_x = (int)floorf(from_x), map_y = (int)floorf(from_y);
+	int target_x = (int)floorf(to_x), target_y = (int)floorf(to_y);
+	float side_x = dir_x ? (dir_x < 0 ? from_x - map_x : map_x + 1 - from_x) *
+		delta_x : HUGE_VALF;
+	float side_y = dir_y ? (dir_y < 0 ? from_y - map_y : map_y + 1 - from_y) *
+		delta_y : HUGE_VALF;
+
+	while (fminf(side_x, side_y) < 1)
+	{
+		if (side_x < side_y)
+		{
+			side_x += delta_x;
+			map_x += dir_x < 0 ? -1 : 1;
+		}
+		else
+		{
+			side_y += delta_y;
+			map_y += dir_y < 0 ? -1 : 1;
+		}
+		if (map_x == target_x && map_y == target_y)
+			return (true);
+		if (!visit(map_x, map_y, data))
+			return (false);
+	}
+	return (true);
+}
+
+/**
+ * map_segment_clear - Checks that no wall stands between two points.
+ * @map: Cells of the map, row by row.
+ * @width: Width of the map, in tiles.
+ * @height: Height of the map, in tiles.
+ * @from_x: x coordinate of the first point, in tiles.
+ * @from_y: y coordinate of the first point, in tiles.
+ * @to_x: x coordinate of the second point, in tiles.
+ * @to_y: y coordinate of the second point, in tiles.
+ *
+ * Walls, whatever their height, thin walls and tiles outside the map
+ * block the segment; grates do not. The tiles of both ends never block.
+ *
+ * Return: true if the points see each other, false otherwise.
+ */
+bool map_segment_clear(const int *map, int width, int height, float from_x,
+		float from_y, float to_x, float to_y)
+{
+	struct SegmentGrid grid = {map, width, height};
+
+	return (map_segment_walk(from_x, from_y, to_x, to_y, map_segment_open,
+				&grid));
+}
+
+/**
+ * map_segment_open - Checks whether a tile lets a clear segment through.
+ * @map_x: Tile column.
+ * @map_y: Tile row.
+ * @data: Pointer to the SegmentGrid.
+ *
+ * Return: false for walls, thin walls and tiles outside the grid.
+ */
+static bool map_segment_open(int map_x, int map_y, void *data)
+{
+	const struct SegmentGrid *grid = data;
+	int type;
+
+	if (map_x < 0 || map_x >= grid->width || map_y < 0 ||
+			map_y >= grid->height)
+		return (false);
+	type = MAP_CELL_TYPE(grid->map[(size_t)map_y * grid->width + map_x]);
+	return (type != MAP_WALL && type != MAP_THIN_X && type != MAP_THIN_Y);
+}
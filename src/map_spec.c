@@ -0,0 +1,75 @@
+#include "../inc/map.h"
+#include "../inc/maze_gen.h"
+#include "../inc/world.h"
+
+/**
+ * load_generated_map - Generates a maze and installs it as the game map.
+ * @game: Pointer to the Game structure where the map will be stored.
+ * @spec_text: Maze specification, "maze:<algorithm>:<W>x<H>[:<seed>]".
+ *
+ * Return: true on success, false on an invalid spec or allocation failure.
+ */
+bool load_generated_map(struct Game *game, const char *spec_text)
+{
+	struct MazeSpec spec;
+	int width, height;
+	size_t i, size;
+	Uint8 *tiles;
+
+	if (!maze_parse_spec(spec_text, &spec))
+	{
+		fprintf(stderr, "Invalid maze specification: %s\n", spec_text);
+		return (false);
+	}
+	tiles = maze_generate(&spec, &width, &height);
+	size = (size_t)width * height;
+	free(game->map);
+	game->map = tiles ? malloc(size * sizeof(*game->map)) : NULL;
+	if (!game->map)
+	{
+		free(tiles);
+		fprintf(stderr, "Unable to generate maze %s\n", spec_text);
+		return (false);
+	}
+	for (i = 0; i < size; i++)
+		game->map[i] = tiles[i];
+	free(tiles);
+	game->map_width = width;
+	game->map_height = height;
+	return (true);
+}
+
+/**
+ * load_world_map - Installs a streamed chunked world as the game map.
+ * @game: Pointer to the Game structure; its options give the chunk cache
+ *		memory cap, WORLD_DEFAULT_CACHE_MB when unset.
+ * @spec_text: World specification, "world:<seed>[:<W>x<H>]" in chunks.
+ *
+ * Return: true on success, false on an invalid spec or allocation failure.
+ */
+bool load_world_map(struct Game *game, const char *spec_text)
+{
+	Uint64 seed;
+	int chunks_x, chunks_y;
+	int cache_mb = game->options.chunk_cache_mb > 0 ?
+		game->options.chunk_cache_mb : WORLD_DEFAULT_CACHE_MB;
+
+	if (!world_parse_spec(spec_text, &seed, &chunks_x, &chunks_y))
+	{
+		fprintf(stderr, "Invalid world specification: %s\n", spec_text);
+		return (false);
+	}
+	world_destroy(game->world);
+	game->world = world_create(seed, chunks_x, chunks_y,
+			(size_t)cache_mb << 20);
+	if (!game->world)
+	{
+		fprintf(stderr, "Unable to create world %s\n", spec_text);
+		return (false);
+	}
+	free(game->map);
+	game->map = NULL;
+	game->map_width = chunks_x * WORLD_CHUNK_SIZE;
+	game->map_height = chunks_y * WORLD_CHUNK_SIZE;
+	return (true);
+}
@@ -0,0 +1,54 @@
+#include "../inc/maze_gen.h"
+
+/**
+ * maze_backtracker - Carves a maze with an iterative recursive backtracker.
+ * @tiles: Tile grid of (2 * cells_x + 1) x (2 * cells_y + 1) walls.
+ * @cells_x: Number of cells per row.
+ * @cells_y: Number of cell rows.
+ * @rng: Pointer to the random generator.
+ *
+ * The explicit stack replaces recursion so huge mazes cannot overflow the
+ * call stack; a cell is unvisited while its own tile is still a wall.
+ *
+ * Return: true on success, false on allocation failure.
+ */
+bool maze_backtracker(Uint8 *tiles, int cells_x, int cells_y,
+		struct MazeRng *rng)
+{
+	static const int dx[4] = {1, -1, 0, 0};
+	static const int dy[4] = {0, 0, 1, -1};
+	size_t width = 2 * (size_t)cells_x + 1;
+	int *stack = malloc((size_t)cells_x * cells_y * sizeof(*stack));
+	int top = 0, cx, cy, nx, ny, dir, options[4], count;
+
+	if (!stack)
+		return (false);
+	tiles[width + 1] = MAP_FLOOR;
+	stack[top++] = 0;
+	while (top > 0)
+	{
+		cx = stack[top - 1] % cells_x;
+		cy = stack[top - 1] / cells_x;
+		for (count = 0, dir = 0; dir < 4; dir++)
+		{
+			nx = cx + dx[dir];
+			ny = cy + dy[dir];
+			if (nx >= 0 && nx < cells_x && ny >= 0 && ny < cells_y &&
+					tiles[(2 * ny + 1) * width + 2 * nx + 1] == MAP_WALL)
+				options[count++] = dir;
+		}
+		if (count == 0)
+		{
+			top--;
+			continue;
+		}
+		dir = options[maze_rng_below(rng, count)];
+		tiles[(2 * cy + 1 + dy[dir]) * width + 2 * cx + 1 + dx[dir]] = MAP_FLOOR;
+		nx = cx + dx[dir];
+		ny = cy + dy[dir];
+		tiles[(2 * ny + 1) * width + 2 * nx + 1] = MAP_FLOOR;
+		stack[top++] = ny * cells_x + nx;
+	}
+	free(stack);
+	return (true);
+}
@@ -0,0 +1,119 @@
+#include "../inc/maze_gen.h"
+
+static int eller_find(int *parent, int id);
+static bool eller_coin(struct EllerState *state, struct MazeRng *rng);
+static void eller_renumber(struct EllerState *state);
+
+/**
+ * eller_next_row - Decides the passages of the current row.
+ * @state: Pointer to the EllerState.
+ * @rng: Pointer to the random generator.
+ * @last_row: true for the bottom row, which joins every remaining set.
+ *
+ * Fills state->east and state->down for the current row, then renumbers
+ * the sets so the next row again uses ids below cells_x. Sets are merged
+ * with a union-find, so a row costs O(cells_x) whatever its set layout.
+ */
+void eller_next_row(struct EllerState *state, struct MazeRng *rng,
+		bool last_row)
+{
+	int x, a, b, id, n = state->cells_x;
+
+	for (id = 0; id < n; id++)
+	{
+		state->parent[id] = id;
+		state->count[id] = 0;
+		state->has_down[id] = 0;
+		state->remap[id] = -1;
+	}
+	for (x = 0; x < n; x++)
+	{
+		state->east[x] = 0;
+		if (x + 1 == n)
+			break;
+		a = eller_find(state->parent, state->sets[x]);
+		b = eller_find(state->parent, state->sets[x + 1]);
+		if (a != b && (last_row || eller_coin(state, rng)))
+		{
+			state->parent[b] = a;
+			state->east[x] = 1;
+		}
+	}
+	for (x = 0; x < n; x++)
+	{
+		state->sets[x] = eller_find(state->parent, state->sets[x]);
+		state->count[state->sets[x]]++;
+	}
+	for (x = 0; x < n; x++)
+	{
+		id = state->sets[x];
+		state->count[id]--;
+		state->down[x] = !last_row && (eller_coin(state, rng) ||
+				(state->count[id] == 0 && !state->has_down[id]));
+		state->has_down[id] |= state->down[x];
+	}
+	eller_renumber(state);
+}
+
+/**
+ * eller_renumber - Gives the next row's cells set ids below cells_x.
+ * @state: Pointer to the EllerState, the current row decided.
+ *
+ * A cell below a passage down keeps the set above it, renumbered in
+ * order of appearance; every other cell starts a set of its own.
+ */
+static void eller_renumber(struct EllerState *state)
+{
+	int x, next_id = 0;
+
+	for (x = 0; x < state->cells_x; x++)
+	{
+		if (!state->down[x])
+			continue;
+		if (state->remap[state->sets[x]] < 0)
+			state->remap[state->sets[x]] = next_id++;
+		state->sets[x] = state->remap[state->sets[x]];
+	}
+	for (x = 0; x < state->cells_x; x++)
+		if (!state->down[x])
+			state->sets[x] = next_id++;
+}
+
+/**
+ * eller_find - Finds the representative of a set, halving the path.
+ * @parent: Union-find parent array.
+ * @id: Set id to look up.
+ *
+ * Return: Representative set id.
+ */
+static int eller_find(int *parent, int id)
+{
+	while (parent[id] != id)
+	{
+		parent[id] = parent[parent[id]];
+		id = parent[id];
+	}
+	return (id);
+}
+
+/**
+ * eller_coin - Flips a fair coin from the buffered random bits.
+ * @state: Pointer to the EllerState holding the bit buffer.
+ * @rng: Pointer to the random generator.
+ *
+ * Return: true or false with equal probability.
+ */
+static bool eller_coin(struct EllerState *state, struct MazeRng *rng)
+{
+	bool bit;
+
+	if (state->bits_left == 0)
+	{
+		state->bits = maze_rng_next(rng);
+		state->bits_left = 64;
+	}
+	bit = state->bits & 1;
+	state->bits >>= 1;
+	state->bits_left--;
+	return (bit);
+}
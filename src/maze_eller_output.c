@@ -0,0 +1,97 @@
+#include "../inc/maze_gen.h"
+
+static void eller_emit_row(const struct EllerState *state, Uint8 *cell_row,
+		Uint8 *south_row, Uint8 wall, Uint8 floor);
+
+/**
+ * maze_eller - Carves a maze in memory with Eller's algorithm.
+ * @tiles: Tile grid of (2 * cells_x + 1) x (2 * cells_y + 1) walls.
+ * @cells_x: Number of cells per row.
+ * @cells_y: Number of cell rows.
+ * @rng: Pointer to the random generator.
+ *
+ * Return: true on success, false on allocation failure.
+ */
+bool maze_eller(Uint8 *tiles, int cells_x, int cells_y,
+		struct MazeRng *rng)
+{
+	struct EllerState state;
+	size_t width = 2 * (size_t)cells_x + 1;
+	int y;
+
+	if (!eller_init(&state, cells_x))
+		return (false);
+	for (y = 0; y < cells_y; y++)
+	{
+		eller_next_row(&state, rng, y == cells_y - 1);
+		eller_emit_row(&state, tiles + (2 * y + 1) * width,
+				tiles + (2 * y + 2) * width, MAP_WALL, MAP_FLOOR);
+	}
+	eller_free(&state);
+	return (true);
+}
+
+/**
+ * maze_eller_stream - Streams an Eller maze to a map file row by row.
+ * @file: Output stream.
+ * @cells_x: Number of cells per row.
+ * @cells_y: Number of cell rows.
+ * @rng: Pointer to the random generator.
+ *
+ * Only two map lines are held at any time, so arbitrarily tall mazes are
+ * written in constant memory.
+ *
+ * Return: true on success, false on allocation or write failure.
+ */
+bool maze_eller_stream(FILE *file, int cells_x, int cells_y,
+		struct MazeRng *rng)
+{
+	struct EllerState state;
+	size_t width = 2 * (size_t)cells_x + 1;
+	Uint8 *lines = malloc(2 * (width + 1));
+	bool ok;
+	int y;
+
+	if (!lines || !eller_init(&state, cells_x))
+	{
+		free(lines);
+		return (false);
+	}
+	memset(lines, MAP_WALL_CHAR, width);
+	lines[width] = '\n';
+	lines[2 * width + 1] = '\n';
+	ok = fwrite(lines, 1, width + 1, file) == width + 1;
+	for (y = 0; ok && y < cells_y; y++)
+	{
+		eller_next_row(&state, rng, y == cells_y - 1);
+		memset(lines, MAP_WALL_CHAR, width);
+		memset(lines + width + 1, MAP_WALL_CHAR, width);
+		eller_emit_row(&state, lines, lines + width + 1,
+				MAP_WALL_CHAR, MAP_FLOOR_CHAR);
+		ok = fwrite(lines, 1, 2 * (width + 1), file) == 2 * (width + 1);
+	}
+	eller_free(&state);
+	free(lines);
+	return (ok);
+}
+
+/**
+ * eller_emit_row - Converts the passages of one cell row into map tiles.
+ * @state: Pointer to the EllerState holding the row decisions.
+ * @cell_row: Map line holding the cells, pre-filled with walls.
+ * @south_row: Map line below the cells, pre-filled with walls.
+ * @wall: Value used for wall tiles.
+ * @floor: Value used for floor tiles.
+ */
+static void eller_emit_row(const struct EllerState *state, Uint8 *cell_row,
+		Uint8 *south_row, Uint8 wall, Uint8 floor)
+{
+	int x;
+
+	for (x = 0; x < state->cells_x; x++)
+	{
+		cell_row[2 * x + 1] = floor;
+		cell_row[2 * x + 2] = state->east[x] ? floor : wall;
+		south_row[2 * x + 1] = state->down[x] ? floor : wall;
+	}
+}
@@ -0,0 +1,51 @@
+#include "../inc/maze_gen.h"
+
+/**
+ * eller_init - Allocates the row state of Eller's algorithm.
+ * @state: Pointer to the EllerState to initialize.
+ * @cells_x: Number of cells per row.
+ *
+ * Every array is O(cells_x): the height of the maze never matters.
+ *
+ * Return: true on success, false on allocation failure.
+ */
+bool eller_init(struct EllerState *state, int cells_x)
+{
+	int x;
+
+	state->cells_x = cells_x;
+	state->sets = malloc(cells_x * sizeof(*state->sets));
+	state->parent = malloc(cells_x * sizeof(*state->parent));
+	state->count = malloc(cells_x * sizeof(*state->count));
+	state->remap = malloc(cells_x * sizeof(*state->remap));
+	state->has_down = malloc(cells_x);
+	state->east = malloc(cells_x);
+	state->down = malloc(cells_x);
+	state->bits = 0;
+	state->bits_left = 0;
+	if (!state->sets || !state->parent || !state->count || !state->remap ||
+			!state->has_down || !state->east || !state->down)
+	{
+		eller_free(state);
+		return (false);
+	}
+	for (x = 0; x < cells_x; x++)
+		state->sets[x] = x;
+	return (true);
+}
+
+/**
+ * eller_free - Releases the row state of Eller's algorithm.
+ * @state: Pointer to the EllerState.
+ */
+void eller_free(struct EllerState *state)
+{
+	free(state->sets);
+	free(state->parent);
+	free(state->count);
+	free(state->remap);
+	free(state->has_down);
+	free(state->east);
+	free(state->down);
+	memset(state, 0, sizeof(*state));
+}
@@ -0,0 +1,101 @@
+#include "../inc/maze_gen.h"
+#include <limits.h>
+
+/**
+ * maze_rng_next - Advances a splitmix64 generator.
+ * @rng: Pointer to the generator state.
+ *
+ * Return: Next 64-bit pseudo random value.
+ */
+Uint64 maze_rng_next(struct MazeRng *rng)
+{
+	Uint64 z = (rng->state += 0x9E3779B97F4A7C15ULL);
+
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return (z ^ (z >> 31));
+}
+
+/**
+ * maze_rng_below - Draws a pseudo random integer in [0, bound).
+ * @rng: Pointer to the generator state.
+ * @bound: Exclusive upper bound, must be positive.
+ *
+ * Return: Random integer below bound.
+ */
+int maze_rng_below(struct MazeRng *rng, int bound)
+{
+	return ((int)(((maze_rng_next(rng) >> 32) * (Uint64)bound) >> 32));
+}
+
+/**
+ * maze_parse_spec - Parses "maze:<algorithm>:<cells_x>x<cells_y>[:<seed>]".
+ * @text: Specification string, e.g. "maze:wilson:64x64:42".
+ * @spec: Pointer to the MazeSpec to fill.
+ *
+ * Return: true if the string is a valid maze specification, false otherwise.
+ */
+bool maze_parse_spec(const char *text, struct MazeSpec *spec)
+{
+	char algorithm[16];
+	unsigned long long seed = MAZE_DEFAULT_SEED;
+	int fields;
+
+	if (strncmp(text, MAZE_SPEC_PREFIX, strlen(MAZE_SPEC_PREFIX)) != 0)
+		return (false);
+	fields = sscanf(text + strlen(MAZE_SPEC_PREFIX), "%15[a-z]:%dx%d:%llu",
+			algorithm, &spec->cells_x, &spec->cells_y, &seed);
+	if (fields < 3)
+		return (false);
+	if (strcmp(algorithm, "backtracker") == 0)
+		spec->algorithm = MAZE_BACKTRACKER;
+	else if (strcmp(algorithm, "wilson") == 0)
+		spec->algorithm = MAZE_WILSON;
+	else if (strcmp(algorithm, "eller") == 0)
+		spec->algorithm = MAZE_ELLER;
+	else
+		return (false);
+	spec->seed = seed;
+	return (spec->cells_x > 0 && spec->cells_y > 0 &&
+		spec->cells_x < INT_MAX / 2 && spec->cells_y < INT_MAX / 2);
+}
+
+/**
+ * maze_generate - Generates a maze as a tile grid in memory.
+ * @spec: Pointer to the maze specification.
+ * @width: Pointer to store the map width in tiles.
+ * @height: Pointer to store the map height in tiles.
+ *
+ * Return: Newly allocated row-major grid of MAP_WALL/MAP_FLOOR tiles,
+ * or NULL if the map would exceed MAP_MAX_DIMENSION or memory runs out.
+ * The caller frees it.
+ */
+Uint8 *maze_generate(const struct MazeSpec *spec, int *width, int *height)
+{
+	struct MazeRng rng = {spec->seed};
+	bool ok = true;
+	Uint8 *tiles;
+
+	*width = 2 * spec->cells_x + 1;
+	*height = 2 * spec->cells_y + 1;
+	if (*width > MAP_MAX_DIMENSION || *height > MAP_MAX_DIMENSION)
+		return (NULL);
+	tiles = malloc((size_t)*width * (size_t)*height);
+	if (!tiles)
+		return (NULL);
+	memset(tiles, MAP_WALL, (size_t)*width * (size_t)*height);
+
+	if (spec->algorithm == MAZE_BACKTRACKER)
+		ok = maze_backtracker(tiles, spec->cells_x, spec->cells_y, &rng);
+	else if (spec->algorithm == MAZE_WILSON)
+		ok = maze_wilson(tiles, spec->cells_x, spec->cells_y, &rng);
+	else
+		ok = maze_eller(tiles, spec->cells_x, spec->cells_y, &rng);
+
+	if (!ok)
+	{
+		free(tiles);
+		return (NULL);
+	}
+	return (tiles);
+}
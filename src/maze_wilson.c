@@ -0,0 +1,59 @@
+#include "../inc/maze_gen.h"
+
+/**
+ * maze_wilson - Carves a maze with Wilson's loop-erased random walks.
+ * @tiles: Tile grid of (2 * cells_x + 1) x (2 * cells_y + 1) walls.
+ * @cells_x: Number of cells per row.
+ * @cells_y: Number of cell rows.
+ * @rng: Pointer to the random generator.
+ *
+ * Each walk only remembers the last direction taken out of every cell, which
+ * erases loops implicitly; retracing the walk from its start then follows a
+ * loop-free path into the tree. A cell is in the tree once its tile is floor.
+ *
+ * Return: true on success, false on allocation failure.
+ */
+bool maze_wilson(Uint8 *tiles, int cells_x, int cells_y,
+		struct MazeRng *rng)
+{
+	static const int dx[4] = {1, -1, 0, 0};
+	static const int dy[4] = {0, 0, 1, -1};
+	size_t width = 2 * (size_t)cells_x + 1;
+	size_t cells = (size_t)cells_x * cells_y, cursor, cell;
+	Uint8 *walk = malloc(cells);
+	int cx, cy, dir;
+
+	if (!walk)
+		return (false);
+	cell = (size_t)maze_rng_below(rng, (int)cells);
+	tiles[(2 * (cell / cells_x) + 1) * width + 2 * (cell % cells_x) + 1] =
+		MAP_FLOOR;
+	for (cursor = 0; cursor < cells; cursor++)
+	{
+		cx = cursor % cells_x;
+		cy = cursor / cells_x;
+		while (tiles[(2 * cy + 1) * width + 2 * cx + 1] == MAP_WALL)
+		{
+			do {
+				dir = maze_rng_below(rng, 4);
+			} while (cx + dx[dir] < 0 || cx + dx[dir] >= cells_x ||
+				cy + dy[dir] < 0 || cy + dy[dir] >= cells_y);
+			walk[(size_t)cy * cells_x + cx] = (Uint8)dir;
+			cx += dx[dir];
+			cy += dy[dir];
+		}
+		cx = cursor % cells_x;
+		cy = cursor / cells_x;
+		while (tiles[(2 * cy + 1) * width + 2 * cx + 1] == MAP_WALL)
+		{
+			dir = walk[(size_t)cy * cells_x + cx];
+			tiles[(2 * cy + 1) * width + 2 * cx + 1] = MAP_FLOOR;
+			tiles[(2 * cy + 1 + dy[dir]) * width + 2 * cx + 1 + dx[dir]] =
+				MAP_FLOOR;
+			cx += dx[dir];
+			cy += dy[dir];
+		}
+	}
+	free(walk);
+	return (true);
+}
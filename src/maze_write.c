@@ -0,0 +1,73 @@
+#include "../inc/maze_gen.h"
+
+static bool maze_write_tiles(FILE *file, const Uint8 *tiles,
+		int width, int height);
+
+/**
+ * maze_write_map_file - Generates a maze and writes it as a map file.
+ * @spec: Pointer to the maze specification.
+ * @path: Path of the map file to create.
+ *
+ * Eller's algorithm streams rows straight to the file, so its memory use
+ * only depends on the maze width; the other algorithms build the whole
+ * grid first.
+ *
+ * Return: true on success, false otherwise.
+ */
+bool maze_write_map_file(const struct MazeSpec *spec, const char *path)
+{
+	struct MazeRng rng = {spec->seed};
+	int width, height;
+	Uint8 *tiles;
+	bool ok;
+	FILE *file = fopen(path, "w");
+
+	if (!file)
+	{
+		fprintf(stderr, "Error creating map file: %s\n", path);
+		return (false);
+	}
+	if (spec->algorithm == MAZE_ELLER)
+		ok = maze_eller_stream(file, spec->cells_x, spec->cells_y, &rng);
+	else
+	{
+		tiles = maze_generate(spec, &width, &height);
+		ok = tiles && maze_write_tiles(file, tiles, width, height);
+		free(tiles);
+	}
+	if (fclose(file) != 0)
+		ok = false;
+	if (!ok)
+		fprintf(stderr, "Error writing map file: %s\n", path);
+	return (ok);
+}
+
+/**
+ * maze_write_tiles - Writes a tile grid in the map file format.
+ * @file: Output stream.
+ * @tiles: Row-major grid of MAP_WALL/MAP_FLOOR tiles.
+ * @width: Map width in tiles.
+ * @height: Map height in tiles.
+ *
+ * Return: true on success, false on a write error.
+ */
+static bool maze_write_tiles(FILE *file, const Uint8 *tiles,
+		int width, int height)
+{
+	char *line = malloc((size_t)width + 1);
+	int x, y;
+
+	if (!line)
+		return (false);
+	line[width] = '\n';
+	for (y = 0; y < height; y++)
+	{
+		for (x = 0; x < width; x++)
+			line[x] = tiles[(size_t)y * width + x] == MAP_WALL ?
+				MAP_WALL_CHAR : MAP_FLOOR_CHAR;
+		if (fwrite(line, 1, (size_t)width + 1, file) != (size_t)width + 1)
+			break;
+	}
+	free(line);
+	return (y == height);
+}
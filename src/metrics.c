@@ -0,0 +1,157 @@
+#include "../inc/metrics.h"
+#include <errno.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static int metrics_worker(void *data);
+static void metrics_serve(const struct Metrics *metrics, int client);
+static bool metrics_send(int client, const char *data, size_t length);
+
+/**
+ * metrics_create - Starts serving metrics on a Unix socket.
+ * @path: Socket path; a stale socket left at the path is replaced.
+ *
+ * Return: Pointer to the Metrics, or NULL on failure.
+ */
+struct Metrics *metrics_create(const char *path)
+{
+	struct Metrics *metrics = calloc(1, sizeof(*metrics));
+	struct sockaddr_un address = {0};
+
+	if (!metrics)
+		return (NULL);
+	metrics->listener = -1;
+	if (strlen(path) >= sizeof(address.sun_path))
+	{
+		fprintf(stderr, "Metrics socket path too long: %s\n", path);
+		metrics_destroy(metrics);
+		return (NULL);
+	}
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, path);
+	unlink(path);
+	metrics->listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (metrics->listener < 0 || bind(metrics->listener,
+				(struct sockaddr *)&address, sizeof(address)) != 0 ||
+			!(metrics->path = strdup(path)) ||
+			listen(metrics->listener, SOMAXCONN) != 0 ||
+			!(metrics->thread = SDL_CreateThread(metrics_worker, "metrics",
+					metrics)))
+	{
+		fprintf(stderr, "Error serving metrics on %s: %s\n", path,
+				strerror(errno));
+		metrics_destroy(metrics);
+		return (NULL);
+	}
+	return (metrics);
+}
+
+/**
+ * metrics_destroy - Stops the server and removes its socket.
+ * @metrics: Pointer to the Metrics, may be NULL.
+ */
+void metrics_destroy(struct Metrics *metrics)
+{
+	if (!metrics)
+		return;
+	if (metrics->thread)
+	{
+		SDL_AtomicSet(&metrics->quit, 1);
+		SDL_WaitThread(metrics->thread, NULL);
+	}
+	if (metrics->listener >= 0)
+		close(metrics->listener);
+	if (metrics->path)
+		unlink(metrics->path);
+	free(metrics->path);
+	free(metrics);
+}
+
+/**
+ * metrics_worker - Server thread answering one scrape at a time.
+ * @data: Pointer to the Metrics.
+ *
+ * The listener is polled every METRICS_POLL_MS so the thread notices
+ * when it must quit.
+ *
+ * Return: Always 0.
+ */
+static int metrics_worker(void *data)
+{
+	struct Metrics *metrics = data;
+	struct pollfd listener = {metrics->listener, POLLIN, 0};
+	int client;
+
+	while (!SDL_AtomicGet(&metrics->quit))
+	{
+		if (poll(&listener, 1, METRICS_POLL_MS) <= 0)
+			continue;
+		client = accept(metrics->listener, NULL, NULL);
+		if (client < 0)
+			continue;
+		metrics_serve(metrics, client);
+		close(client);
+	}
+	return (0);
+}
+
+/**
+ * metrics_serve - Answers a scrape with the metrics in text format.
+ * @metrics: Pointer to the Metrics.
+ * @client: Connected socket.
+ *
+ * The answer is an HTTP response, so "curl --unix-socket" and
+ * Prometheus both read it. The request itself is skipped: whatever the
+ * client sends within METRICS_REQUEST_MS is read and ignored, so raw
+ * socket readers get the same answer.
+ */
+static void metrics_serve(const struct Metrics *metrics, int client)
+{
+	char request[METRICS_BUFFER_SIZE], body[METRICS_BUFFER_SIZE];
+	char header[128];
+	struct pollfd readable = {client, POLLIN, 0};
+	int length, header_length;
+	ssize_t got;
+
+	while (poll(&readable, 1, METRICS_REQUEST_MS) > 0 &&
+			(got = read(client, request, sizeof(request))) > 0)
+		if (got >= 4 && memcmp(request + got - 4, "\r\n\r\n", 4) == 0)
+			break;
+	length = metrics_format(metrics, body, sizeof(body));
+	header_length = snprintf(header, sizeof(header), "HTTP/1.0 200 OK\r\n"
+			"Content-Type: text/plain; version=0.0.4\r\n"
+			"Content-Length: %d\r\n\r\n", length);
+	if (metrics_send(client, header, header_length))
+		metrics_send(client, body, length);
+}
+
+/**
+ * metrics_send - Writes all of a buffer to a client.
+ * @client: Connected socket.
+ * @data: Bytes to write.
+ * @length: Number of bytes.
+ *
+ * MSG_NOSIGNAL keeps a scraper that hangs up early from raising SIGPIPE,
+ * which would kill the game; the write fails with EPIPE instead and the
+ * answer is given up.
+ *
+ * Return: true if every byte was written, false otherwise.
+ */
+static bool metrics_send(int client, const char *data, size_t length)
+{
+	ssize_t sent;
+
+	while (length > 0)
+	{
+		sent = send(client, data, length, MSG_NOSIGNAL);
+		if (sent < 0 && errno == EINTR)
+			continue;
+		if (sent <= 0)
+			return (false);
+		data += sent;
+		length -= sent;
+	}
+	return (true);
+}
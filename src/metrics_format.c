@@ -0,0 +1,138 @@
+#include "../inc/game.h"
+#include "../inc/metrics.h"
+#include <unistd.h>
+
+static int metrics_write(char *buffer, size_t size, int length,
+		const char *name, const char *type, const char *help, double value);
+static double metrics_resident_bytes(void);
+
+/**
+ * metrics_frame - Publishes the counters of the frame just presented.
+ * @game: Pointer to the Game structure, its metrics set.
+ * @present_ticks: Performance counter ticks spent presenting the frame.
+ * @rays: Rays cast for the frame.
+ *
+ * Only relaxed atomic operations: nothing here can wait for a scrape.
+ */
+void metrics_frame(const struct Game *game, Uint64 present_ticks, long rays)
+{
+	struct Metrics *metrics = game->metrics;
+	Uint64 now = SDL_GetPerformanceCounter();
+	double to_ns = 1e9 / SDL_GetPerformanceFrequency();
+	Uint64 frame_ns = metrics->previous ? (now - metrics->previous) * to_ns : 0;
+	Uint64 present_ns = present_ticks * to_ns;
+
+	metrics->previous = now;
+	atomic_fetch_add_explicit(&metrics->frames, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&metrics->frame_ns, frame_ns,
+			memory_order_relaxed);
+	atomic_store_explicit(&metrics->last_frame_ns, frame_ns,
+			memory_order_relaxed);
+	atomic_fetch_add_explicit(&metrics->present_ns, present_ns,
+			memory_order_relaxed);
+	atomic_store_explicit(&metrics->last_present_ns, present_ns,
+			memory_order_relaxed);
+	atomic_fetch_add_explicit(&metrics->rays, rays, memory_order_relaxed);
+	atomic_store_explicit(&metrics->dropped, game->capture ?
+			game->capture->dropped : 0, memory_order_relaxed);
+	atomic_store_explicit(&metrics->level_bytes, game->levels ?
+			level_set_memory(game->levels,
+				game->levels->slots[game->levels->current].index, NULL) : 0,
+			memory_order_relaxed);
+	atomic_store_explicit(&metrics->frame_arena_bytes, game->frame_arena.used,
+			memory_order_relaxed);
+}
+
+/**
+ * metrics_format - Writes the metrics in the Prometheus text format.
+ * @metrics: Pointer to the Metrics.
+ * @buffer: Buffer receiving the text.
+ * @size: Size of the buffer.
+ *
+ * Return: Length of the text, truncated to fit the buffer.
+ */
+int metrics_format(const struct Metrics *metrics, char *buffer, size_t size)
+{
+	static const char *const info[][3] = {
+		{"maze_frames_total", "counter", "Frames presented."},
+		{"maze_frame_seconds_total", "counter",
+			"Time between consecutive frames."},
+		{"maze_frame_seconds", "gauge", "Time between the last two frames."},
+		{"maze_present_seconds_total", "counter",
+			"Time spent presenting frames."},
+		{"maze_present_seconds", "gauge",
+			"Time spent presenting the last frame."},
+		{"maze_rays_total", "counter", "Rays cast, reused columns excluded."},
+		{"maze_capture_dropped_frames_total", "counter",
+			"Frames dropped by the capture."},
+		{"maze_level_arena_bytes", "gauge", "Arena memory of the current level."},
+		{"maze_frame_arena_bytes", "gauge",
+			"Frame arena memory used by the last frame."},
+		{"maze_resident_memory_bytes", "gauge",
+			"Resident memory of the process."}
+	};
+	double values[] = {
+		atomic_load_explicit(&metrics->frames, memory_order_relaxed),
+		atomic_load_explicit(&metrics->frame_ns, memory_order_relaxed) / 1e9,
+		atomic_load_explicit(&metrics->last_frame_ns, memory_order_relaxed) /
+			1e9,
+		atomic_load_explicit(&metrics->present_ns, memory_order_relaxed) / 1e9,
+		atomic_load_explicit(&metrics->last_present_ns, memory_order_relaxed) /
+			1e9,
+		atomic_load_explicit(&metrics->rays, memory_order_relaxed),
+		atomic_load_explicit(&metrics->dropped, memory_order_relaxed),
+		atomic_load_explicit(&metrics->level_bytes, memory_order_relaxed),
+		atomic_load_explicit(&metrics->frame_arena_bytes, memory_order_relaxed),
+		metrics_resident_bytes()
+	};
+	int length = 0;
+	size_t i;
+
+	for (i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+		length = metrics_write(buffer, size, length, info[i][0], info[i][1],
+				info[i][2], values[i]);
+	return (length);
+}
+
+/**
+ * metrics_write - Appends one metric with its help and type lines.
+ * @buffer: Buffer receiving the text.
+ * @size: Size of the buffer.
+ * @length: Length of the text already in the buffer.
+ * @name: Metric name.
+ * @type: Metric type, "counter" or "gauge".
+ * @help: Description of the metric.
+ * @value: Value of the metric.
+ *
+ * Return: New length of the text, at most size - 1.
+ */
+static int metrics_write(char *buffer, size_t size, int length,
+		const char *name, const char *type, const char *help, double value)
+{
+	int written = snprintf(buffer + length, size - length,
+			"# HELP %s %s\n# TYPE %s %s\n%s %.15g\n", name, help, name, type,
+			name, value);
+
+	if (written < 0)
+		return (length);
+	return ((size_t)(length + written) < size ? length + written :
+			(int)size - 1);
+}
+
+/**
+ * metrics_resident_bytes - Reads the resident memory of the process.
+ *
+ * Return: Resident bytes, 0 where /proc is not available.
+ */
+static double metrics_resident_bytes(void)
+{
+	long pages, resident = 0;
+	FILE *file = fopen("/proc/self/statm", "r");
+
+	if (!file)
+		return (0);
+	if (fscanf(file, "%ld %ld", &pages, &resident) != 2)
+		resident = 0;
+	fclose(file);
+	return ((double)resident * sysconf(_SC_PAGESIZE));
+}
@@ -13,31 +13,66 @@ void update_direction(struct Player *player)
 
 /**
  * check_collision - Checks for collision
- *		between the player and walls on the map.
+ *		between a player and walls on the map.
  * @game: Pointer to the Game structure.
+ * @player: Pointer to the moving Player.
  * @newX: Potential new X position of the player.
  * @newY: Potential new Y position of the player.
  *
  * Return: true if no collision, false if collision detected.
  */
-bool check_collision(const struct Game *game, float newX, float newY)
+bool check_collision(const struct Game *game, const struct Player *player,
+		float newX, float newY)
 {
 	float buffer = PLAYER_SIZE / 2.0f;
-	int map_x_forward = (int)((newX + buffer * game->player.dirX) / TILE_SIZE);
-	int map_y_forward = (int)((newY + buffer * game->player.dirY) / TILE_SIZE);
-	int map_x_backward = (int)((newX - buffer * game->player.dirX) / TILE_SIZE);
-	int map_y_backward = (int)((newY - buffer * game->player.dirY) / TILE_SIZE);
+	int map_x_forward = (int)((newX + buffer * player->dirX) / TILE_SIZE);
+	int map_y_forward = (int)((newY + buffer * player->dirY) / TILE_SIZE);
+	int map_x_backward = (int)((newX - buffer * player->dirX) / TILE_SIZE);
+	int map_y_backward = (int)((newY - buffer * player->dirY) / TILE_SIZE);
 
-	return (game->map[map_y_forward * MAP_WIDTH + map_x_forward] == MAP_FLOOR &&
-		game->map[map_y_backward * MAP_WIDTH + map_x_backward] == MAP_FLOOR);
+	return (map_cell(game, map_x_forward, map_y_forward) == MAP_FLOOR &&
+		map_cell(game, map_x_backward, map_y_backward) == MAP_FLOOR);
+}
+
+/**
+ * map_cell - Reads one tile of the map, whichever way it is stored.
+ * @game: Pointer to the Game structure.
+ * @map_x: Tile column.
+ * @map_y: Tile row.
+ *
+ * Return: The tile type, MAP_WALL or MAP_FLOOR, whatever its height;
+ * MAP_WALL outside the map and in world chunks that are not resident yet.
+ */
+int map_cell(const struct Game *game, int map_x, int map_y)
+{
+	if (!map_in_bounds(game, map_x, map_y))
+		return (MAP_WALL);
+	if (game->world)
+		return (world_cell(game->world, map_x, map_y));
+	return (MAP_CELL_TYPE(game->map[map_y * game->map_width + map_x]));
+}
+
+/**
+ * map_in_bounds - Checks whether a tile coordinate lies inside the map.
+ * @game: Pointer to the Game structure.
+ * @map_x: Tile column.
+ * @map_y: Tile row.
+ *
+ * Return: true if the tile exists, false otherwise.
+ */
+bool map_in_bounds(const struct Game *game, int map_x, int map_y)
+{
+	return (map_x >= 0 && map_x < game->map_width &&
+		map_y >= 0 && map_y < game->map_height);
 }
 
 /**
  * keep_player_in_bounds - Keeps the player within the bounds of the game map.
+ * @game: Pointer to the Game structure holding the map dimensions.
  * @player: Pointer to the Player structure.
  */
-void keep_player_in_bounds(struct Player *player)
+void keep_player_in_bounds(const struct Game *game, struct Player *player)
 {
-	player->x = fmaxf(0, fminf(player->x, MAP_WIDTH * TILE_SIZE));
-	player->y = fmaxf(0, fminf(player->y, MAP_HEIGHT * TILE_SIZE));
+	player->x = fmaxf(0, fminf(player->x, game->map_width * TILE_SIZE));
+	player->y = fmaxf(0, fminf(player->y, game->map_height * TILE_SIZE));
 }
@@ -0,0 +1,126 @@
+#include "../inc/game.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * net_socket - Opens a non-blocking UDP socket.
+ * @port: Port to bind on every interface, 0 for any free port.
+ *
+ * The receive buffer is raised to NET_RECEIVE_BUFFER so a server ticking
+ * hundreds of clients does not drop their inputs between two ticks.
+ *
+ * Return: The socket, or -1 on failure with errno set.
+ */
+int net_socket(int port)
+{
+	struct sockaddr_in address = {0};
+	int size = NET_RECEIVE_BUFFER;
+	int fd = socket(AF_INET, SOCK_DGRAM, 0);
+
+	if (fd < 0)
+		return (-1);
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_ANY);
+	address.sin_port = htons(port);
+	setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+	if (fcntl(fd, F_SETFL, O_NONBLOCK) != 0 || bind(fd,
+				(struct sockaddr *)&address, sizeof(address)) != 0)
+	{
+		close(fd);
+		return (-1);
+	}
+	return (fd);
+}
+
+/**
+ * net_put - Writes an unsigned value in little-endian order.
+ * @at: Where to write.
+ * @value: Value to write.
+ * @bytes: Number of bytes written, 1 to 4.
+ */
+void net_put(Uint8 *at, Uint32 value, int bytes)
+{
+	int i;
+
+	for (i = 0; i < bytes; i++)
+		at[i] = value >> (8 * i) & 0xff;
+}
+
+/**
+ * net_get - Reads an unsigned value written by net_put.
+ * @at: Where to read.
+ * @bytes: Number of bytes read, 1 to 4.
+ *
+ * Return: The value.
+ */
+Uint32 net_get(const Uint8 *at, int bytes)
+{
+	Uint32 value = 0;
+	int i;
+
+	for (i = 0; i < bytes; i++)
+		value |= (Uint32)at[i] << (8 * i);
+	return (value);
+}
+
+/**
+ * net_server_create - Starts serving a map over UDP.
+ * @game: Pointer to the Game holding the map, loaded whole: streamed
+ *		worlds and level sets are refused. The map is shared, not
+ *		copied.
+ * @port: Port to serve on.
+ *
+ * Return: Pointer to the NetServer, or NULL on failure.
+ */
+struct NetServer *net_server_create(const struct Game *game, int port)
+{
+	struct NetServer *server;
+
+	if (!game->map || game->world || game->levels)
+	{
+		fprintf(stderr, "Only a map file or a maze can be shared\n");
+		return (NULL);
+	}
+	server = calloc(1, sizeof(*server));
+	if (!server)
+		return (NULL);
+	server->sim.map = game->map;
+	server->sim.map_width = game->map_width;
+	server->sim.map_height = game->map_height;
+	server->sim.player_count = 1;
+	server->sim.keyboard_state = server->keys;
+	server->rng.state = MAZE_DEFAULT_SEED;
+	server->grid_width = game->map_width * TILE_SIZE / NET_VIEW_RANGE + 1;
+	server->grid_height = game->map_height * TILE_SIZE / NET_VIEW_RANGE + 1;
+	server->cells = calloc((size_t)server->grid_width * server->grid_height +
+			1, sizeof(*server->cells));
+	server->socket = server->cells ? net_socket(port) : -1;
+	if (server->socket < 0)
+	{
+		fprintf(stderr, "Error serving on port %d: %s\n", port,
+				strerror(errno));
+		net_server_destroy(server);
+		return (NULL);
+	}
+	return (server);
+}
+
+/**
+ * net_server_destroy - Stops serving and forgets every client.
+ * @server: Pointer to the NetServer, may be NULL.
+ */
+void net_server_destroy(struct NetServer *server)
+{
+	int slot;
+
+	if (!server)
+		return;
+	if (server->socket >= 0)
+		close(server->socket);
+	for (slot = 0; slot < server->peer_count; slot++)
+		free(server->peers[slot].history);
+	free(server->cells);
+	free(server);
+}
@@ -0,0 +1,141 @@
+#include "../inc/game.h"
+#include <errno.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static bool net_client_resolve(const char *address,
+		struct sockaddr_in *server);
+
+/**
+ * net_client_create - Opens a connection to a server and asks to join.
+ * @game: Pointer to the Game holding the map, which must be the one the
+ *		server plays; streamed worlds and level sets are refused.
+ * @address: Server as host:port.
+ *
+ * The socket is connected to the server, so datagrams from anywhere else
+ * are dropped by the system. The client has joined once a welcome comes
+ * back, see net_client_wait.
+ *
+ * Return: Pointer to the NetClient, or NULL on failure.
+ */
+struct NetClient *net_client_create(const struct Game *game,
+		const char *address)
+{
+	struct NetClient *client;
+
+	if (!game->map || game->world || game->levels)
+	{
+		fprintf(stderr, "Only a map file or a maze can be shared\n");
+		return (NULL);
+	}
+	client = calloc(1, sizeof(*client));
+	if (!client)
+		return (NULL);
+	client->socket = -1;
+	client->map_width = game->map_width;
+	client->map_height = game->map_height;
+	if (!net_client_resolve(address, &client->server) ||
+			(client->socket = net_socket(0)) < 0 ||
+			connect(client->socket, (struct sockaddr *)&client->server,
+				sizeof(client->server)) != 0)
+	{
+		fprintf(stderr, "Error connecting to %s: %s\n", address,
+				errno ? strerror(errno) : "bad address");
+		net_client_destroy(client);
+		return (NULL);
+	}
+	net_client_hello(client);
+	return (client);
+}
+
+/**
+ * net_client_destroy - Closes a connection.
+ * @client: Pointer to the NetClient, may be NULL.
+ */
+void net_client_destroy(struct NetClient *client)
+{
+	if (!client)
+		return;
+	if (client->socket >= 0)
+		close(client->socket);
+	free(client);
+}
+
+/**
+ * net_client_hello - Asks the server to let the client join.
+ * @client: Pointer to the NetClient.
+ *
+ * The hello carries the size of the client's map and tiles, the server
+ * ignores clients playing another map or measuring it in other units.
+ */
+void net_client_hello(struct NetClient *client)
+{
+	Uint8 hello[NET_HELLO_BYTES] = {NET_HELLO};
+
+	net_put(hello + 1, client->map_width, 4);
+	net_put(hello + 5, client->map_height, 4);
+	net_put(hello + 9, TILE_SIZE, 2);
+	(void)!send(client->socket, hello, sizeof(hello), 0);
+}
+
+/**
+ * net_client_wait - Waits for the server to welcome the client.
+ * @client: Pointer to the NetClient.
+ *
+ * The hello is sent again every NET_HELLO_MS, as datagrams get lost,
+ * for at most NET_CONNECT_MS.
+ *
+ * Return: true once the client joined, false if the server never
+ * answered.
+ */
+bool net_client_wait(struct NetClient *client)
+{
+	struct pollfd readable = {client->socket, POLLIN, 0};
+	Uint32 start = SDL_GetTicks();
+
+	while (!client->id && SDL_GetTicks() - start < NET_CONNECT_MS)
+	{
+		if (poll(&readable, 1, NET_HELLO_MS) > 0)
+			net_client_receive(client);
+		else
+			net_client_hello(client);
+	}
+	if (!client->id)
+		fprintf(stderr, "No answer from the server\n");
+	return (client->id != 0);
+}
+
+/**
+ * net_client_resolve - Looks up the address of a server.
+ * @address: Server as host:port.
+ * @server: Pointer to the address to fill.
+ *
+ * Return: true if the address was found, false otherwise.
+ */
+static bool net_client_resolve(const char *address,
+		struct sockaddr_in *server)
+{
+	const char *colon = strrchr(address, ':');
+	struct addrinfo hints = {0}, *found;
+	char host[256], *end;
+	long port;
+
+	errno = 0;
+	if (!colon || colon - address >= (long)sizeof(host))
+		return (false);
+	port = strtol(colon + 1, &end, 10);
+	if (end == colon + 1 || *end != '\0' || port <= 0 || port > 65535)
+		return (false);
+	memcpy(host, address, colon - address);
+	host[colon - address] = '\0';
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_DGRAM;
+	if (getaddrinfo(host, NULL, &hints, &found) != 0)
+		return (false);
+	*server = *(struct sockaddr_in *)found->ai_addr;
+	server->sin_port = htons(port);
+	freeaddrinfo(found);
+	return (true);
+}
@@ -0,0 +1,88 @@
+#include "../inc/game.h"
+#include <sys/socket.h>
+
+static bool net_client_snapshot(struct NetClient *client,
+		const Uint8 *packet, int length);
+
+/**
+ * net_client_send - Sends the server the keys the player holds.
+ * @client: Pointer to the NetClient.
+ * @buttons: InputButton flags of the keys held.
+ *
+ * The input also acknowledges the newest snapshot decoded, the base of
+ * the next ones. Until the client has joined, the hello is sent instead.
+ */
+void net_client_send(struct NetClient *client, int buttons)
+{
+	Uint8 packet[NET_INPUT_BYTES] = {NET_INPUT};
+
+	if (!client->id)
+	{
+		net_client_hello(client);
+		return;
+	}
+	net_put(packet + 1, client->id, 2);
+	net_put(packet + 3, ++client->sequence, 4);
+	net_put(packet + 7, client->newest, 4);
+	packet[11] = buttons;
+	(void)!send(client->socket, packet, sizeof(packet), 0);
+}
+
+/**
+ * net_client_receive - Reads every datagram waiting from the server.
+ * @client: Pointer to the NetClient.
+ *
+ * Return: true if a newer snapshot was decoded, false otherwise.
+ */
+bool net_client_receive(struct NetClient *client)
+{
+	Uint8 packet[NET_PACKET_BYTES];
+	bool updated = false;
+	ssize_t length;
+
+	while ((length = recv(client->socket, packet, sizeof(packet), 0)) > 0)
+	{
+		if (packet[0] == NET_WELCOME && length >= NET_WELCOME_BYTES &&
+				!client->id)
+			client->id = net_get(packet + 1, 2);
+		else if (packet[0] == NET_SNAPSHOT && client->id &&
+				net_client_snapshot(client, packet, length))
+			updated = true;
+	}
+	return (updated);
+}
+
+/**
+ * net_client_snapshot - Decodes a snapshot and takes its players.
+ * @client: Pointer to the NetClient.
+ * @packet: The datagram.
+ * @length: Length of the datagram.
+ *
+ * Snapshots older than the newest one are dropped, as are those whose
+ * base is gone; the server then keeps encoding against the last one
+ * acknowledged.
+ *
+ * Return: true if the snapshot is the newest one, false otherwise.
+ */
+static bool net_client_snapshot(struct NetClient *client,
+		const Uint8 *packet, int length)
+{
+	struct NetState state;
+	int i;
+
+	client->bytes += length;
+	if (!net_decode(client->history, packet, length, &state))
+	{
+		client->dropped++;
+		return (false);
+	}
+	if (state.tick <= client->newest)
+		return (false);
+	client->history[state.tick % NET_HISTORY] = state;
+	client->newest = state.tick;
+	client->remote_count = 0;
+	for (i = 0; i < state.count; i++)
+		net_player(&state.entities[i], state.entities[i].id == client->id ?
+				&client->player : &client->remote[client->remote_count++]);
+	return (true);
+}
@@ -0,0 +1,191 @@
+#include "../inc/game.h"
+
+static bool net_read_fields(const Uint8 *buffer, int length, int *at,
+		int mask, struct NetEntity *entity);
+static int net_record(const struct NetEntity *from,
+		const struct NetEntity *to, Uint8 *at);
+
+/**
+ * net_encode - Writes a snapshot as the changes from a base.
+ * @base: Pointer to the NetState the client already has, NULL to write
+ *		the snapshot in full.
+ * @state: Pointer to the NetState to send.
+ * @buffer: NET_PACKET_BYTES bytes to write the datagram to; a snapshot
+ *		of NET_MAX_VISIBLE entities replacing NET_MAX_VISIBLE others
+ *		still fits.
+ *
+ * Both states are sorted by id, so one merge finds the entities that
+ * appeared, left or changed. Entities that did not change are left out;
+ * a moved entity only carries the fields that changed, its position as
+ * 16-bit offsets from the base when they fit.
+ *
+ * Return: Length of the datagram.
+ */
+int net_encode(const struct NetState *base, const struct NetState *state,
+		Uint8 *buffer)
+{
+	int i = 0, j = 0, records = 0, length = NET_SNAPSHOT_HEADER, written;
+	int base_count = base ? base->count : 0;
+
+	buffer[0] = NET_SNAPSHOT;
+	net_put(buffer + 1, state->tick, 4);
+	net_put(buffer + 5, base ? base->tick : 0, 4);
+	while (i < state->count || j < base_count)
+	{
+		if (j == base_count || (i < state->count &&
+					state->entities[i].id < base->entities[j].id))
+			written = net_record(NULL, &state->entities[i++],
+					buffer + length);
+		else if (i == state->count ||
+				base->entities[j].id < state->entities[i].id)
+			written = net_record(&base->entities[j++], NULL, buffer + length);
+		else
+			written = net_record(&base->entities[j++], &state->entities[i++],
+					buffer + length);
+		records += written > 0;
+		length += written;
+	}
+	net_put(buffer + 9, records, 2);
+	return (length);
+}
+
+/**
+ * net_decode - Rebuilds a snapshot from a datagram.
+ * @history: NET_HISTORY snapshots already decoded, indexed by
+ *		tick % NET_HISTORY, the base is looked up in.
+ * @buffer: The datagram.
+ * @length: Length of the datagram.
+ * @state: Pointer to the NetState to fill.
+ *
+ * Return: true if the snapshot was rebuilt, false if the datagram is
+ * malformed or its base is no longer in the history.
+ */
+bool net_decode(const struct NetState *history, const Uint8 *buffer,
+		int length, struct NetState *state)
+{
+	const struct NetState *base = NULL;
+	int records, i, j = 0, at = NET_SNAPSHOT_HEADER, mask;
+	struct NetEntity entity;
+	Uint32 base_tick;
+
+	if (length < NET_SNAPSHOT_HEADER || buffer[0] != NET_SNAPSHOT)
+		return (false);
+	state->tick = net_get(buffer + 1, 4);
+	base_tick = net_get(buffer + 5, 4);
+	records = (int)net_get(buffer + 9, 2);
+	if (base_tick && (base = &history[base_tick % NET_HISTORY])->tick !=
+			base_tick)
+		return (false);
+	state->count = 0;
+	for (i = 0; i < records; i++)
+	{
+		if (at + NET_RECORD_HEADER > length)
+			return (false);
+		entity = (struct NetEntity){net_get(buffer + at, 2), 0, 0, 0};
+		mask = buffer[at + 2];
+		at += NET_RECORD_HEADER;
+		while (base && j < base->count && base->entities[j].id < entity.id &&
+				state->count < NET_MAX_VISIBLE)
+			state->entities[state->count++] = base->entities[j++];
+		if (base && j < base->count && base->entities[j].id == entity.id)
+			entity = base->entities[j++];
+		else if ((mask & (NET_FIELD_X | NET_FIELD_Y | NET_FIELD_ANGLE |
+						NET_FIELD_SMALL)) != (NET_FIELD_X | NET_FIELD_Y |
+						NET_FIELD_ANGLE))
+			return (false);
+		if (mask & NET_FIELD_REMOVED)
+			continue;
+		if (!net_read_fields(buffer, length, &at, mask, &entity) ||
+				state->count == NET_MAX_VISIBLE)
+			return (false);
+		state->entities[state->count++] = entity;
+	}
+	while (base && j < base->count && state->count < NET_MAX_VISIBLE)
+		state->entities[state->count++] = base->entities[j++];
+	return (true);
+}
+
+/**
+ * net_read_fields - Reads the changed fields of a record into an entity.
+ * @buffer: Snapshot datagram.
+ * @length: Length of the datagram.
+ * @at: Pointer to the offset of the fields, moved past them.
+ * @mask: NetField bits of the record.
+ * @entity: Pointer to the NetEntity, holding its base values.
+ *
+ * Return: true on success, false if the fields run past the datagram.
+ */
+static bool net_read_fields(const Uint8 *buffer, int length, int *at,
+		int mask, struct NetEntity *entity)
+{
+	Sint32 *position[2] = {&entity->x, &entity->y};
+	int axis, bytes = mask & NET_FIELD_SMALL ? 2 : 4;
+
+	for (axis = 0; axis < 2; axis++)
+		if (mask & (NET_FIELD_X << axis))
+		{
+			if (*at + bytes > length)
+				return (false);
+			*position[axis] = bytes == 2 ? *position[axis] +
+				(Sint16)net_get(buffer + *at, 2) :
+				(Sint32)net_get(buffer + *at, 4);
+			*at += bytes;
+		}
+	if (mask & NET_FIELD_ANGLE)
+	{
+		if (*at + 2 > length)
+			return (false);
+		entity->angle = net_get(buffer + *at, 2);
+		*at += 2;
+	}
+	return (true);
+}
+
+/**
+ * net_record - Writes how one entity changed.
+ * @from: Pointer to the NetEntity in the base, NULL if it just appeared.
+ * @to: Pointer to the NetEntity now, NULL if it left.
+ * @at: Where to write the record.
+ *
+ * Return: Length of the record, 0 when nothing changed.
+ */
+static int net_record(const struct NetEntity *from,
+		const struct NetEntity *to, Uint8 *at)
+{
+	int mask = NET_FIELD_X | NET_FIELD_Y | NET_FIELD_ANGLE, axis;
+	int length = NET_RECORD_HEADER;
+	Sint32 delta[2] = {0, 0};
+
+	if (!to)
+	{
+		net_put(at, from->id, 2);
+		at[2] = NET_FIELD_REMOVED;
+		return (NET_RECORD_HEADER);
+	}
+	if (from)
+	{
+		delta[0] = to->x - from->x;
+		delta[1] = to->y - from->y;
+		mask = (delta[0] ? NET_FIELD_X : 0) | (delta[1] ? NET_FIELD_Y : 0) |
+			(to->angle != from->angle ? NET_FIELD_ANGLE : 0);
+		if (!mask)
+			return (0);
+		if (delta[0] == (Sint16)delta[0] && delta[1] == (Sint16)delta[1])
+			mask |= NET_FIELD_SMALL;
+	}
+	net_put(at, to->id, 2);
+	at[2] = mask;
+	for (axis = 0; axis < 2; axis++)
+		if (mask & (NET_FIELD_X << axis))
+		{
+			net_put(at + length, mask & NET_FIELD_SMALL ? (Uint32)delta[axis] :
+					(Uint32)(axis ? to->y : to->x), mask & NET_FIELD_SMALL ? 2 : 4);
+			length += mask & NET_FIELD_SMALL ? 2 : 4;
+		}
+	if (mask & NET_FIELD_ANGLE)
+	{
+		net_put(at + length, to->angle, 2);
+		length += 2;
+	}
+	return (length);
+}
@@ -0,0 +1,29 @@
+#include "../inc/game.h"
+
+/**
+ * net_quantize - Turns a player into an entity of a snapshot.
+ * @player: Pointer to the Player.
+ * @id: Entity id of the player.
+ * @entity: Pointer to the NetEntity to fill.
+ */
+void net_quantize(const struct Player *player, Uint16 id,
+		struct NetEntity *entity)
+{
+	entity->id = id;
+	entity->x = (Sint32)lroundf(player->x * NET_POSITION_SCALE);
+	entity->y = (Sint32)lroundf(player->y * NET_POSITION_SCALE);
+	entity->angle = (Uint16)lround(player->angle * NET_ANGLE_SCALE);
+}
+
+/**
+ * net_player - Turns an entity of a snapshot back into a player.
+ * @entity: Pointer to the NetEntity.
+ * @player: Pointer to the Player to fill.
+ */
+void net_player(const struct NetEntity *entity, struct Player *player)
+{
+	player->x = entity->x / NET_POSITION_SCALE;
+	player->y = entity->y / NET_POSITION_SCALE;
+	player->angle = entity->angle / NET_ANGLE_SCALE;
+	update_direction(player);
+}
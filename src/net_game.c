@@ -0,0 +1,88 @@
+#include "../inc/game.h"
+
+static void net_host_view(struct Game *game);
+
+/**
+ * net_frame - Exchanges the players of a frame with the network.
+ * @game: Pointer to the Game structure, hosting a server or connected
+ *		to one.
+ *
+ * A hosting game ticks its server with its local players as they moved
+ * this frame. A connected game sends its first player's keys and takes
+ * the player back from the newest snapshot: the server alone moves it.
+ * Either way, the other players in sight end up in @game->remote.
+ */
+void net_frame(struct Game *game)
+{
+	struct NetClient *client = game->client;
+
+	if (game->server)
+	{
+		net_server_tick(game->server, game, game->delta_time);
+		net_host_view(game);
+	}
+	if (!client)
+		return;
+	net_client_send(client, input_buttons(game, 0));
+	if (net_client_receive(client))
+		game->players[0] = client->player;
+	game->remote = client->remote;
+	game->remote_count = client->remote_count;
+}
+
+/**
+ * net_visible - Checks that no wall stands between two points.
+ * @game: Pointer to the Game holding the map.
+ * @from_x: x coordinate of the first point, in world units.
+ * @from_y: y coordinate of the first point, in world units.
+ * @to_x: x coordinate of the second point, in world units.
+ * @to_y: y coordinate of the second point, in world units.
+ *
+ * Walls and thin walls block the view; grates do not. Both points stand
+ * on floor tiles, which never block.
+ *
+ * Return: true if the points see each other, false otherwise.
+ */
+bool net_visible(const struct Game *game, float from_x, float from_y,
+		float to_x, float to_y)
+{
+	return (map_segment_clear(game->map, game->map_width, game->map_height,
+				from_x / TILE_SIZE, from_y / TILE_SIZE, to_x / TILE_SIZE,
+				to_y / TILE_SIZE));
+}
+
+/**
+ * net_host_view - Lists the clients a hosting game's players can see.
+ * @game: Pointer to the Game structure, hosting a server.
+ *
+ * Each local player gets the same visibility query as a client; a
+ * client seen by both is listed once.
+ */
+static void net_host_view(struct Game *game)
+{
+	struct NetServer *server = game->server;
+	Uint16 ids[NET_MAX_VISIBLE];
+	int i, j, k;
+
+	server->remote_count = 0;
+	for (i = 0; i < game->player_count; i++)
+	{
+		net_interest(server, &game->players[i], i, &server->state);
+		for (j = 0; j < server->state.count; j++)
+		{
+			k = 0;
+			while (k < server->remote_count &&
+					ids[k] != server->state.entities[j].id)
+				k++;
+			if (server->state.entities[j].id < MAX_PLAYERS ||
+					k < server->remote_count ||
+					server->remote_count == NET_MAX_VISIBLE)
+				continue;
+			ids[server->remote_count] = server->state.entities[j].id;
+			net_player(&server->state.entities[j],
+					&server->remote[server->remote_count++]);
+		}
+	}
+	game->remote = server->remote;
+	game->remote_count = server->remote_count;
+}
@@ -0,0 +1,73 @@
+#include "../inc/input.h"
+
+/**
+ * struct PlayerControls - Keys driving one local player
+ * @forward: move forward
+ * @backward: move backward
+ * @strafe_left: step left
+ * @strafe_right: step right
+ * @turn_left: rotate counterclockwise
+ * @turn_right: rotate clockwise
+ */
+struct PlayerControls
+{
+	SDL_Scancode forward;
+	SDL_Scancode backward;
+	SDL_Scancode strafe_left;
+	SDL_Scancode strafe_right;
+	SDL_Scancode turn_left;
+	SDL_Scancode turn_right;
+};
+
+static const struct PlayerControls player_controls[MAX_PLAYERS] = {
+	{SDL_SCANCODE_W, SDL_SCANCODE_S, SDL_SCANCODE_A, SDL_SCANCODE_D,
+		SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT},
+	{SDL_SCANCODE_I, SDL_SCANCODE_K, SDL_SCANCODE_J, SDL_SCANCODE_L,
+		SDL_SCANCODE_U, SDL_SCANCODE_O}
+};
+
+/**
+ * input_buttons - Reads which keys of a player are held.
+ * @game: Pointer to the Game structure.
+ * @index: Index of the player.
+ *
+ * Local movement reads the keys through these flags too, so a player
+ * moves the same whether its keys come from the keyboard or a client.
+ *
+ * Return: InputButton flags of the keys held.
+ */
+int input_buttons(const struct Game *game, int index)
+{
+	const struct PlayerControls *controls = &player_controls[index];
+	const SDL_Scancode keys[INPUT_BUTTONS] = {controls->forward,
+		controls->backward, controls->strafe_left, controls->strafe_right,
+		controls->turn_left, controls->turn_right};
+	int i, buttons = 0;
+
+	for (i = 0; i < INPUT_BUTTONS; i++)
+		if (game->keyboard_state[keys[i]])
+			buttons |= 1 << i;
+	return (buttons);
+}
+
+/**
+ * input_press - Holds the keys of a player in a keyboard state.
+ * @keyboard_state: SDL_NUM_SCANCODES key states to write.
+ * @index: Index of the player whose keys are written.
+ * @buttons: InputButton flags of the keys to hold; the others are
+ *		released.
+ *
+ * A server replays a remote player's keys this way, so handle_rotation
+ * and handle_movement move it exactly as they move a local one.
+ */
+void input_press(Uint8 *keyboard_state, int index, int buttons)
+{
+	const struct PlayerControls *controls = &player_controls[index];
+	const SDL_Scancode keys[INPUT_BUTTONS] = {controls->forward,
+		controls->backward, controls->strafe_left, controls->strafe_right,
+		controls->turn_left, controls->turn_right};
+	int i;
+
+	for (i = 0; i < INPUT_BUTTONS; i++)
+		keyboard_state[keys[i]] = (buttons >> i) & 1;
+}
@@ -0,0 +1,152 @@
+#include "../inc/game.h"
+
+/**
+ * struct NetCandidate - An entity in range of a viewer
+ * @distance: squared distance to the viewer, -1 for the viewer itself
+ * @index: index of the entity in the server's entities
+ */
+struct NetCandidate
+{
+	float distance;
+	int index;
+};
+
+static int net_cell(const struct NetServer *server, float x, float y);
+static int net_nearer(const void *a, const void *b);
+static int net_compare(const void *a, const void *b);
+
+/**
+ * net_interest_prepare - Sorts the entities of the tick into interest
+ *		cells.
+ * @server: Pointer to the NetServer, its entities gathered.
+ *
+ * A counting sort: @cells first counts the entities of each cell, then
+ * serves as the cursor placing them, and finally holds where each cell
+ * starts in @order.
+ */
+void net_interest_prepare(struct NetServer *server)
+{
+	int cells = server->grid_width * server->grid_height, cell, i;
+	const struct NetEntity *entity;
+
+	memset(server->cells, 0, (cells + 1) * sizeof(*server->cells));
+	for (i = 0; i < server->entity_count; i++)
+	{
+		entity = &server->entities[i];
+		server->cells[net_cell(server, entity->x / NET_POSITION_SCALE,
+				entity->y / NET_POSITION_SCALE) + 1]++;
+	}
+	for (cell = 0; cell < cells; cell++)
+		server->cells[cell + 1] += server->cells[cell];
+	for (i = 0; i < server->entity_count; i++)
+	{
+		entity = &server->entities[i];
+		server->order[server->cells[net_cell(server,
+				entity->x / NET_POSITION_SCALE,
+				entity->y / NET_POSITION_SCALE)]++] = i;
+	}
+	for (cell = cells; cell > 0; cell--)
+		server->cells[cell] = server->cells[cell - 1];
+	server->cells[0] = 0;
+}
+
+/**
+ * net_interest - Lists the entities a player can see.
+ * @server: Pointer to the NetServer, its entities sorted into cells.
+ * @viewer: Pointer to the Player looking.
+ * @id: Entity id of the viewer, always listed.
+ * @state: Pointer to the NetState to fill, sorted by id.
+ *
+ * An entity is seen when it is within NET_VIEW_RANGE and no wall stands
+ * between it and the viewer, whichever way the viewer faces, so turning
+ * around never waits for a snapshot. Past NET_MAX_VISIBLE entities, the
+ * nearest ones are kept: entities in range are then tried nearest first
+ * until the list is full.
+ */
+void net_interest(const struct NetServer *server,
+		const struct Player *viewer, Uint16 id, struct NetState *state)
+{
+	struct NetCandidate candidates[MAX_PLAYERS + NET_MAX_CLIENTS];
+	int cell = net_cell(server, viewer->x, viewer->y), x, y, i, count = 0;
+	int cell_x = cell % server->grid_width, cell_y = cell / server->grid_width;
+	const struct NetEntity *entity;
+	float dx, dy;
+
+	for (y = SDL_max(cell_y - 1, 0); y <= SDL_min(cell_y + 1,
+				server->grid_height - 1); y++)
+		for (x = SDL_max(cell_x - 1, 0); x <= SDL_min(cell_x + 1,
+					server->grid_width - 1); x++)
+			for (i = server->cells[y * server->grid_width + x];
+					i < server->cells[y * server->grid_width + x + 1]; i++)
+			{
+				entity = &server->entities[server->order[i]];
+				dx = entity->x / NET_POSITION_SCALE - viewer->x;
+				dy = entity->y / NET_POSITION_SCALE - viewer->y;
+				candidates[count] = (struct NetCandidate){entity->id == id ? -1 :
+					dx * dx + dy * dy, server->order[i]};
+				if (candidates[count].distance <=
+						(float)NET_VIEW_RANGE * NET_VIEW_RANGE)
+					count++;
+			}
+	if (count > NET_MAX_VISIBLE)
+		qsort(candidates, count, sizeof(*candidates), net_nearer);
+	state->count = 0;
+	for (i = 0; i < count && state->count < NET_MAX_VISIBLE; i++)
+	{
+		entity = &server->entities[candidates[i].index];
+		if (candidates[i].distance < 0 || net_visible(&server->sim, viewer->x,
+					viewer->y, entity->x / NET_POSITION_SCALE,
+					entity->y / NET_POSITION_SCALE))
+			state->entities[state->count++] = *entity;
+	}
+	qsort(state->entities, state->count, sizeof(*state->entities),
+			net_compare);
+}
+
+/**
+ * net_cell - Finds the interest cell of a position.
+ * @server: Pointer to the NetServer.
+ * @x: x coordinate, in world units.
+ * @y: y coordinate, in world units.
+ *
+ * Return: Index of the cell, positions off the map going to the nearest
+ * cell.
+ */
+static int net_cell(const struct NetServer *server, float x, float y)
+{
+	int cell_x = SDL_max(0, SDL_min((int)(x / NET_VIEW_RANGE),
+				server->grid_width - 1));
+	int cell_y = SDL_max(0, SDL_min((int)(y / NET_VIEW_RANGE),
+				server->grid_height - 1));
+
+	return (cell_y * server->grid_width + cell_x);
+}
+
+/**
+ * net_nearer - Orders candidates nearest first for qsort.
+ * @a: Pointer to the first NetCandidate.
+ * @b: Pointer to the second NetCandidate.
+ *
+ * Return: Negative, zero or positive as @a is nearer, as near or farther
+ * than @b.
+ */
+static int net_nearer(const void *a, const void *b)
+{
+	float first = ((const struct NetCandidate *)a)->distance;
+	float second = ((const struct NetCandidate *)b)->distance;
+
+	return ((first > second) - (first < second));
+}
+
+/**
+ * net_compare - Orders entities by id for qsort.
+ * @a: Pointer to the first NetEntity.
+ * @b: Pointer to the second NetEntity.
+ *
+ * Return: Negative, zero or positive as @a comes before, with or after @b.
+ */
+static int net_compare(const void *a, const void *b)
+{
+	return ((int)((const struct NetEntity *)a)->id -
+			(int)((const struct NetEntity *)b)->id);
+}
@@ -0,0 +1,149 @@
+#include "../inc/game.h"
+#include <sys/socket.h>
+
+static void net_server_receive(struct NetServer *server);
+static void net_server_simulate(struct NetServer *server, float delta_time);
+static void net_server_send(struct NetServer *server, int slot);
+
+/**
+ * net_server_tick - Runs one tick of the server.
+ * @server: Pointer to the NetServer.
+ * @host: Pointer to the Game hosting the server, whose local players are
+ *		entities too; NULL for a server on its own.
+ * @delta_time: Time the tick simulates, in seconds.
+ *
+ * Inputs that arrived since the last tick are applied, every client is
+ * moved by its keys, then each one is sent what it can see.
+ */
+void net_server_tick(struct NetServer *server, const struct Game *host,
+		float delta_time)
+{
+	int slot, i;
+
+	server->tick++;
+	server->now = SDL_GetTicks();
+	server->stats.ticks++;
+	net_server_receive(server);
+	net_server_simulate(server, delta_time);
+	server->entity_count = 0;
+	for (i = 0; host && i < host->player_count; i++)
+		net_quantize(&host->players[i], i,
+				&server->entities[server->entity_count++]);
+	for (slot = 0; slot < server->peer_count; slot++)
+		if (server->peers[slot].active)
+			net_quantize(&server->peers[slot].player, MAX_PLAYERS + slot,
+					&server->entities[server->entity_count++]);
+	net_interest_prepare(server);
+	for (slot = 0; slot < server->peer_count; slot++)
+		if (server->peers[slot].active)
+			net_server_send(server, slot);
+}
+
+/**
+ * net_server_receive - Reads every datagram waiting on the socket.
+ * @server: Pointer to the NetServer.
+ *
+ * Only the newest input of a client counts, datagrams arriving out of
+ * order are dropped. Clients silent for NET_TIMEOUT_MS are let go.
+ */
+static void net_server_receive(struct NetServer *server)
+{
+	Uint8 packet[NET_PACKET_BYTES];
+	struct sockaddr_in address;
+	socklen_t size = sizeof(address);
+	struct NetPeer *peer;
+	ssize_t length;
+	Uint32 sequence, acked;
+	int slot;
+
+	while ((length = recvfrom(server->socket, packet, sizeof(packet), 0,
+					(struct sockaddr *)&address, &size)) > 0)
+	{
+		size = sizeof(address);
+		if (packet[0] == NET_HELLO)
+			net_server_join(server, &address, packet, length);
+		if (packet[0] != NET_INPUT || length < NET_INPUT_BYTES)
+			continue;
+		slot = (int)net_get(packet + 1, 2) - MAX_PLAYERS;
+		if (slot < 0 || slot >= server->peer_count)
+			continue;
+		peer = &server->peers[slot];
+		if (!peer->active ||
+				peer->address.sin_addr.s_addr != address.sin_addr.s_addr ||
+				peer->address.sin_port != address.sin_port)
+			continue;
+		peer->heard = server->now;
+		sequence = net_get(packet + 3, 4);
+		acked = net_get(packet + 7, 4);
+		if (sequence <= peer->sequence)
+			continue;
+		peer->sequence = sequence;
+		if (acked > peer->acked && acked <= server->tick)
+			peer->acked = acked;
+		peer->buttons = packet[11];
+	}
+	net_server_expire(server);
+}
+
+/**
+ * net_server_simulate - Moves every client by the keys it holds.
+ * @server: Pointer to the NetServer.
+ * @delta_time: Time the tick simulates, in seconds.
+ *
+ * Each client in turn becomes the first player of the server's map
+ * holder with its keys pressed, and goes through the same rotation,
+ * movement and collision rules as a local player.
+ */
+static void net_server_simulate(struct NetServer *server, float delta_time)
+{
+	float movement_speed = PLAYER_SPEED * delta_time;
+	float rotation_speed = ROTATION_SPEED * delta_time;
+	struct Player *player = &server->sim.players[0];
+	struct NetPeer *peer;
+
+	for (peer = server->peers; peer < server->peers + server->peer_count;
+			peer++)
+	{
+		if (!peer->active)
+			continue;
+		*player = peer->player;
+		input_press(server->keys, 0, peer->buttons);
+		handle_rotation(&server->sim, 0, rotation_speed);
+		handle_movement(&server->sim, 0, movement_speed);
+		update_direction(player);
+		keep_player_in_bounds(&server->sim, player);
+		peer->player = *player;
+	}
+}
+
+/**
+ * net_server_send - Sends a client the snapshot of this tick.
+ * @server: Pointer to the NetServer.
+ * @slot: Slot of the client.
+ *
+ * The snapshot holds what the client can see, encoded against the last
+ * snapshot it acknowledged while that one is still in the history, in
+ * full otherwise.
+ */
+static void net_server_send(struct NetServer *server, int slot)
+{
+	struct NetPeer *peer = &server->peers[slot];
+	const struct NetState *base = &peer->history[peer->acked % NET_HISTORY];
+	struct NetState *state = &peer->history[server->tick % NET_HISTORY];
+	Uint8 packet[NET_PACKET_BYTES];
+	int length;
+
+	if (!peer->acked || base->tick != peer->acked ||
+			server->tick - peer->acked >= NET_HISTORY)
+		base = NULL;
+	net_interest(server, &peer->player, MAX_PLAYERS + slot, state);
+	state->tick = server->tick;
+	length = net_encode(base, state, packet);
+	sendto(server->socket, packet, length, 0,
+			(const struct sockaddr *)&peer->address, sizeof(peer->address));
+	server->stats.snapshots++;
+	server->stats.bytes += length;
+	server->stats.full_bytes += NET_SNAPSHOT_HEADER + state->count *
+		NET_RECORD_FULL;
+	server->stats.entities += state->count;
+}
@@ -0,0 +1,110 @@
+#include "../inc/game.h"
+#include <sys/socket.h>
+
+static bool net_server_spawn(struct NetServer *server, int slot,
+		const struct sockaddr_in *address);
+
+/**
+ * net_server_expire - Lets go of the clients silent for NET_TIMEOUT_MS.
+ * @server: Pointer to the NetServer.
+ */
+void net_server_expire(struct NetServer *server)
+{
+	struct NetPeer *peer;
+	int slot;
+
+	for (slot = 0; slot < server->peer_count; slot++)
+	{
+		peer = &server->peers[slot];
+		if (!peer->active || server->now - peer->heard < NET_TIMEOUT_MS)
+			continue;
+		if (server->verbose)
+			printf("Player %d timed out\n", MAX_PLAYERS + slot);
+		peer->active = false;
+		free(peer->history);
+		peer->history = NULL;
+	}
+}
+
+/**
+ * net_server_join - Welcomes a client.
+ * @server: Pointer to the NetServer.
+ * @address: Address the hello came from.
+ * @packet: The hello.
+ * @length: Length of the hello.
+ *
+ * A client playing another map, or with other tile sizes, is ignored. A
+ * new client takes the first free slot and spawns on a random floor
+ * tile; a client whose welcome was lost is only welcomed again.
+ */
+void net_server_join(struct NetServer *server,
+		const struct sockaddr_in *address, const Uint8 *packet, int length)
+{
+	Uint8 welcome[NET_WELCOME_BYTES] = {NET_WELCOME};
+	struct NetPeer *peer;
+	int slot, free_slot = -1;
+
+	if (length < NET_HELLO_BYTES ||
+			(int)net_get(packet + 1, 4) != server->sim.map_width ||
+			(int)net_get(packet + 5, 4) != server->sim.map_height ||
+			(int)net_get(packet + 9, 2) != TILE_SIZE)
+		return;
+	for (slot = 0; slot < server->peer_count; slot++)
+	{
+		peer = &server->peers[slot];
+		if (peer->active && peer->address.sin_port == address->sin_port &&
+				peer->address.sin_addr.s_addr == address->sin_addr.s_addr)
+			break;
+		if (!peer->active && free_slot < 0)
+			free_slot = slot;
+	}
+	if (slot == server->peer_count)
+	{
+		slot = free_slot >= 0 ? free_slot : server->peer_count;
+		if (!net_server_spawn(server, slot, address))
+			return;
+	}
+	server->peers[slot].heard = server->now;
+	net_put(welcome + 1, MAX_PLAYERS + slot, 2);
+	sendto(server->socket, welcome, sizeof(welcome), 0,
+			(const struct sockaddr *)address, sizeof(*address));
+}
+
+/**
+ * net_server_spawn - Gives a new client a slot and a place in the map.
+ * @server: Pointer to the NetServer.
+ * @slot: Free slot, or peer_count to add one.
+ * @address: Address of the client.
+ *
+ * The client spawns on a random floor tile, or on tile 1,1 when
+ * NET_SPAWN_ATTEMPTS tiles in a row were not floor.
+ *
+ * Return: true on success, false if the server is full or memory ran out.
+ */
+static bool net_server_spawn(struct NetServer *server, int slot,
+		const struct sockaddr_in *address)
+{
+	struct NetPeer *peer = &server->peers[slot];
+	int x = 1, y = 1, attempt;
+
+	if (slot == NET_MAX_CLIENTS ||
+			!(peer->history = calloc(NET_HISTORY, sizeof(*peer->history))))
+		return (false);
+	for (attempt = 0; attempt < NET_SPAWN_ATTEMPTS; attempt++)
+	{
+		x = maze_rng_below(&server->rng, server->sim.map_width);
+		y = maze_rng_below(&server->rng, server->sim.map_height);
+		if (map_cell(&server->sim, x, y) == MAP_FLOOR)
+			break;
+		x = 1;
+		y = 1;
+	}
+	*peer = (struct NetPeer){*address, true, 0, 0, 0, 0, {x * TILE_SIZE +
+		TILE_SIZE / 2, y * TILE_SIZE + TILE_SIZE / 2, 0, 0,
+		maze_rng_below(&server->rng, 360) * PI / 180}, peer->history};
+	update_direction(&peer->player);
+	server->peer_count = SDL_max(server->peer_count, slot + 1);
+	if (server->verbose)
+		printf("Player %d joined\n", MAX_PLAYERS + slot);
+	return (true);
+}
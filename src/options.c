@@ -0,0 +1,187 @@
+#include "../inc/game.h"
+#include <limits.h>
+#include <stddef.h>
+
+/**
+ * enum OptionKind - What follows a command line flag
+ * @OPTION_SWITCH: nothing, the flag sets a bool
+ * @OPTION_INT: a positive int, at most the flag's max
+ * @OPTION_TEXT: a string, kept as it is in argv
+ */
+enum OptionKind
+{
+	OPTION_SWITCH,
+	OPTION_INT,
+	OPTION_TEXT
+};
+
+/**
+ * struct OptionFlag - A command line flag and the option it sets
+ * @name: the flag, dashes included
+ * @kind: what follows the flag
+ * @offset: offset of the option in struct Options
+ * @max: largest value of an OPTION_INT
+ */
+struct OptionFlag
+{
+	const char *name;
+	enum OptionKind kind;
+	size_t offset;
+	int max;
+};
+
+static const struct OptionFlag option_flags[] = {
+	{"--split-screen", OPTION_SWITCH, offsetof(struct Options, split_screen),
+		0},
+	{"--fixed-point", OPTION_SWITCH, offsetof(struct Options, fixed_point),
+		0},
+	{"--stats", OPTION_SWITCH, offsetof(struct Options, stats), 0},
+	{"--low-latency", OPTION_SWITCH, offsetof(struct Options, low_latency),
+		0},
+	{"--batched", OPTION_SWITCH, offsetof(struct Options, batched), 0},
+	{"--chunk-cache-mb", OPTION_INT,
+		offsetof(struct Options, chunk_cache_mb), INT_MAX / 2},
+	{"--capture", OPTION_TEXT, offsetof(struct Options, capture_path), 0},
+	{"--metrics", OPTION_TEXT, offsetof(struct Options, metrics_path), 0},
+	{"--serve", OPTION_INT, offsetof(struct Options, serve_port), 65535},
+	{"--variable-rate", OPTION_INT, offsetof(struct Options, cast_step),
+		CAST_BATCH_COLUMNS},
+	{"--connect", OPTION_TEXT, offsetof(struct Options, connect_address),
+		0},
+	{NULL, OPTION_SWITCH, 0, 0}
+};
+
+static bool parse_flag(int argc, char *argv[], int *i,
+		struct Options *options);
+static bool parse_int_option(const char *text, int *value);
+static bool parse_config_options(int argc, char *argv[]);
+
+/**
+ * parse_options - Parses the command line.
+ * @argc: argument count
+ * @argv: argument array
+ * @options: Pointer to the Options to fill.
+ *
+ * Usage: [--split-screen] [--fixed-point] [--stats] [--low-latency]
+ *		[--batched] [--chunk-cache-mb <N>] [--capture <file>]
+ *		[--metrics <socket>] [--serve <port> | --connect <host:port>]
+ *		[--variable-rate <step>] [--config <file>] [--<setting> <value>]
+ *		<map_file | maze:... | world:... | levels:...>
+ *
+ * The flags are those of option_flags. A connected game drives a single
+ * player, so --connect excludes --split-screen. The settings of
+ * config_set() go to the global config, see parse_config_options().
+ *
+ * Return: true if the command line is valid, false otherwise.
+ */
+bool parse_options(int argc, char *argv[], struct Options *options)
+{
+	int i;
+
+	*options = (struct Options){0};
+	options->cast_step = 1;
+	options->chunk_cache_mb = WORLD_DEFAULT_CACHE_MB;
+	if (!parse_config_options(argc, argv))
+		return (false);
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--config") == 0 ||
+				(strncmp(argv[i], "--", 2) == 0 && config_is_key(argv[i] + 2)))
+			i++;
+		else if (argv[i][0] == '-')
+		{
+			if (!parse_flag(argc, argv, &i, options))
+				return (false);
+		}
+		else if (options->map_path)
+			return (false);
+		else
+			options->map_path = argv[i];
+	}
+	if (options->connect_address && (options->serve_port ||
+				options->split_screen))
+		return (false);
+	return (options->map_path != NULL);
+}
+
+/**
+ * parse_flag - Sets the option of a flag of option_flags.
+ * @argc: argument count
+ * @argv: argument array
+ * @i: Pointer to the index of the flag, moved past its value.
+ * @options: Pointer to the Options to fill.
+ *
+ * Return: true if the flag exists and its value is valid, false otherwise.
+ */
+static bool parse_flag(int argc, char *argv[], int *i,
+		struct Options *options)
+{
+	const struct OptionFlag *flag = option_flags;
+	void *option;
+
+	while (flag->name && strcmp(argv[*i], flag->name) != 0)
+		flag++;
+	if (!flag->name)
+		return (false);
+	option = (char *)options + flag->offset;
+	if (flag->kind == OPTION_SWITCH)
+	{
+		*(bool *)option = true;
+		return (true);
+	}
+	if (++*i == argc)
+		return (false);
+	if (flag->kind == OPTION_TEXT)
+	{
+		*(const char **)option = argv[*i];
+		return (true);
+	}
+	return (parse_int_option(argv[*i], option) &&
+			*(int *)option <= flag->max);
+}
+
+/**
+ * parse_int_option - Parses the positive integer value of an option.
+ * @text: Option value.
+ * @value: Pointer to store the value.
+ *
+ * Return: true if the whole string is a positive integer.
+ */
+static bool parse_int_option(const char *text, int *value)
+{
+	char *end;
+	long number = strtol(text, &end, 10);
+
+	if (end == text || *end != '\0' || number <= 0 || number > INT_MAX / 2)
+		return (false);
+	*value = (int)number;
+	return (true);
+}
+
+/**
+ * parse_config_options - Fills the global config from the command line.
+ * @argc: argument count
+ * @argv: argument array
+ *
+ * The --config files are read first, in order, then the --<setting>
+ * flags override them wherever they stand on the line. The derived
+ * settings are computed once everything is read.
+ *
+ * Return: true if every file and setting is valid, false otherwise.
+ */
+static bool parse_config_options(int argc, char *argv[])
+{
+	int i;
+
+	for (i = 1; i < argc; i++)
+		if (strcmp(argv[i], "--config") == 0 && (++i == argc ||
+					!config_load(&config, argv[i])))
+			return (false);
+	for (i = 1; i < argc; i++)
+		if (strncmp(argv[i], "--", 2) == 0 && config_is_key(argv[i] + 2) &&
+				(++i == argc || !config_set(&config, argv[i - 1] + 2,
+						argv[i])))
+			return (false);
+	config_derive(&config);
+	return (true);
+}
@@ -0,0 +1,105 @@
+#include "../inc/game.h"
+
+static int latency_bucket(Uint32 milliseconds);
+
+/**
+ * pacing_wait - Sleeps until input must be sampled to make the next frame.
+ * @game: Pointer to the Game structure.
+ *
+ * The wait ends the slowest of the last PACING_HISTORY frames, plus
+ * PACING_MARGIN_MS, before the next present is due FRAME_PERIOD_MS after
+ * the last one. Input is then read as late as the frame allows instead of
+ * aging during a fixed sleep after the present.
+ */
+void pacing_wait(struct Game *game)
+{
+	struct FramePacing *pacing = &game->pacing;
+	Sint64 frequency = SDL_GetPerformanceFrequency(), predicted = 0, wait;
+	int i;
+
+	if (!pacing->last_present)
+		return;
+	for (i = 0; i < PACING_HISTORY; i++)
+		if ((Sint64)pacing->work[i] > predicted)
+			predicted = pacing->work[i];
+	wait = (Sint64)pacing->last_present + (FRAME_PERIOD_MS - PACING_MARGIN_MS) *
+		frequency / 1000 - predicted - (Sint64)SDL_GetPerformanceCounter();
+	if (wait > 0)
+		SDL_Delay(wait * 1000 / frequency);
+}
+
+/**
+ * pacing_input - Notes the time of an input event.
+ * @game: Pointer to the Game structure.
+ * @event: Event just polled.
+ *
+ * Only the oldest event waiting for a present is kept: it is the one
+ * that waited the longest for its effect to show.
+ */
+void pacing_input(struct Game *game, const SDL_Event *event)
+{
+	if ((event->type == SDL_KEYDOWN || event->type == SDL_KEYUP) &&
+			!game->pacing.input_ticks)
+		game->pacing.input_ticks = event->common.timestamp ?
+			event->common.timestamp : 1;
+}
+
+/**
+ * pacing_present - Records the timing of the frame just presented.
+ * @game: Pointer to the Game structure.
+ *
+ * Input events polled for the frame are now on screen: their latency
+ * goes into the frame statistics.
+ */
+void pacing_present(struct Game *game)
+{
+	struct FramePacing *pacing = &game->pacing;
+	Uint64 now = SDL_GetPerformanceCounter();
+
+	pacing->work[pacing->next] = now - pacing->sample_start;
+	pacing->next = (pacing->next + 1) % PACING_HISTORY;
+	pacing->last_present = now;
+	if (pacing->input_ticks)
+	{
+		game->stats.latency[latency_bucket(SDL_GetTicks() -
+				pacing->input_ticks)]++;
+		pacing->input_ticks = 0;
+	}
+}
+
+/**
+ * pacing_report - Prints the input-to-present latency histogram.
+ * @stats: Pointer to the FrameStats of the report window.
+ *
+ * Nothing is printed for a window without input events.
+ */
+void pacing_report(const struct FrameStats *stats)
+{
+	long total = 0;
+	int i;
+
+	for (i = 0; i < LATENCY_BUCKETS; i++)
+		total += stats->latency[i];
+	if (!total)
+		return;
+	printf("input latency");
+	for (i = 0; i < LATENCY_BUCKETS - 1; i++)
+		printf("  <%dms %ld", 1 << i, stats->latency[i]);
+	printf("  %dms+ %ld\n", 1 << (LATENCY_BUCKETS - 2),
+			stats->latency[LATENCY_BUCKETS - 1]);
+}
+
+/**
+ * latency_bucket - Picks the histogram bucket of a latency.
+ * @milliseconds: Latency.
+ *
+ * Return: 0 under 1 ms, i under 2^i ms, LATENCY_BUCKETS - 1 beyond.
+ */
+static int latency_bucket(Uint32 milliseconds)
+{
+	int bucket = 0;
+
+	while (bucket < LATENCY_BUCKETS - 1 && milliseconds >= 1u << bucket)
+		bucket++;
+	return (bucket);
+}
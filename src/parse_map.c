@@ -1,47 +1,154 @@
 #include "../inc/map.h"
+#include "../inc/maze_gen.h"
+#include "../inc/world.h"
+
+static bool read_map_rows(struct Game *game, FILE *file);
+static bool parse_map_row(struct Game *game, const char *line, int y);
+static bool append_map_row(struct Game *game, int *capacity_rows);
 
 /**
  * parse_map_file - Parses a map file and populates the game map.
  * @game: Pointer to the Game structure where the map will be stored.
- * @file_path: Path to the map file to be parsed.
+ * @file_path: Path to the map file to be parsed, or a maze specification
+ *		such as "maze:wilson:64x64:42" to generate the map instead, or a
+ *		world specification such as "world:42" to stream it in chunks.
+ *
+ * The map width is taken from the first line; every other line must have
+ * the same width. The map height is the number of lines.
+ *
  * Return: true if parsing and storing the map was successful, false otherwise.
  */
 bool parse_map_file(struct Game *game, const char *file_path)
 {
-	char line[MAP_WIDTH + 2];
-	int y, x;
-	FILE *file = fopen(file_path, "r");
+	FILE *file;
+	bool ok;
 
+	if (strncmp(file_path, MAZE_SPEC_PREFIX, strlen(MAZE_SPEC_PREFIX)) == 0)
+		return (load_generated_map(game, file_path));
+	if (strncmp(file_path, WORLD_SPEC_PREFIX, strlen(WORLD_SPEC_PREFIX)) == 0)
+		return (load_world_map(game, file_path));
+	file = fopen(file_path, "r");
 	if (!file)
 	{
 		fprintf(stderr, "Error opening map file: %s\n", file_path);
 		return (false);
 	}
 
-	for (y = 0; y < MAP_HEIGHT; y++)
+	free(game->map);
+	game->map = NULL;
+	game->map_width = 0;
+	game->map_height = 0;
+	ok = read_map_rows(game, file);
+	fclose(file);
+	if (!ok || game->map_height == 0)
 	{
-		if (fgets(line, sizeof(line), file) == NULL)
-		{
-			fprintf(stderr, "Error reading map file or incorrect format.\n");
-			fclose(file);
+		fprintf(stderr, "Error reading map file or incorrect format.\n");
+		return (false);
+	}
+	return (true);
+}
+
+/**
+ * read_map_rows - Reads the lines of a map file into the map.
+ * @game: Pointer to the Game structure, its map empty.
+ * @file: Map file, read up to its end or its first empty line.
+ *
+ * Return: true if every line was a valid row, false otherwise.
+ */
+static bool read_map_rows(struct Game *game, FILE *file)
+{
+	char *line = NULL;
+	size_t line_capacity = 0;
+	ssize_t length;
+	int capacity_rows = 0;
+	bool ok = true;
+
+	while (ok && (length = getline(&line, &line_capacity, file)) != -1)
+	{
+		while (length > 0 && (line[length - 1] == '\n' ||
+					line[length - 1] == '\r'))
+			line[--length] = '\0';
+		if (length == 0)
+			break;
+		if (game->map_height == 0)
+			game->map_width = length <= MAP_MAX_DIMENSION ? length : 0;
+		ok = length == game->map_width && append_map_row(game, &capacity_rows)
+			&& parse_map_row(game, line, game->map_height - 1);
+	}
+	free(line);
+	return (ok);
+}
+
+/**
+ * append_map_row - Grows the map by one row, doubling the storage as needed.
+ * @game: Pointer to the Game structure holding the map.
+ * @capacity_rows: Pointer to the number of rows currently allocated.
+ *
+ * Return: true on success, false if the map is too tall or memory runs out.
+ */
+static bool append_map_row(struct Game *game, int *capacity_rows)
+{
+	int *grown;
+	int rows;
+
+	if (game->map_height >= MAP_MAX_DIMENSION)
+		return (false);
+	if (game->map_height == *capacity_rows)
+	{
+		rows = *capacity_rows ? *capacity_rows * 2 : 32;
+		grown = realloc(game->map,
+				(size_t)rows * game->map_width * sizeof(*game->map));
+		if (!grown)
 			return (false);
-		}
-		for (x = 0; x < MAP_WIDTH; x++)
+		game->map = grown;
+		*capacity_rows = rows;
+	}
+	game->map_height++;
+	return (true);
+}
+
+/**
+ * parse_map_row - Converts one line of the map file into map tiles.
+ * @game: Pointer to the Game structure holding the map.
+ * @line: Line of map characters, exactly map_width long.
+ * @y: Index of the row being parsed.
+ *
+ * Besides '1' walls and '0' floors, 'a' to 'p' are walls 1 to 16 eighths
+ * of a tile tall and 'A' to 'H' are floors raised by 1 to 8 eighths.
+ * '|' and '-' are thin walls across the middle of the cell, along y and
+ * along x; '!' and '=' are grates placed the same way. 'L' is a floor
+ * with a light at its center.
+ *
+ * Return: true if every character is valid, false otherwise.
+ */
+static bool parse_map_row(struct Game *game, const char *line, int y)
+{
+	int x;
+	int *row = game->map + (size_t)y * game->map_width;
+
+	for (x = 0; x < game->map_width; x++)
+	{
+		if (line[x] == MAP_WALL_CHAR)
+			row[x] = MAP_WALL;
+		else if (line[x] == MAP_FLOOR_CHAR)
+			row[x] = MAP_FLOOR;
+		else if (line[x] == MAP_LIGHT_CHAR)
+			row[x] = MAP_FLOOR | MAP_LIGHT_FLAG;
+		else if (line[x] >= MAP_LOW_WALL_CHAR &&
+				line[x] < MAP_LOW_WALL_CHAR + MAP_MAX_WALL_UNITS)
+			row[x] = MAP_CELL(MAP_WALL, line[x] - MAP_LOW_WALL_CHAR + 1);
+		else if (line[x] >= MAP_RAISED_FLOOR_CHAR &&
+				line[x] < MAP_RAISED_FLOOR_CHAR + MAP_HEIGHT_UNITS)
+			row[x] = MAP_CELL(MAP_FLOOR, line[x] - MAP_RAISED_FLOOR_CHAR + 1);
+		else if (line[x] && strchr(MAP_LAYER_CHARS, line[x]))
+			row[x] = MAP_THIN_X + (strchr(MAP_LAYER_CHARS, line[x]) -
+					MAP_LAYER_CHARS);
+		else
 		{
-			if (line[x] == '1')
-				game->map[y * MAP_WIDTH + x] = MAP_WALL;
-			else if (line[x] == '0')
-				game->map[y * MAP_WIDTH + x] = MAP_FLOOR;
-			else
-			{
-				fprintf(stderr, "Invalid character in map file at line %d, column %d.\n",
-						y + 1, x + 1);
-				fclose(file);
-				return (false);
-			}
+			fprintf(stderr, "Invalid character in map file at line %d, column %d.\n",
+					y + 1, x + 1);
+			return (false);
 		}
 	}
-
-	fclose(file);
 	return (true);
 }
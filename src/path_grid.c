@@ -0,0 +1,75 @@
+#include "../inc/pathfind.h"
+
+/**
+ * path_grid_search - A* over the 8-connected tile grid inside a rectangle.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @start: Map index of the start tile.
+ * @goal: Map index of the goal tile, or -1 to run a Dijkstra flood that
+ *		reaches every tile of the rectangle.
+ * @bounds: Rectangle the search may not leave.
+ *
+ * Return: true if the goal was reached (always true for a flood).
+ */
+bool path_grid_search(struct Pathfinder *pathfinder, int start, int goal,
+		const struct PathBounds *bounds)
+{
+	static const int dx[8] = {1, -1, 0, 0, 1, 1, -1, -1};
+	static const int dy[8] = {0, 0, 1, -1, 1, -1, 1, -1};
+	struct PathNodes *nodes = &pathfinder->grid;
+	int width = pathfinder->width, node, next, x, y, nx, ny, dir;
+
+	path_nodes_begin(nodes);
+	path_nodes_relax(nodes, start, -1, 0,
+			goal < 0 ? 0 : path_octile(pathfinder, start, goal));
+	while ((node = path_nodes_pop(nodes)) >= 0)
+	{
+		pathfinder->expanded++;
+		if (node == goal)
+			return (true);
+		x = node % width;
+		y = node / width;
+		for (dir = 0; dir < 8; dir++)
+		{
+			nx = x + dx[dir];
+			ny = y + dy[dir];
+			if (nx < bounds->min_x || nx >= bounds->max_x ||
+					ny < bounds->min_y || ny >= bounds->max_y ||
+					!path_walkable(pathfinder, nx, ny) || (dir >= 4 &&
+					(!path_walkable(pathfinder, nx, y) ||
+					 !path_walkable(pathfinder, x, ny))))
+				continue;
+			next = ny * width + nx;
+			path_nodes_relax(nodes, next, node, nodes->g[node] +
+					(dir < 4 ? PATH_STRAIGHT_COST : PATH_DIAGONAL_COST),
+					goal < 0 ? 0 : path_octile(pathfinder, next, goal));
+		}
+	}
+	return (goal < 0);
+}
+
+/**
+ * path_append - Appends the tiles of the last grid search to the path.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @goal: Map index of the tile the path ends on.
+ * @length: Number of tiles already in the path; when positive, the last
+ *		of them is the search start and is not repeated.
+ *
+ * Return: New path length, or -1 if the path buffer would overflow.
+ */
+int path_append(struct Pathfinder *pathfinder, int goal, int length)
+{
+	int *parent = pathfinder->grid.parent;
+	int count = 0, node, position;
+
+	for (node = goal; node >= 0; node = parent[node])
+		count++;
+	if (length > 0)
+		count--;
+	if ((size_t)length + count >
+			(size_t)pathfinder->width * pathfinder->height)
+		return (-1);
+	position = length + count;
+	for (node = goal; position > length; node = parent[node])
+		pathfinder->path[--position] = node;
+	return (length + count);
+}
@@ -0,0 +1,159 @@
+#include "../inc/pathfind.h"
+
+static void hpa_scan_border(struct Pathfinder *pathfinder, int x, int y,
+		int step_x, int step_y, int length);
+static int hpa_number_nodes(struct Pathfinder *pathfinder, int *first_node);
+
+/**
+ * hpa_build - Precomputes the HPA* cluster hierarchy of the map.
+ * @pathfinder: Pointer to the Pathfinder.
+ *
+ * The map is cut into PATH_CLUSTER_SIZE square clusters. Every run of open
+ * tiles along a cluster border becomes one or two entrances; the tiles on
+ * both sides of an entrance are the abstract nodes. Nodes are then linked
+ * to their neighbours across the border and to every node of their own
+ * cluster they can reach without leaving it.
+ *
+ * Return: true on success, false on allocation failure.
+ */
+bool hpa_build(struct Pathfinder *pathfinder)
+{
+	struct HpaGraph *hpa = &pathfinder->hpa;
+	size_t tiles = (size_t)pathfinder->width * pathfinder->height, i;
+	int clusters, cx, cy, *first_node;
+	bool ok;
+
+	hpa->clusters_x = (pathfinder->width + PATH_CLUSTER_SIZE - 1) /
+		PATH_CLUSTER_SIZE;
+	hpa->clusters_y = (pathfinder->height + PATH_CLUSTER_SIZE - 1) /
+		PATH_CLUSTER_SIZE;
+	clusters = hpa->clusters_x * hpa->clusters_y;
+	hpa->node_of_tile = arena_alloc(&pathfinder->arena,
+			tiles * sizeof(*hpa->node_of_tile));
+	first_node = malloc((clusters + 1) * sizeof(*first_node));
+	if (!hpa->node_of_tile || !first_node)
+	{
+		free(first_node);
+		return (false);
+	}
+	for (i = 0; i < tiles; i++)
+		hpa->node_of_tile[i] = -1;
+	for (cy = 0; cy < hpa->clusters_y; cy++)
+		for (cx = 0; cx < hpa->clusters_x; cx++)
+		{
+			if (cx + 1 < hpa->clusters_x)
+				hpa_scan_border(pathfinder, (cx + 1) * PATH_CLUSTER_SIZE - 1,
+						cy * PATH_CLUSTER_SIZE, 1, 0, PATH_CLUSTER_SIZE);
+			if (cy + 1 < hpa->clusters_y)
+				hpa_scan_border(pathfinder, cx * PATH_CLUSTER_SIZE,
+						(cy + 1) * PATH_CLUSTER_SIZE - 1, 0, 1, PATH_CLUSTER_SIZE);
+		}
+	hpa->node_count = hpa_number_nodes(pathfinder, first_node);
+	ok = hpa_alloc_graph(pathfinder, first_node);
+	free(first_node);
+	return (ok && hpa_link_nodes(pathfinder));
+}
+
+/**
+ * hpa_cluster_of - Finds the cluster holding a tile.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @tile: Map index of the tile.
+ *
+ * Return: Cluster index.
+ */
+int hpa_cluster_of(const struct Pathfinder *pathfinder, int tile)
+{
+	return ((tile / pathfinder->width) / PATH_CLUSTER_SIZE *
+		pathfinder->hpa.clusters_x +
+		(tile % pathfinder->width) / PATH_CLUSTER_SIZE);
+}
+
+/**
+ * hpa_cluster_bounds - Computes the tile rectangle of a cluster.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @cluster: Cluster index.
+ * @bounds: Pointer to the PathBounds to fill.
+ */
+void hpa_cluster_bounds(const struct Pathfinder *pathfinder, int cluster,
+		struct PathBounds *bounds)
+{
+	bounds->min_x = cluster % pathfinder->hpa.clusters_x * PATH_CLUSTER_SIZE;
+	bounds->min_y = cluster / pathfinder->hpa.clusters_x * PATH_CLUSTER_SIZE;
+	bounds->max_x = bounds->min_x + PATH_CLUSTER_SIZE;
+	bounds->max_y = bounds->min_y + PATH_CLUSTER_SIZE;
+	if (bounds->max_x > pathfinder->width)
+		bounds->max_x = pathfinder->width;
+	if (bounds->max_y > pathfinder->height)
+		bounds->max_y = pathfinder->height;
+}
+
+/**
+ * hpa_scan_border - Marks the entrance tiles along one cluster border.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @x: Column of the first tile on the near side of the border.
+ * @y: Row of the first tile on the near side of the border.
+ * @step_x: 1 if the far side lies to the right, 0 if it lies below.
+ * @step_y: 1 if the far side lies below, 0 if it lies to the right.
+ * @length: Number of tiles along the border.
+ *
+ * A run of tile pairs open on both sides gets one entrance in its middle,
+ * or one at each end when it is at least PATH_ENTRANCE_SPLIT long.
+ */
+static void hpa_scan_border(struct Pathfinder *pathfinder, int x, int y,
+		int step_x, int step_y, int length)
+{
+	int *node_of_tile = pathfinder->hpa.node_of_tile;
+	int width = pathfinder->width, i, run = 0, mark[2], m;
+	bool open;
+
+	for (i = 0; i <= length; i++)
+	{
+		open = i < length &&
+			path_walkable(pathfinder, x + step_y * i, y + step_x * i) &&
+			path_walkable(pathfinder, x + step_y * i + step_x,
+					y + step_x * i + step_y);
+		if (open)
+		{
+			run++;
+			continue;
+		}
+		if (run == 0)
+			continue;
+		mark[0] = run < PATH_ENTRANCE_SPLIT ? i - run + run / 2 : i - run;
+		mark[1] = run < PATH_ENTRANCE_SPLIT ? mark[0] : i - 1;
+		for (m = 0; m < 2; m++)
+		{
+			node_of_tile[(y + step_x * mark[m]) * width + x + step_y * mark[m]] = -2;
+			node_of_tile[(y + step_x * mark[m] + step_y) * width +
+				x + step_y * mark[m] + step_x] = -2;
+		}
+		run = 0;
+	}
+}
+
+/**
+ * hpa_number_nodes - Numbers the marked entrance tiles cluster by cluster.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @first_node: Array receiving the first node of every cluster, followed
+ *		by the total node count.
+ *
+ * Return: Number of abstract nodes.
+ */
+static int hpa_number_nodes(struct Pathfinder *pathfinder, int *first_node)
+{
+	struct HpaGraph *hpa = &pathfinder->hpa;
+	struct PathBounds bounds;
+	int clusters = hpa->clusters_x * hpa->clusters_y, cluster, x, y, id = 0;
+
+	for (cluster = 0; cluster < clusters; cluster++)
+	{
+		first_node[cluster] = id;
+		hpa_cluster_bounds(pathfinder, cluster, &bounds);
+		for (y = bounds.min_y; y < bounds.max_y; y++)
+			for (x = bounds.min_x; x < bounds.max_x; x++)
+				if (hpa->node_of_tile[y * pathfinder->width + x] == -2)
+					hpa->node_of_tile[y * pathfinder->width + x] = id++;
+	}
+	first_node[clusters] = id;
+	return (id);
+}
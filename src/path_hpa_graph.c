@@ -0,0 +1,42 @@
+#include "../inc/pathfind.h"
+
+/**
+ * hpa_alloc_graph - Carves the nodes, edges and search state of the
+ *		abstract graph from one arena.
+ * @pathfinder: Pointer to the Pathfinder, its nodes numbered.
+ * @first_node: First node of every cluster, and the node count last.
+ *
+ * Every node gets room for an edge to each other node of its cluster and
+ * for four edges across borders.
+ *
+ * Return: true on success, false on allocation failure.
+ */
+bool hpa_alloc_graph(struct Pathfinder *pathfinder,
+		const int *first_node)
+{
+	struct HpaGraph *hpa = &pathfinder->hpa;
+	int clusters = hpa->clusters_x * hpa->clusters_y, cluster, count;
+	long intra = 0;
+	size_t size;
+
+	for (cluster = 0; cluster < clusters; cluster++)
+	{
+		count = first_node[cluster + 1] - first_node[cluster];
+		intra += (long)count * (count - 1);
+	}
+	size = (clusters + 1) * sizeof(int) + hpa->node_count *
+		sizeof(struct HpaNode) + (intra + 4L * hpa->node_count) *
+		sizeof(struct HpaEdge) + (hpa->node_count + 2) * PATH_TILE_BYTES +
+		16 * ARENA_ALIGNMENT;
+	if (!arena_init_from(&hpa->arena, pathfinder->parent, size) ||
+			!(hpa->cluster_first_node = arena_alloc(&hpa->arena,
+					(clusters + 1) * sizeof(int))) ||
+			!(hpa->nodes = arena_alloc(&hpa->arena,
+					hpa->node_count * sizeof(*hpa->nodes))) ||
+			!(hpa->edges = arena_alloc(&hpa->arena, (intra +
+						4L * hpa->node_count) * sizeof(*hpa->edges))) ||
+			!path_nodes_init(&hpa->search, &hpa->arena, hpa->node_count + 2))
+		return (false);
+	memcpy(hpa->cluster_first_node, first_node, (clusters + 1) * sizeof(int));
+	return (true);
+}
@@ -0,0 +1,85 @@
+#include "../inc/pathfind.h"
+
+static void hpa_link_border(struct Pathfinder *pathfinder, int node);
+
+/**
+ * hpa_link_nodes - Fills in the nodes and edges of the HPA* graph.
+ * @pathfinder: Pointer to the Pathfinder whose node_of_tile and
+ *		cluster_first_node are already numbered.
+ *
+ * Each node floods its own cluster once; every other node of the cluster
+ * the flood reaches gets an edge costing the in-cluster path length.
+ *
+ * Return: true on success.
+ */
+bool hpa_link_nodes(struct Pathfinder *pathfinder)
+{
+	struct HpaGraph *hpa = &pathfinder->hpa;
+	struct PathBounds bounds;
+	int cluster, node, other, x, y, tile;
+	int clusters = hpa->clusters_x * hpa->clusters_y;
+
+	hpa->edge_count = 0;
+	for (cluster = 0; cluster < clusters; cluster++)
+	{
+		hpa_cluster_bounds(pathfinder, cluster, &bounds);
+		for (y = bounds.min_y; y < bounds.max_y; y++)
+			for (x = bounds.min_x; x < bounds.max_x; x++)
+			{
+				node = hpa->node_of_tile[y * pathfinder->width + x];
+				if (node < 0)
+					continue;
+				hpa->nodes[node].tile = y * pathfinder->width + x;
+				hpa->nodes[node].cluster = cluster;
+			}
+		for (node = hpa->cluster_first_node[cluster];
+				node < hpa->cluster_first_node[cluster + 1]; node++)
+		{
+			hpa->nodes[node].first_edge = hpa->edge_count;
+			path_grid_search(pathfinder, hpa->nodes[node].tile, -1, &bounds);
+			for (other = hpa->cluster_first_node[cluster];
+					other < hpa->cluster_first_node[cluster + 1]; other++)
+			{
+				tile = hpa->nodes[other].tile;
+				if (other == node ||
+						pathfinder->grid.stamp[tile] != pathfinder->grid.generation)
+					continue;
+				hpa->edges[hpa->edge_count].to = other;
+				hpa->edges[hpa->edge_count++].cost = pathfinder->grid.g[tile];
+			}
+			hpa_link_border(pathfinder, node);
+			hpa->nodes[node].edge_count = hpa->edge_count -
+				hpa->nodes[node].first_edge;
+		}
+	}
+	pathfinder->expanded = 0;
+	return (true);
+}
+
+/**
+ * hpa_link_border - Adds the edges of a node to the nodes facing it across
+ *		a cluster border.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @node: Node whose tile is checked against its four neighbours.
+ */
+static void hpa_link_border(struct Pathfinder *pathfinder, int node)
+{
+	static const int dx[4] = {1, -1, 0, 0};
+	static const int dy[4] = {0, 0, 1, -1};
+	struct HpaGraph *hpa = &pathfinder->hpa;
+	int tile = hpa->nodes[node].tile, dir, x, y, other;
+
+	for (dir = 0; dir < 4; dir++)
+	{
+		x = tile % pathfinder->width + dx[dir];
+		y = tile / pathfinder->width + dy[dir];
+		if (!path_walkable(pathfinder, x, y))
+			continue;
+		other = hpa->node_of_tile[y * pathfinder->width + x];
+		if (other < 0 || hpa_cluster_of(pathfinder, y * pathfinder->width + x)
+				== hpa->nodes[node].cluster)
+			continue;
+		hpa->edges[hpa->edge_count].to = other;
+		hpa->edges[hpa->edge_count++].cost = PATH_STRAIGHT_COST;
+	}
+}
@@ -0,0 +1,201 @@
+#include "../inc/pathfind.h"
+
+/**
+ * struct HpaLink - Temporary edge between a query endpoint and a node
+ * @node: abstract node of the endpoint's cluster
+ * @cost: in-cluster path length between the endpoint and the node
+ */
+struct HpaLink
+{
+	int node;
+	float cost;
+};
+
+static struct HpaLink *hpa_connect(struct Pathfinder *pathfinder, int tile,
+		int *count);
+static int hpa_abstract_search(struct Pathfinder *pathfinder, int start,
+		int goal, const struct HpaLink *links[2], const int counts[2]);
+static bool hpa_refine(struct Pathfinder *pathfinder, const int *tiles,
+		int count, struct PathResult *result);
+
+/**
+ * hpa_search - Hierarchical A* query.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @start: Map index of the start tile.
+ * @goal: Map index of the goal tile.
+ * @result: Pointer to the PathResult receiving the refined path.
+ *
+ * Endpoints sharing a cluster are first joined by an in-cluster search.
+ * Otherwise both endpoints are linked to the nodes of their cluster, A*
+ * runs over the abstract graph, and each abstract step is refined into
+ * tiles with a search bounded to one cluster.
+ *
+ * Return: true if a path was found.
+ */
+bool hpa_search(struct Pathfinder *pathfinder, int start, int goal,
+		struct PathResult *result)
+{
+	struct HpaGraph *hpa = &pathfinder->hpa;
+	const struct HpaLink *links[2];
+	struct PathBounds bounds;
+	int counts[2], node, length = 0, position, *tiles;
+
+	if (hpa_cluster_of(pathfinder, start) == hpa_cluster_of(pathfinder, goal))
+	{
+		hpa_cluster_bounds(pathfinder, hpa_cluster_of(pathfinder, start),
+				&bounds);
+		if (path_grid_search(pathfinder, start, goal, &bounds))
+		{
+			result->cost = pathfinder->grid.g[goal];
+			result->length = path_append(pathfinder, goal, 0);
+			return (result->length > 0);
+		}
+	}
+	links[0] = hpa_connect(pathfinder, start, &counts[0]);
+	links[1] = hpa_connect(pathfinder, goal, &counts[1]);
+	if (!links[0] || !links[1] ||
+			hpa_abstract_search(pathfinder, start, goal, links, counts) < 0)
+		return (false);
+	for (node = hpa->node_count + 1; node >= 0;
+			node = hpa->search.parent[node])
+		length++;
+	tiles = arena_alloc(&pathfinder->scratch, length * sizeof(*tiles));
+	if (!tiles)
+		return (false);
+	position = length;
+	for (node = hpa->node_count + 1; node >= 0;
+			node = hpa->search.parent[node])
+		tiles[--position] = node == hpa->node_count ? start :
+			node == hpa->node_count + 1 ? goal : hpa->nodes[node].tile;
+	return (hpa_refine(pathfinder, tiles, length, result));
+}
+
+/**
+ * hpa_connect - Links a query endpoint to the nodes of its cluster.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @tile: Map index of the endpoint.
+ * @count: Pointer receiving the number of links.
+ *
+ * Return: Links allocated from the scratch arena, or NULL if it is full.
+ */
+static struct HpaLink *hpa_connect(struct Pathfinder *pathfinder, int tile,
+		int *count)
+{
+	struct HpaGraph *hpa = &pathfinder->hpa;
+	int cluster = hpa_cluster_of(pathfinder, tile), node, first, last;
+	struct PathBounds bounds;
+	struct HpaLink *links;
+
+	first = hpa->cluster_first_node[cluster];
+	last = hpa->cluster_first_node[cluster + 1];
+	links = arena_alloc(&pathfinder->scratch,
+			(last - first + 1) * sizeof(*links));
+	if (!links)
+		return (NULL);
+	hpa_cluster_bounds(pathfinder, cluster, &bounds);
+	path_grid_search(pathfinder, tile, -1, &bounds);
+	for (*count = 0, node = first; node < last; node++)
+	{
+		if (pathfinder->grid.stamp[hpa->nodes[node].tile] !=
+				pathfinder->grid.generation)
+			continue;
+		links[*count].node = node;
+		links[(*count)++].cost = pathfinder->grid.g[hpa->nodes[node].tile];
+	}
+	return (links);
+}
+
+/**
+ * hpa_abstract_search - A* over the abstract graph.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @start: Map index of the start tile.
+ * @goal: Map index of the goal tile.
+ * @links: Links of the start (0) and goal (1) to their clusters' nodes.
+ * @counts: Number of links of the start and the goal.
+ *
+ * The start and goal take the two search slots after the real nodes.
+ *
+ * Return: Slot of the goal when reached, -1 otherwise.
+ */
+static int hpa_abstract_search(struct Pathfinder *pathfinder, int start,
+		int goal, const struct HpaLink *links[2], const int counts[2])
+{
+	struct HpaGraph *hpa = &pathfinder->hpa;
+	struct PathNodes *search = &hpa->search;
+	int goal_slot = hpa->node_count + 1, node, i, to;
+	float g;
+
+	path_nodes_begin(search);
+	path_nodes_relax(search, hpa->node_count, -1, 0,
+			path_octile(pathfinder, start, goal));
+	while ((node = path_nodes_pop(search)) >= 0)
+	{
+		pathfinder->expanded++;
+		if (node == goal_slot)
+			return (node);
+		g = search->g[node];
+		if (node == hpa->node_count)
+		{
+			for (i = 0; i < counts[0]; i++)
+				path_nodes_relax(search, links[0][i].node, node,
+						links[0][i].cost, path_octile(pathfinder,
+							hpa->nodes[links[0][i].node].tile, goal));
+			continue;
+		}
+		for (i = 0; i < hpa->nodes[node].edge_count; i++)
+		{
+			to = hpa->edges[hpa->nodes[node].first_edge + i].to;
+			path_nodes_relax(search, to, node,
+					g + hpa->edges[hpa->nodes[node].first_edge + i].cost,
+					path_octile(pathfinder, hpa->nodes[to].tile, goal));
+		}
+		for (i = 0; i < counts[1]; i++)
+			if (links[1][i].node == node)
+				path_nodes_relax(search, goal_slot, node,
+						g + links[1][i].cost, 0);
+	}
+	return (-1);
+}
+
+/**
+ * hpa_refine - Turns the abstract path into tiles.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @tiles: Tiles of the abstract path, start and goal included.
+ * @count: Number of entries in @tiles.
+ * @result: Pointer to the PathResult to fill.
+ *
+ * Consecutive tiles in one cluster are joined by a search bounded to that
+ * cluster; tiles in different clusters are neighbours across a border.
+ *
+ * Return: true on success.
+ */
+static bool hpa_refine(struct Pathfinder *pathfinder, const int *tiles,
+		int count, struct PathResult *result)
+{
+	struct PathBounds bounds;
+	int i, cluster, length = 1;
+
+	pathfinder->path[0] = tiles[0];
+	result->cost = 0;
+	for (i = 1; i < count && length > 0; i++)
+	{
+		if (tiles[i] == tiles[i - 1])
+			continue;
+		cluster = hpa_cluster_of(pathfinder, tiles[i]);
+		if (cluster != hpa_cluster_of(pathfinder, tiles[i - 1]))
+		{
+			if ((size_t)length >= (size_t)pathfinder->width * pathfinder->height)
+				return (false);
+			pathfinder->path[length++] = tiles[i];
+			result->cost += PATH_STRAIGHT_COST;
+			continue;
+		}
+		hpa_cluster_bounds(pathfinder, cluster, &bounds);
+		if (!path_grid_search(pathfinder, tiles[i - 1], tiles[i], &bounds))
+			return (false);
+		result->cost += pathfinder->grid.g[tiles[i]];
+		length = path_append(pathfinder, tiles[i], length);
+	}
+	result->length = length;
+	return (length > 0);
+}
@@ -0,0 +1,206 @@
+#include "../inc/pathfind.h"
+
+static int jps_jump(struct Pathfinder *pathfinder, int x, int y,
+		int dx, int dy, int goal);
+static int jps_directions(const struct Pathfinder *pathfinder, int node,
+		int dirs[8][2]);
+static int jps_push(int dirs[8][2], int count, int dx, int dy);
+
+/**
+ * path_jps_search - Jump Point Search from start to goal.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @start: Map index of the start tile.
+ * @goal: Map index of the goal tile.
+ *
+ * Only jump points enter the open list; the straight and diagonal runs
+ * between them are scanned without touching the heap. Parents therefore
+ * link jump points, see path_jps_append() for the full tile path.
+ *
+ * Return: true if the goal was reached.
+ */
+bool path_jps_search(struct Pathfinder *pathfinder, int start, int goal)
+{
+	struct PathNodes *nodes = &pathfinder->grid;
+	int dirs[8][2], count, i, node, jump;
+	int width = pathfinder->width;
+
+	path_nodes_begin(nodes);
+	path_nodes_relax(nodes, start, -1, 0, path_octile(pathfinder, start, goal));
+	while ((node = path_nodes_pop(nodes)) >= 0)
+	{
+		pathfinder->expanded++;
+		if (node == goal)
+			return (true);
+		count = jps_directions(pathfinder, node, dirs);
+		for (i = 0; i < count; i++)
+		{
+			jump = jps_jump(pathfinder, node % width, node / width,
+					dirs[i][0], dirs[i][1], goal);
+			if (jump >= 0)
+				path_nodes_relax(nodes, jump, node, nodes->g[node] +
+						path_octile(pathfinder, node, jump),
+						path_octile(pathfinder, jump, goal));
+		}
+	}
+	return (false);
+}
+
+/**
+ * path_jps_append - Expands the jump points of the last search into tiles.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @goal: Map index of the goal tile.
+ *
+ * Return: Path length in tiles, or -1 if the path buffer would overflow.
+ */
+int path_jps_append(struct Pathfinder *pathfinder, int goal)
+{
+	int *parent = pathfinder->grid.parent;
+	int width = pathfinder->width, count = 1, node, from, x, y, dx, dy;
+
+	for (node = goal; parent[node] >= 0; node = parent[node])
+	{
+		dx = abs(node % width - parent[node] % width);
+		dy = abs(node / width - parent[node] / width);
+		count += dx > dy ? dx : dy;
+	}
+	if ((size_t)count > (size_t)width * pathfinder->height)
+		return (-1);
+	pathfinder->path[count - 1] = goal;
+	for (node = goal, from = count - 1; parent[node] >= 0; node = parent[node])
+	{
+		x = node % width;
+		y = node / width;
+		dx = (parent[node] % width > x) - (parent[node] % width < x);
+		dy = (parent[node] / width > y) - (parent[node] / width < y);
+		while (x != parent[node] % width || y != parent[node] / width)
+		{
+			x += dx;
+			y += dy;
+			pathfinder->path[--from] = y * width + x;
+		}
+	}
+	return (count);
+}
+
+/**
+ * jps_jump - Scans from a tile in one direction until a jump point.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @x: Column of the tile the scan leaves from.
+ * @y: Row of the tile the scan leaves from.
+ * @dx: Column step, -1, 0 or 1.
+ * @dy: Row step, -1, 0 or 1.
+ * @goal: Map index of the goal tile.
+ *
+ * A tile is a jump point when it is the goal, when a neighbour can only be
+ * reached optimally through it (a forced neighbour), or, on a diagonal
+ * scan, when a straight scan from it finds a jump point.
+ *
+ * Return: Map index of the jump point, or -1 if the scan hits a wall.
+ */
+static int jps_jump(struct Pathfinder *pathfinder, int x, int y,
+		int dx, int dy, int goal)
+{
+	int node;
+
+	while (true)
+	{
+		if (dx && dy && (!path_walkable(pathfinder, x + dx, y) ||
+					!path_walkable(pathfinder, x, y + dy)))
+			return (-1);
+		x += dx;
+		y += dy;
+		if (!path_walkable(pathfinder, x, y))
+			return (-1);
+		node = y * pathfinder->width + x;
+		if (node == goal)
+			return (node);
+		if (dx && dy)
+		{
+			if (jps_jump(pathfinder, x, y, dx, 0, goal) >= 0 ||
+					jps_jump(pathfinder, x, y, 0, dy, goal) >= 0)
+				return (node);
+		}
+		else if (dx)
+		{
+			if ((path_walkable(pathfinder, x, y - 1) &&
+						!path_walkable(pathfinder, x - dx, y - 1)) ||
+					(path_walkable(pathfinder, x, y + 1) &&
+					 !path_walkable(pathfinder, x - dx, y + 1)))
+				return (node);
+		}
+		else if ((path_walkable(pathfinder, x - 1, y) &&
+					!path_walkable(pathfinder, x - 1, y - dy)) ||
+				(path_walkable(pathfinder, x + 1, y) &&
+				 !path_walkable(pathfinder, x + 1, y - dy)))
+			return (node);
+	}
+}
+
+/**
+ * jps_directions - Lists the pruned scan directions out of a jump point.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @node: Map index of the jump point being expanded.
+ * @dirs: Array receiving the (dx, dy) directions.
+ *
+ * Return: Number of directions written.
+ */
+static int jps_directions(const struct Pathfinder *pathfinder, int node,
+		int dirs[8][2])
+{
+	int parent = pathfinder->grid.parent[node], width = pathfinder->width;
+	int x = node % width, y = node / width, count = 0, dx, dy, i, turn;
+	bool ahead, side_a, side_b;
+
+	if (parent < 0)
+	{
+		for (i = 0; i < 9; i++)
+			if (i != 4)
+				count = jps_push(dirs, count, i % 3 - 1, i / 3 - 1);
+		return (count);
+	}
+	dx = (x > parent % width) - (x < parent % width);
+	dy = (y > parent / width) - (y < parent / width);
+	if (dx && dy)
+	{
+		side_a = path_walkable(pathfinder, x + dx, y);
+		side_b = path_walkable(pathfinder, x, y + dy);
+		if (side_a)
+			count = jps_push(dirs, count, dx, 0);
+		if (side_b)
+			count = jps_push(dirs, count, 0, dy);
+		if (side_a && side_b)
+			count = jps_push(dirs, count, dx, dy);
+		return (count);
+	}
+	ahead = path_walkable(pathfinder, x + dx, y + dy);
+	side_a = path_walkable(pathfinder, x + !dx, y + !dy);
+	side_b = path_walkable(pathfinder, x - !dx, y - !dy);
+	if (ahead)
+		count = jps_push(dirs, count, dx, dy);
+	for (i = 0; i < 2; i++)
+	{
+		if (!(i == 0 ? side_a : side_b))
+			continue;
+		turn = i == 0 ? 1 : -1;
+		count = jps_push(dirs, count, dx ? 0 : turn, dx ? turn : 0);
+		if (ahead)
+			count = jps_push(dirs, count, dx ? dx : turn, dx ? turn : dy);
+	}
+	return (count);
+}
+
+/**
+ * jps_push - Adds a direction to a list.
+ * @dirs: Array of (dx, dy) directions.
+ * @count: Number of directions already in @dirs.
+ * @dx: Step along x.
+ * @dy: Step along y.
+ *
+ * Return: The new number of directions.
+ */
+static int jps_push(int dirs[8][2], int count, int dx, int dy)
+{
+	dirs[count][0] = dx;
+	dirs[count][1] = dy;
+	return (count + 1);
+}
@@ -0,0 +1,104 @@
+#include "../inc/pathfind.h"
+
+static void heap_sift_up(struct PathNodes *nodes, int position);
+static void heap_sift_down(struct PathNodes *nodes, int position);
+
+/**
+ * path_nodes_relax - Offers a path of cost g to a node.
+ * @nodes: Pointer to the PathNodes.
+ * @node: Node reached.
+ * @parent: Node the path arrives from, or -1 for the start.
+ * @g: Cost of the path from the start.
+ * @h: Heuristic estimate from the node to the goal.
+ *
+ * Opens unvisited nodes and lowers the key of open nodes reached by a
+ * cheaper path. Closed nodes are final: the heuristic is consistent.
+ *
+ * Return: true if the node was opened or improved.
+ */
+bool path_nodes_relax(struct PathNodes *nodes, int node, int parent,
+		float g, float h)
+{
+	if (nodes->stamp[node] != nodes->generation)
+	{
+		nodes->stamp[node] = nodes->generation;
+		nodes->heap_pos[node] = nodes->heap_size;
+		nodes->heap[nodes->heap_size++] = node;
+	}
+	else if (nodes->heap_pos[node] < 0 || g >= nodes->g[node])
+		return (false);
+	nodes->g[node] = g;
+	nodes->f[node] = g + h;
+	nodes->parent[node] = parent;
+	heap_sift_up(nodes, nodes->heap_pos[node]);
+	return (true);
+}
+
+/**
+ * path_nodes_pop - Closes and returns the open node with the lowest f.
+ * @nodes: Pointer to the PathNodes.
+ *
+ * Return: The node, or -1 if the open list is empty.
+ */
+int path_nodes_pop(struct PathNodes *nodes)
+{
+	int top;
+
+	if (nodes->heap_size == 0)
+		return (-1);
+	top = nodes->heap[0];
+	nodes->heap_pos[top] = -1;
+	if (--nodes->heap_size > 0)
+	{
+		nodes->heap[0] = nodes->heap[nodes->heap_size];
+		nodes->heap_pos[nodes->heap[0]] = 0;
+		heap_sift_down(nodes, 0);
+	}
+	return (top);
+}
+
+/**
+ * heap_sift_up - Moves a heap entry up until its parent has a lower key.
+ * @nodes: Pointer to the PathNodes.
+ * @position: Heap position of the entry.
+ */
+static void heap_sift_up(struct PathNodes *nodes, int position)
+{
+	int node = nodes->heap[position], parent;
+
+	while (position > 0)
+	{
+		parent = (position - 1) / 2;
+		if (nodes->f[nodes->heap[parent]] <= nodes->f[node])
+			break;
+		nodes->heap[position] = nodes->heap[parent];
+		nodes->heap_pos[nodes->heap[position]] = position;
+		position = parent;
+	}
+	nodes->heap[position] = node;
+	nodes->heap_pos[node] = position;
+}
+
+/**
+ * heap_sift_down - Moves a heap entry down below its smaller children.
+ * @nodes: Pointer to the PathNodes.
+ * @position: Heap position of the entry.
+ */
+static void heap_sift_down(struct PathNodes *nodes, int position)
+{
+	int node = nodes->heap[position], child;
+
+	while ((child = 2 * position + 1) < nodes->heap_size)
+	{
+		if (child + 1 < nodes->heap_size &&
+				nodes->f[nodes->heap[child + 1]] < nodes->f[nodes->heap[child]])
+			child++;
+		if (nodes->f[node] <= nodes->f[nodes->heap[child]])
+			break;
+		nodes->heap[position] = nodes->heap[child];
+		nodes->heap_pos[nodes->heap[position]] = position;
+		position = child;
+	}
+	nodes->heap[position] = node;
+	nodes->heap_pos[node] = position;
+}
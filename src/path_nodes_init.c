@@ -0,0 +1,38 @@
+#include "../inc/pathfind.h"
+
+/**
+ * path_nodes_init - Carves the search arrays of count nodes from an arena.
+ * @nodes: Pointer to the PathNodes to initialize.
+ * @arena: Arena providing the memory.
+ * @count: Number of nodes.
+ *
+ * Return: true on success, false if the arena is too small.
+ */
+bool path_nodes_init(struct PathNodes *nodes, struct Arena *arena, int count)
+{
+	nodes->count = count;
+	nodes->heap_size = 0;
+	nodes->generation = 0;
+	nodes->g = arena_alloc(arena, count * sizeof(*nodes->g));
+	nodes->f = arena_alloc(arena, count * sizeof(*nodes->f));
+	nodes->parent = arena_alloc(arena, count * sizeof(*nodes->parent));
+	nodes->heap_pos = arena_alloc(arena, count * sizeof(*nodes->heap_pos));
+	nodes->heap = arena_alloc(arena, count * sizeof(*nodes->heap));
+	nodes->stamp = arena_calloc(arena, count, sizeof(*nodes->stamp));
+	return (nodes->g && nodes->f && nodes->parent && nodes->heap_pos &&
+		nodes->heap && nodes->stamp);
+}
+
+/**
+ * path_nodes_begin - Starts a new search, making every node unvisited.
+ * @nodes: Pointer to the PathNodes.
+ */
+void path_nodes_begin(struct PathNodes *nodes)
+{
+	nodes->heap_size = 0;
+	if (++nodes->generation == 0)
+	{
+		memset(nodes->stamp, 0, nodes->count * sizeof(*nodes->stamp));
+		nodes->generation = 1;
+	}
+}
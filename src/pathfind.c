@@ -0,0 +1,138 @@
+#include "../inc/pathfind.h"
+
+/**
+ * pathfinder_create - Builds the pathfinding service for a map.
+ * @map: Row-major tile grid; MAP_FLOOR tiles are walkable.
+ * @width: Map width in tiles.
+ * @height: Map height in tiles.
+ * @parent: Arena to carve every block from, or NULL to use malloc.
+ *
+ * Allocates every per-tile array once and precomputes the HPA* cluster
+ * hierarchy, so later queries only use memory the service already owns.
+ * The map must outlive the service and keep its walls. A service carved
+ * from @parent is released by resetting @parent.
+ *
+ * Return: The new Pathfinder, or NULL on allocation failure.
+ */
+struct Pathfinder *pathfinder_create(const int *map, int width, int height,
+		struct Arena *parent)
+{
+	size_t tiles = (size_t)width * height;
+	struct Pathfinder *pathfinder = parent ?
+		arena_calloc(parent, 1, sizeof(*pathfinder)) :
+		calloc(1, sizeof(*pathfinder));
+
+	if (!pathfinder)
+		return (NULL);
+	pathfinder->map = map;
+	pathfinder->width = width;
+	pathfinder->height = height;
+	pathfinder->parent = parent;
+	if (!arena_init_from(&pathfinder->arena, parent, tiles * PATH_TILE_BYTES +
+				16 * ARENA_ALIGNMENT) ||
+			!arena_init_from(&pathfinder->scratch, parent,
+				PATH_SCRATCH_BYTES) ||
+			!path_nodes_init(&pathfinder->grid, &pathfinder->arena, tiles) ||
+			!(pathfinder->path = arena_alloc(&pathfinder->arena,
+					tiles * sizeof(*pathfinder->path))) ||
+			!hpa_build(pathfinder))
+	{
+		pathfinder_destroy(pathfinder);
+		return (NULL);
+	}
+	return (pathfinder);
+}
+
+/**
+ * pathfinder_destroy - Releases a pathfinding service.
+ * @pathfinder: Pointer to the Pathfinder, may be NULL; a service carved
+ *		from a parent arena is left to that arena.
+ */
+void pathfinder_destroy(struct Pathfinder *pathfinder)
+{
+	if (!pathfinder || pathfinder->parent)
+		return;
+	arena_free(&pathfinder->hpa.arena);
+	arena_free(&pathfinder->scratch);
+	arena_free(&pathfinder->arena);
+	free(pathfinder);
+}
+
+/**
+ * pathfinder_query - Finds a path between two tiles.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @algorithm: Algorithm answering the query.
+ * @start: Map index of the start tile.
+ * @goal: Map index of the goal tile.
+ * @result: Pointer to the PathResult to fill.
+ *
+ * Moves are 8-connected; a diagonal step may not cut a wall corner.
+ * A* and JPS return shortest paths; HPA* returns a near-shortest one.
+ *
+ * Return: true if a path exists, false otherwise.
+ */
+bool pathfinder_query(struct Pathfinder *pathfinder,
+		enum PathAlgorithm algorithm, int start, int goal,
+		struct PathResult *result)
+{
+	struct PathBounds bounds = {0, 0, pathfinder->width, pathfinder->height};
+	int width = pathfinder->width;
+	bool found = false;
+
+	arena_reset(&pathfinder->scratch);
+	pathfinder->expanded = 0;
+	result->tiles = pathfinder->path;
+	result->length = 0;
+	result->cost = 0;
+	if (path_walkable(pathfinder, start % width, start / width) &&
+			path_walkable(pathfinder, goal % width, goal / width))
+	{
+		if (algorithm == PATH_HPA)
+			found = hpa_search(pathfinder, start, goal, result);
+		else if (algorithm == PATH_JPS)
+			found = path_jps_search(pathfinder, start, goal) &&
+				(result->length = path_jps_append(pathfinder, goal)) > 0;
+		else
+			found = path_grid_search(pathfinder, start, goal, &bounds) &&
+				(result->length = path_append(pathfinder, goal, 0)) > 0;
+		if (found && algorithm != PATH_HPA)
+			result->cost = pathfinder->grid.g[goal];
+	}
+	result->expanded = pathfinder->expanded;
+	return (found);
+}
+
+/**
+ * path_walkable - Checks whether a tile can be walked on.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @x: Tile column.
+ * @y: Tile row.
+ *
+ * Return: true for floor tiles inside the map, false otherwise.
+ */
+bool path_walkable(const struct Pathfinder *pathfinder, int x, int y)
+{
+	return (x >= 0 && x < pathfinder->width && y >= 0 &&
+		y < pathfinder->height &&
+		MAP_CELL_TYPE(pathfinder->map[y * pathfinder->width + x]) ==
+		MAP_FLOOR);
+}
+
+/**
+ * path_octile - Octile distance between two tiles, the exact cost of an
+ *		unobstructed 8-connected path.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @from: Map index of the first tile.
+ * @to: Map index of the second tile.
+ *
+ * Return: Distance in tiles.
+ */
+float path_octile(const struct Pathfinder *pathfinder, int from, int to)
+{
+	int dx = abs(from % pathfinder->width - to % pathfinder->width);
+	int dy = abs(from / pathfinder->width - to / pathfinder->width);
+
+	if (dx < dy)
+		return ((dy - dx) * PATH_STRAIGHT_COST + dx * PATH_DIAGONAL_COST);
+	return ((dx - dy) * PATH_STRAIGHT_COST + dy * PATH_DIAGONAL_COST);
+}
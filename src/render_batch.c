@@ -0,0 +1,160 @@
+#include "../inc/game.h"
+
+static struct RenderBatch *render_batch(struct Game *game,
+		SDL_Texture *texture);
+
+/**
+ * render_batches_create - Makes the batches of the batched backend.
+ *
+ * Return: RENDER_BATCHES empty batches, or NULL on failure.
+ */
+struct RenderBatch *render_batches_create(void)
+{
+	return (calloc(RENDER_BATCHES, sizeof(struct RenderBatch)));
+}
+
+/**
+ * render_batches_destroy - Releases the batches and their buffers.
+ * @batches: RENDER_BATCHES batches, may be NULL.
+ */
+void render_batches_destroy(struct RenderBatch *batches)
+{
+	int i;
+
+	if (!batches)
+		return;
+	for (i = 0; i < RENDER_BATCHES; i++)
+	{
+		free(batches[i].vertices);
+		free(batches[i].indices);
+	}
+	free(batches);
+}
+
+/**
+ * render_strip - Draws part of a texture over a strip of the view.
+ * @game: Pointer to the Game structure.
+ * @texture: Texture to draw from.
+ * @source: Part of the texture stretched over the strip.
+ * @strip: Strip of the viewport to fill.
+ * @shade: Level the texture color is scaled by.
+ *
+ * Without batches the strip is drawn at once, its shading set as the
+ * texture's color modulation. With them it becomes a quad of its
+ * texture's batch, its shading the color of the quad's vertices, and is
+ * drawn by render_flush(). A strip that fits no batch is drawn at once,
+ * after the strips queued before it.
+ */
+void render_strip(struct Game *game, SDL_Texture *texture,
+		const SDL_Rect *source, const SDL_Rect *strip, Uint8 shade)
+{
+	struct RenderBatch *batch = game->batches ?
+		render_batch(game, texture) : NULL;
+	SDL_Color color = {shade, shade, shade, 255};
+	SDL_Vertex *vertex;
+	float left, right, top, bottom;
+
+	if (!batch)
+	{
+		render_flush(game);
+		SDL_SetTextureColorMod(texture, shade, shade, shade);
+		SDL_RenderCopy(game->renderer, texture, source, strip);
+		game->stats.render_calls += 2;
+		return;
+	}
+	left = (float)source->x / batch->texture_width;
+	right = (float)(source->x + source->w) / batch->texture_width;
+	top = (float)source->y / batch->texture_height;
+	bottom = (float)(source->y + source->h) / batch->texture_height;
+	vertex = &batch->vertices[4 * batch->quads++];
+	vertex[0] = (SDL_Vertex){{strip->x, strip->y}, color, {left, top}};
+	vertex[1] = (SDL_Vertex){{strip->x + strip->w, strip->y}, color,
+		{right, top}};
+	vertex[2] = (SDL_Vertex){{strip->x + strip->w, strip->y + strip->h},
+		color, {right, bottom}};
+	vertex[3] = (SDL_Vertex){{strip->x, strip->y + strip->h}, color,
+		{left, bottom}};
+}
+
+/**
+ * render_flush - Draws every queued strip, one call per texture.
+ * @game: Pointer to the Game structure.
+ *
+ * Batches are drawn in the order their textures first showed up. Opaque
+ * strips never overlap, and the see-through ones come after the opaque
+ * ones of their column, so they still blend over them. Called once per
+ * camera, before anything is drawn over its view.
+ */
+void render_flush(struct Game *game)
+{
+	struct RenderBatch *batch;
+	int i;
+
+	for (i = 0; game->batches && i < RENDER_BATCHES; i++)
+	{
+		batch = &game->batches[i];
+		if (batch->quads)
+		{
+			SDL_SetTextureColorMod(batch->texture, 255, 255, 255);
+			SDL_RenderGeometry(game->renderer, batch->texture,
+					batch->vertices, 4 * batch->quads, batch->indices,
+					6 * batch->quads);
+			game->stats.render_calls += 2;
+		}
+		batch->quads = 0;
+		batch->texture = NULL;
+	}
+}
+
+/**
+ * render_batch - Finds the batch of a texture with room for one more
+ *		strip.
+ * @game: Pointer to the Game structure, its batches set.
+ * @texture: Texture of the strip.
+ *
+ * A texture gets the first unused batch the first time it shows up in a
+ * frame. A full batch doubles its buffers, starting at
+ * RENDER_BATCH_QUADS strips, and writes the indices of the new ones.
+ *
+ * Return: Pointer to the batch, NULL when no batch is left or the
+ * buffers cannot grow.
+ */
+static struct RenderBatch *render_batch(struct Game *game,
+		SDL_Texture *texture)
+{
+	struct RenderBatch *batch = game->batches;
+	SDL_Vertex *vertices;
+	int *indices, capacity, quad, *index;
+
+	while (batch < game->batches + RENDER_BATCHES && batch->texture &&
+			batch->texture != texture)
+		batch++;
+	if (batch == game->batches + RENDER_BATCHES || (!batch->texture &&
+				SDL_QueryTexture(texture, NULL, NULL, &batch->texture_width,
+					&batch->texture_height) != 0))
+		return (NULL);
+	batch->texture = texture;
+	if (batch->quads < batch->capacity)
+		return (batch);
+	capacity = batch->capacity ? 2 * batch->capacity : RENDER_BATCH_QUADS;
+	vertices = realloc(batch->vertices, 4 * capacity * sizeof(*vertices));
+	if (vertices)
+		batch->vertices = vertices;
+	indices = realloc(batch->indices, 6 * capacity * sizeof(*indices));
+	if (indices)
+		batch->indices = indices;
+	if (!vertices || !indices)
+		return (NULL);
+	for (quad = batch->capacity; quad < capacity; quad++)
+	{
+		index = &indices[6 * quad];
+		index[0] = 4 * quad;
+		index[1] = 4 * quad + 1;
+		index[2] = 4 * quad + 2;
+		index[3] = 4 * quad + 2;
+		index[4] = 4 * quad + 3;
+		index[5] = 4 * quad;
+	}
+	batch->capacity = capacity;
+	return (batch);
+}
@@ -3,13 +3,16 @@
 /**
  * initialize_sdl_and_img - Initializes SDL and SDL_image.
  *
+ * Audio is started later by the mixer, so a machine without a working
+ * audio driver still plays, silently.
+ *
  * Return: true if initialization is successful, otherwise false.
  */
 bool initialize_sdl_and_img(void)
 {
 	int imgFlags = IMG_INIT_JPG;
 
-	if (SDL_Init(SDL_INIT_EVERYTHING))
+	if (SDL_Init(SDL_INIT_EVERYTHING & ~SDL_INIT_AUDIO))
 	{
 		fprintf(stderr, "Error initializing SDL: %s\n", SDL_GetError());
 		return (false);
@@ -79,46 +82,81 @@ SDL_Texture *load_texture(SDL_Renderer *renderer, const char *path)
 	return (texture);
 }
 
+/**
+ * create_grate_texture - Draws the texture of see-through grates.
+ * @renderer: The SDL renderer to be used for creating the texture.
+ *
+ * A lattice of bars on a transparent background, blended over whatever
+ * lies behind the grate.
+ *
+ * Return: The created SDL texture, or NULL on failure.
+ */
+SDL_Texture *create_grate_texture(SDL_Renderer *renderer)
+{
+	SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0,
+			GRATE_TEXTURE_SIZE, GRATE_TEXTURE_SIZE, 32, SDL_PIXELFORMAT_ARGB8888);
+	SDL_Texture *texture = NULL;
+	Uint32 *pixels;
+	int x, y;
+
+	if (!surface)
+		return (NULL);
+	pixels = surface->pixels;
+	for (y = 0; y < GRATE_TEXTURE_SIZE; y++)
+		for (x = 0; x < GRATE_TEXTURE_SIZE; x++)
+			pixels[y * surface->pitch / 4 + x] = x % 16 < 3 || y % 32 < 3 ||
+				x >= GRATE_TEXTURE_SIZE - 3 ? 0xff5a5a64 : 0x00000000;
+	texture = SDL_CreateTextureFromSurface(renderer, surface);
+	SDL_FreeSurface(surface);
+	if (texture)
+		SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+	else
+		fprintf(stderr, "Unable to create the grate texture! Error: %s\n",
+				SDL_GetError());
+	return (texture);
+}
+
 /**
  * sdl_initialize - Initializes SDL and game resources.
  * @game: Pointer to the Game structure containing game state.
- * @map_file_path: Path to the map file to be loaded.
+ * @map_file_path: Path to the map file to be loaded, or a map, world or
+ *		level set specification.
  *
  * Return: true if an error occurs, otherwise false.
  */
 bool sdl_initialize(struct Game *game, const char *map_file_path)
 {
-	if (!initialize_sdl_and_img() || !create_window_and_renderer(game))
-		return (true);
+	int i;
 
-	game->wall_texture = load_texture(game->renderer,
-			"./textures/grasstexture1.jpg");
-	game->ground_texture = load_texture(game->renderer,
-			"./textures/groundtexture4.jpg");
-	game->pistol_texture = load_texture(game->renderer,
-			"./textures/pistol.png");
-	game->shotgun_texture = load_texture(game->renderer,
-			"./textures/shotgun.png");
-	game->rifle_texture = load_texture(game->renderer,
-			"./textures/rifle.png");
-
-	if (!game->wall_texture || !game->ground_texture || !game->pistol_texture ||
-			!game->shotgun_texture || !game->rifle_texture)
+	if (!initialize_sdl_and_img() || !create_window_and_renderer(game) ||
+			!load_textures(game) || !start_services(game))
 		return (true);
 
 	game->current_weapon = 0;
+	game->player_count = game->options.split_screen ? 2 : 1;
+	for (i = 0; i < game->player_count; i++)
+	{
+		game->players[i].x = TILE_SIZE + TILE_SIZE / 2;
+		game->players[i].y = TILE_SIZE + TILE_SIZE / 2;
+		game->players[i].angle = i * PI / 2;
+		update_direction(&game->players[i]);
+	}
+	setup_cameras(game);
+	if (!start_rendering(game))
+		return (true);
 
-	game->player.x = TILE_SIZE + TILE_SIZE / 2;
-	game->player.y = TILE_SIZE + TILE_SIZE / 2;
-	game->player.angle = 0;
-	game->player.dirX = cos(game->player.angle);
-	game->player.dirY = sin(game->player.angle);
+	if (strncmp(map_file_path, LEVEL_SPEC_PREFIX,
+				strlen(LEVEL_SPEC_PREFIX)) == 0)
+		return (!level_set_create(game, map_file_path) ||
+				!start_network(game));
 
-	if (!parse_map_file(game, map_file_path))
+	if (!parse_map_file(game, map_file_path) ||
+			!fog_reset(game, game->map_width, game->map_height) ||
+			!load_map_data(game))
 		return (true);
 
 	game->rotation_speed = 0.05f;
 	game->show_map = false;
 
-	return (false);
+	return (!start_network(game));
 }
@@ -0,0 +1,165 @@
+#include "../inc/game.h"
+
+/**
+ * load_textures - Loads the textures of the walls, floor and weapons.
+ * @game: Pointer to the Game structure, its renderer created.
+ *
+ * Return: true if every texture loaded, false otherwise.
+ */
+bool load_textures(struct Game *game)
+{
+	game->wall_texture = load_texture(game->renderer,
+			"./textures/grasstexture1.jpg");
+	game->ground_texture = load_texture(game->renderer,
+			"./textures/groundtexture4.jpg");
+	game->pistol_texture = load_texture(game->renderer,
+			"./textures/pistol.png");
+	game->shotgun_texture = load_texture(game->renderer,
+			"./textures/shotgun.png");
+	game->rifle_texture = load_texture(game->renderer,
+			"./textures/rifle.png");
+	game->grate_texture = create_grate_texture(game->renderer);
+
+	return (game->wall_texture && game->ground_texture &&
+			game->pistol_texture && game->shotgun_texture &&
+			game->rifle_texture && game->grate_texture);
+}
+
+/**
+ * start_services - Starts what runs beside the game as the options ask:
+ *		the capture, the metrics server, the audio and the snapshots.
+ * @game: Pointer to the Game structure, its renderer created.
+ *
+ * The audio is optional, so a machine without a working audio driver
+ * still plays. A joined game is driven by the server and records no
+ * history.
+ *
+ * Return: true on success, false on failure.
+ */
+bool start_services(struct Game *game)
+{
+	if (game->options.capture_path)
+	{
+		game->capture = capture_create(game->renderer,
+				game->options.capture_path);
+		if (!game->capture)
+			return (false);
+	}
+	if (game->options.metrics_path)
+	{
+		game->metrics = metrics_create(game->options.metrics_path);
+		if (!game->metrics)
+			return (false);
+	}
+	game->audio = audio_create(true);
+	if (!game->options.connect_address)
+	{
+		game->snapshots = snapshot_create();
+		if (!game->snapshots)
+		{
+			fprintf(stderr, "Error allocating the snapshot ring\n");
+			return (false);
+		}
+	}
+	return (true);
+}
+
+/**
+ * start_rendering - Creates the frame arena, the draw batches, the
+ *		fixed-point tables and the render threads.
+ * @game: Pointer to the Game structure.
+ *
+ * Return: true on success, false on failure.
+ */
+bool start_rendering(struct Game *game)
+{
+	if (!arena_init(&game->frame_arena, FRAME_ARENA_BYTES))
+		return (false);
+	if (game->options.batched)
+	{
+		game->batches = render_batches_create();
+		if (!game->batches)
+			return (false);
+	}
+	if (game->options.fixed_point)
+	{
+		game->fixed = fixed_tables_create(NUM_RAYS);
+		if (!game->fixed)
+			return (false);
+	}
+	game->jobs = job_pool_create(job_pool_default_threads());
+	if (!game->jobs)
+	{
+		fprintf(stderr, "Error starting the render threads\n");
+		return (false);
+	}
+	return (true);
+}
+
+/**
+ * load_map_data - Builds what is computed from a loaded map: the cell
+ *		statistics, the pathfinder and the lightmap.
+ * @game: Pointer to the Game structure, its map loaded and its render
+ *		threads started.
+ *
+ * A streamed world has no map and gets neither. The pathfinder is
+ * optional; a map without lights gets no lightmap.
+ *
+ * Return: true on success, false if the lightmap could not be baked.
+ */
+bool load_map_data(struct Game *game)
+{
+	map_measure_cells(game);
+	if (!game->map)
+		return (true);
+	if (PATH_FITS(game->map_width, game->map_height))
+		game->pathfinder = pathfinder_create(game->map, game->map_width,
+				game->map_height, NULL);
+	if (!game->pathfinder)
+		fprintf(stderr, "No pathfinding: the map is too large or memory "
+				"ran out\n");
+	if (lighting_count(game->map, game->map_width, game->map_height) == 0)
+		return (true);
+	game->lighting = lighting_create(game->map, game->map_width,
+			game->map_height, game->jobs, NULL);
+	if (!game->lighting)
+	{
+		fprintf(stderr, "Error baking the lightmap\n");
+		return (false);
+	}
+	printf("Lightmap: %d lights, %dx%d tiles baked in %.2f ms\n",
+			game->lighting->static_count, game->map_width,
+			game->map_height, game->lighting->bake_ms);
+	return (true);
+}
+
+/**
+ * start_network - Hosts or joins a game as the options ask.
+ * @game: Pointer to the Game structure, its map loaded.
+ *
+ * Joining waits for the server's welcome; the player moves to where the
+ * server spawned it with the first snapshot.
+ *
+ * Return: true on success or when playing alone, false on failure.
+ */
+bool start_network(struct Game *game)
+{
+	if (game->options.serve_port)
+	{
+		game->server = net_server_create(game, game->options.serve_port);
+		if (!game->server)
+			return (false);
+		game->server->verbose = true;
+		printf("Serving on port %d\n", game->options.serve_port);
+	}
+	if (game->options.connect_address)
+	{
+		game->client = net_client_create(game,
+				game->options.connect_address);
+		if (!game->client || !net_client_wait(game->client))
+			return (false);
+		printf("Joined %s as player %d\n", game->options.connect_address,
+				game->client->id);
+	}
+	return (true);
+}
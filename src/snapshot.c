@@ -0,0 +1,110 @@
+#include "../inc/game.h"
+
+/**
+ * snapshot_create - Allocates an empty snapshot ring.
+ *
+ * Return: Pointer to the SnapshotRing, NULL if memory runs out.
+ */
+struct SnapshotRing *snapshot_create(void)
+{
+	struct SnapshotRing *ring = calloc(1, sizeof(*ring));
+
+	if (!ring)
+		return (NULL);
+	ring->data = malloc(SNAPSHOT_RING_BYTES);
+	if (!ring->data)
+	{
+		free(ring);
+		return (NULL);
+	}
+	return (ring);
+}
+
+/**
+ * snapshot_destroy - Releases a snapshot ring.
+ * @ring: Pointer to the SnapshotRing, may be NULL.
+ */
+void snapshot_destroy(struct SnapshotRing *ring)
+{
+	if (!ring)
+		return;
+	free(ring->data);
+	free(ring);
+}
+
+/**
+ * snapshot_reset - Forgets the whole history.
+ * @ring: Pointer to the SnapshotRing, may be NULL.
+ *
+ * Called on every level switch, the history of a level being of no use
+ * on another map; the next tick recorded is tick 0.
+ */
+void snapshot_reset(struct SnapshotRing *ring)
+{
+	if (!ring)
+		return;
+	ring->head = 0;
+	ring->first = 0;
+	ring->count = 0;
+}
+
+/**
+ * snapshot_frame - Records the frame's state, or rewinds while Backspace
+ *		is held.
+ * @game: Pointer to the Game structure, its players moved for the frame;
+ *		its snapshots NULL when nothing is recorded.
+ *
+ * Rewinding steps back SNAPSHOT_REWIND_TICKS ticks a frame, dropping the
+ * ticks it leaves, so recording goes on from the state rewound to.
+ */
+void snapshot_frame(struct Game *game)
+{
+	if (!game->snapshots)
+		return;
+	if (game->keyboard_state[SDL_SCANCODE_BACKSPACE])
+		snapshot_rewind(game, SNAPSHOT_REWIND_TICKS);
+	else
+		snapshot_record(game);
+}
+
+/**
+ * snapshot_record - Appends the game state as the next tick.
+ * @game: Pointer to the Game structure, its snapshots not NULL.
+ *
+ * The tick starts a new segment when the newest one is full; otherwise
+ * it is coded against the segment's keyframe, as a single byte when
+ * nothing changed since the tick before.
+ */
+void snapshot_record(struct Game *game)
+{
+	struct SnapshotRing *ring = game->snapshots;
+	struct SnapshotSegment *segment = NULL;
+	Uint8 image[SNAPSHOT_IMAGE_BYTES], record[SNAPSHOT_RECORD_MAX];
+	Uint8 *end;
+	size_t length = 0;
+
+	snapshot_capture(game, image);
+	if (ring->count)
+		segment = &ring->segments[(ring->first + ring->count - 1) %
+			SNAPSHOT_SEGMENTS];
+	if (!segment || segment->records == SNAPSHOT_KEYFRAME_TICKS)
+	{
+		segment = snapshot_begin(ring, snapshot_last_tick(ring) + 1);
+		memcpy(ring->data + segment->offset, image, SNAPSHOT_IMAGE_BYTES);
+		memcpy(ring->keyframe, image, SNAPSHOT_IMAGE_BYTES);
+		segment->bytes = SNAPSHOT_IMAGE_BYTES;
+	}
+	else
+	{
+		if (memcmp(image, ring->previous, SNAPSHOT_IMAGE_BYTES) != 0)
+			length = snapshot_rle_encode(image, ring->keyframe,
+					SNAPSHOT_IMAGE_BYTES, record);
+		end = ring->data + segment->offset + segment->bytes;
+		segment->bytes += snapshot_varint_put(end, length);
+		memcpy(ring->data + segment->offset + segment->bytes, record, length);
+		segment->bytes += length;
+	}
+	segment->records++;
+	ring->head = segment->offset + segment->bytes;
+	memcpy(ring->previous, image, SNAPSHOT_IMAGE_BYTES);
+}
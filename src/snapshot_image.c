@@ -0,0 +1,97 @@
+#include "../inc/game.h"
+
+static void snapshot_put_float(Uint8 *at, float value);
+static float snapshot_get_float(const Uint8 *at);
+
+/**
+ * snapshot_capture - Writes the image of the game state.
+ * @game: Pointer to the Game structure.
+ * @image: SNAPSHOT_IMAGE_BYTES bytes to fill.
+ *
+ * Every player takes SNAPSHOT_PLAYER_BYTES bytes, its position, direction
+ * and angle as little-endian floats, then come the player count, the
+ * weapon, the lantern and the minimap switch. The floats are stored
+ * whole so a rewound player is exactly where it was.
+ */
+void snapshot_capture(const struct Game *game, Uint8 *image)
+{
+	const struct Player *player;
+	Uint8 *at;
+	int i;
+
+	memset(image, 0, SNAPSHOT_IMAGE_BYTES);
+	for (i = 0; i < game->player_count; i++)
+	{
+		player = &game->players[i];
+		at = image + i * SNAPSHOT_PLAYER_BYTES;
+		snapshot_put_float(at, player->x);
+		snapshot_put_float(at + 4, player->y);
+		snapshot_put_float(at + 8, player->dirX);
+		snapshot_put_float(at + 12, player->dirY);
+		snapshot_put_float(at + 16, player->angle);
+	}
+	at = image + MAX_PLAYERS * SNAPSHOT_PLAYER_BYTES;
+	at[0] = game->player_count;
+	at[1] = game->current_weapon;
+	at[2] = game->lantern;
+	at[3] = game->show_map;
+}
+
+/**
+ * snapshot_apply - Sets the game state from an image.
+ * @game: Pointer to the Game structure.
+ * @image: SNAPSHOT_IMAGE_BYTES bytes written by snapshot_capture() for
+ *		the same number of players.
+ */
+void snapshot_apply(struct Game *game, const Uint8 *image)
+{
+	struct Player *player;
+	const Uint8 *at;
+	int i;
+
+	for (i = 0; i < game->player_count; i++)
+	{
+		player = &game->players[i];
+		at = image + i * SNAPSHOT_PLAYER_BYTES;
+		player->x = snapshot_get_float(at);
+		player->y = snapshot_get_float(at + 4);
+		player->dirX = snapshot_get_float(at + 8);
+		player->dirY = snapshot_get_float(at + 12);
+		player->angle = snapshot_get_float(at + 16);
+	}
+	at = image + MAX_PLAYERS * SNAPSHOT_PLAYER_BYTES;
+	game->current_weapon = at[1] % 3;
+	game->lantern = at[2];
+	game->show_map = at[3];
+}
+
+/**
+ * snapshot_put_float - Writes a float as 4 little-endian bytes.
+ * @at: Bytes to write.
+ * @value: Float to write.
+ */
+static void snapshot_put_float(Uint8 *at, float value)
+{
+	Uint32 bits;
+
+	memcpy(&bits, &value, sizeof(bits));
+	at[0] = bits;
+	at[1] = bits >> 8;
+	at[2] = bits >> 16;
+	at[3] = bits >> 24;
+}
+
+/**
+ * snapshot_get_float - Reads a float written by snapshot_put_float().
+ * @at: Bytes to read.
+ *
+ * Return: The float.
+ */
+static float snapshot_get_float(const Uint8 *at)
+{
+	Uint32 bits = at[0] | at[1] << 8 | at[2] << 16 | (Uint32)at[3] << 24;
+	float value;
+
+	memcpy(&value, &bits, sizeof(value));
+	return (value);
+}
@@ -0,0 +1,216 @@
+#include "../inc/game.h"
+
+static Uint8 *snapshot_read_file(const char *path, size_t *length);
+static bool snapshot_same_map(const struct Game *game, const Uint8 *in,
+		size_t length, size_t *at);
+static bool snapshot_read_segments(struct SnapshotRing *ring,
+		const Uint8 *in, size_t length, size_t at);
+static bool snapshot_check_segment(const Uint8 *segment, size_t bytes,
+		size_t records);
+
+/**
+ * snapshot_load - Replaces the history with the one of a file and goes
+ *		to its last tick.
+ * @game: Pointer to the Game structure, its snapshots not NULL.
+ * @path: Path to a file written by snapshot_save().
+ *
+ * The file must have been saved with as many players, the same tile
+ * size, positions being stored in world units, and on the same map, cell
+ * for cell. It is checked whole before the history is
+ * replaced, so a bad file leaves the game as it was. When the file holds
+ * more than the ring, its oldest ticks are dropped.
+ *
+ * Return: true on success, false otherwise.
+ */
+bool snapshot_load(struct Game *game, const char *path)
+{
+	struct SnapshotRing *ring = game->snapshots;
+	size_t length, at = sizeof(SNAPSHOT_MAGIC) - 1, header[7];
+	Uint8 *in = snapshot_read_file(path, &length);
+	bool ok;
+	int i;
+
+	if (!in)
+		return (false);
+	ok = length >= at && memcmp(in, SNAPSHOT_MAGIC, at) == 0;
+	for (i = 0; ok && i < 7; i++)
+		ok = snapshot_varint_get(in, length, &at, &header[i]);
+	ok = ok && header[0] == SNAPSHOT_IMAGE_BYTES &&
+		header[1] == SNAPSHOT_KEYFRAME_TICKS &&
+		header[2] == (size_t)game->player_count &&
+		header[3] == (size_t)TILE_SIZE &&
+		header[4] == (size_t)game->map_width &&
+		header[5] == (size_t)game->map_height &&
+		header[6] == (size_t)(game->map ? game->map_height : 0) &&
+		snapshot_same_map(game, in, length, &at) &&
+		snapshot_read_segments(NULL, in, length, at);
+	if (ok)
+	{
+		snapshot_read_segments(ring, in, length, at);
+		snapshot_truncate(ring, snapshot_last_tick(ring));
+		snapshot_apply(game, ring->previous);
+		printf("Loaded ticks %ld to %ld from %s\n", snapshot_first_tick(ring),
+				snapshot_last_tick(ring), path);
+	}
+	else
+		fprintf(stderr, "Snapshot file %s is invalid or of another map\n",
+				path);
+	free(in);
+	return (ok);
+}
+
+/**
+ * snapshot_read_file - Reads a whole file.
+ * @path: Path to the file.
+ * @length: Pointer to store the number of bytes read.
+ *
+ * Return: Bytes of the file, to free, NULL on failure.
+ */
+static Uint8 *snapshot_read_file(const char *path, size_t *length)
+{
+	FILE *file = fopen(path, "rb");
+	Uint8 *in = NULL;
+	long size;
+
+	if (!file)
+	{
+		fprintf(stderr, "Error opening snapshot file: %s\n", path);
+		return (NULL);
+	}
+	if (fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) > 0 &&
+			fseek(file, 0, SEEK_SET) == 0)
+		in = malloc(size);
+	if (in && fread(in, 1, size, file) != (size_t)size)
+	{
+		free(in);
+		in = NULL;
+	}
+	fclose(file);
+	if (!in)
+		fprintf(stderr, "Error reading snapshot file: %s\n", path);
+	else
+		*length = size;
+	return (in);
+}
+
+/**
+ * snapshot_same_map - Compares the map rows of a file with the map.
+ * @game: Pointer to the Game structure.
+ * @in: Bytes of the file.
+ * @length: Number of bytes of @in.
+ * @at: Pointer to the offset of the first row, moved past the last one.
+ *
+ * Return: true if every row matches or the map is a streamed world,
+ * false otherwise or if memory runs out.
+ */
+static bool snapshot_same_map(const struct Game *game, const Uint8 *in,
+		size_t length, size_t *at)
+{
+	size_t row_bytes = (size_t)game->map_width * 4, record = 0;
+	Uint8 *expected, *row;
+	bool same;
+	int y;
+
+	if (!game->map)
+		return (true);
+	expected = malloc(row_bytes);
+	row = malloc(row_bytes);
+	same = expected && row;
+	for (y = 0; same && y < game->map_height; y++)
+	{
+		snapshot_map_row(game, y, expected);
+		memset(row, 0, row_bytes);
+		same = snapshot_varint_get(in, length, at, &record) &&
+			record <= length - *at &&
+			snapshot_rle_apply(in + *at, record, row, row_bytes) &&
+			memcmp(row, expected, row_bytes) == 0;
+		*at += same ? record : 0;
+	}
+	free(expected);
+	free(row);
+	return (same);
+}
+
+/**
+ * snapshot_read_segments - Checks the segments of a file, or copies them
+ *		to the ring.
+ * @ring: Pointer to the SnapshotRing to fill, NULL to only check.
+ * @in: Bytes of the file.
+ * @length: Number of bytes of @in.
+ * @at: Offset of the segment count.
+ *
+ * The segments must hold consecutive ticks, all but the last one full.
+ *
+ * Return: true if the segments are valid and end the file, false
+ * otherwise.
+ */
+static bool snapshot_read_segments(struct SnapshotRing *ring,
+		const Uint8 *in, size_t length, size_t at)
+{
+	struct SnapshotSegment *segment;
+	size_t count, i, tick, records, bytes, next = 0;
+
+	if (!snapshot_varint_get(in, length, &at, &count) || count == 0)
+		return (false);
+	snapshot_reset(ring);
+	for (i = 0; i < count; i++)
+	{
+		if (!snapshot_varint_get(in, length, &at, &tick) ||
+				!snapshot_varint_get(in, length, &at, &records) ||
+				!snapshot_varint_get(in, length, &at, &bytes) ||
+				(i > 0 && tick != next) || tick > SDL_MAX_SINT32 ||
+				records < 1 || records > SNAPSHOT_KEYFRAME_TICKS ||
+				(i + 1 < count && records != SNAPSHOT_KEYFRAME_TICKS) ||
+				bytes > length - at ||
+				!snapshot_check_segment(in + at, bytes, records))
+			return (false);
+		if (ring)
+		{
+			segment = snapshot_begin(ring, tick);
+			memcpy(ring->data + segment->offset, in + at, bytes);
+			segment->bytes = bytes;
+			segment->records = records;
+			ring->head = segment->offset + bytes;
+		}
+		next = tick + records;
+		at += bytes;
+	}
+	return (at == length);
+}
+
+/**
+ * snapshot_check_segment - Checks every record of a segment.
+ * @segment: Bytes of the segment.
+ * @bytes: Number of bytes of @segment.
+ * @records: Number of ticks in the segment, keyframe included.
+ *
+ * No record may be longer than SNAPSHOT_RECORD_MAX, so the segment fits
+ * the room snapshot_begin() keeps for it, however many ticks are then
+ * appended.
+ *
+ * Return: true if the records fill the segment and all decode, false
+ * otherwise.
+ */
+static bool snapshot_check_segment(const Uint8 *segment, size_t bytes,
+		size_t records)
+{
+	Uint8 image[SNAPSHOT_IMAGE_BYTES];
+	size_t at = SNAPSHOT_IMAGE_BYTES, start, length;
+
+	if (bytes < SNAPSHOT_IMAGE_BYTES)
+		return (false);
+	for (; records > 1; records--)
+	{
+		start = at;
+		if (!snapshot_varint_get(segment, bytes, &at, &length) ||
+				length > bytes - at || at + length - start >
+				SNAPSHOT_RECORD_MAX)
+			return (false);
+		memcpy(image, segment, SNAPSHOT_IMAGE_BYTES);
+		if (!snapshot_rle_apply(segment + at, length, image,
+					SNAPSHOT_IMAGE_BYTES))
+			return (false);
+		at += length;
+	}
+	return (at == bytes);
+}
@@ -0,0 +1,61 @@
+#include "../inc/game.h"
+
+/**
+ * snapshot_begin - Starts a segment at the head of the ring.
+ * @ring: Pointer to the SnapshotRing.
+ * @tick: Tick of the segment's keyframe.
+ *
+ * SNAPSHOT_SEGMENT_MAX contiguous bytes are kept for the segment, so a
+ * full segment always fits: the head wraps to the start of the ring when
+ * fewer bytes are left, dropping the segments past it, and the oldest
+ * segments in the way are dropped. Ticks are only ever dropped from the
+ * oldest end, so the ticks held stay consecutive.
+ *
+ * Return: Pointer to the new newest segment, empty.
+ */
+struct SnapshotSegment *snapshot_begin(struct SnapshotRing *ring, long tick)
+{
+	struct SnapshotSegment *segment;
+
+	if (SNAPSHOT_RING_BYTES - ring->head < SNAPSHOT_SEGMENT_MAX)
+	{
+		while (ring->count && ring->segments[ring->first].offset >=
+				ring->head)
+		{
+			ring->first = (ring->first + 1) % SNAPSHOT_SEGMENTS;
+			ring->count--;
+		}
+		ring->head = 0;
+	}
+	while (ring->count && (ring->count == SNAPSHOT_SEGMENTS ||
+				(ring->segments[ring->first].offset >= ring->head &&
+				 ring->segments[ring->first].offset < ring->head +
+				 SNAPSHOT_SEGMENT_MAX)))
+	{
+		ring->first = (ring->first + 1) % SNAPSHOT_SEGMENTS;
+		ring->count--;
+	}
+	segment = &ring->segments[(ring->first + ring->count++) %
+		SNAPSHOT_SEGMENTS];
+	segment->tick = tick;
+	segment->offset = ring->head;
+	segment->bytes = 0;
+	segment->records = 0;
+	return (segment);
+}
+
+/**
+ * snapshot_size - Counts the bytes of the ticks held.
+ * @ring: Pointer to the SnapshotRing.
+ *
+ * Return: Bytes of every segment held.
+ */
+size_t snapshot_size(const struct SnapshotRing *ring)
+{
+	size_t bytes = 0;
+	int i;
+
+	for (i = 0; i < ring->count; i++)
+		bytes += ring->segments[(ring->first + i) % SNAPSHOT_SEGMENTS].bytes;
+	return (bytes);
+}
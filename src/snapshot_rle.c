@@ -0,0 +1,153 @@
+#include "../inc/game.h"
+
+/**
+ * snapshot_varint_put - Writes a number 7 bits a byte, low bits first.
+ * @out: Bytes to write, at least 10.
+ * @value: Number to write.
+ *
+ * Every byte but the last has its top bit set.
+ *
+ * Return: Number of bytes written.
+ */
+size_t snapshot_varint_put(Uint8 *out, size_t value)
+{
+	size_t bytes = 0;
+
+	while (value >= 0x80)
+	{
+		out[bytes++] = (Uint8)(value | 0x80);
+		value >>= 7;
+	}
+	out[bytes++] = (Uint8)value;
+	return (bytes);
+}
+
+/**
+ * snapshot_varint_get - Reads a number written by snapshot_varint_put().
+ * @in: Bytes to read.
+ * @length: Number of bytes of @in.
+ * @at: Pointer to the offset to read at, moved past the number.
+ * @value: Pointer to store the number.
+ *
+ * Return: true on success, false if the number runs past @length or
+ * does not fit.
+ */
+bool snapshot_varint_get(const Uint8 *in, size_t length, size_t *at,
+		size_t *value)
+{
+	int shift;
+
+	*value = 0;
+	for (shift = 0; *at < length && shift < 63; shift += 7)
+	{
+		*value |= (size_t)(in[*at] & 0x7f) << shift;
+		if (!(in[(*at)++] & 0x80))
+			return (true);
+	}
+	return (false);
+}
+
+/**
+ * snapshot_rle_encode - Codes the XOR of two images as runs.
+ * @image: Image to code.
+ * @base: Image it is coded against.
+ * @size: Bytes of each image.
+ * @out: Bytes to write, at least 2 * @size + 8.
+ *
+ * The XOR is a list of pairs: a varint count of zero bytes, a varint
+ * count of literal bytes, then the literals. A literal run only ends on
+ * two zero bytes in a row, so a lone zero costs less than a new pair,
+ * and the zeros after the last literal are left out.
+ *
+ * Return: Number of bytes written, never 0: identical images are coded
+ * as a single pair of zeros.
+ */
+size_t snapshot_rle_encode(const Uint8 *image, const Uint8 *base,
+		size_t size, Uint8 *out)
+{
+	size_t bytes = 0, i = 0, zeros, start;
+
+	while (i < size)
+	{
+		for (start = i; i < size && image[i] == base[i]; i++)
+			;
+		zeros = i - start;
+		for (start = i; i < size && (image[i] != base[i] || (i + 1 < size &&
+						image[i + 1] != base[i + 1])); i++)
+			;
+		if (i == start)
+			break;
+		bytes += snapshot_varint_put(out + bytes, zeros);
+		bytes += snapshot_varint_put(out + bytes, i - start);
+		for (; start < i; start++)
+			out[bytes++] = image[start] ^ base[start];
+	}
+	if (bytes == 0)
+	{
+		bytes += snapshot_varint_put(out, size);
+		bytes += snapshot_varint_put(out + bytes, 0);
+	}
+	return (bytes);
+}
+
+/**
+ * snapshot_rle_apply - XORs a coded record into an image.
+ * @record: Bytes written by snapshot_rle_encode().
+ * @length: Number of bytes of @record.
+ * @image: Image the record was coded against, changed to the image
+ *		coded.
+ * @size: Bytes of @image.
+ *
+ * Return: true on success, false if the record is malformed, @image then
+ * being partly changed.
+ */
+bool snapshot_rle_apply(const Uint8 *record, size_t length, Uint8 *image,
+		size_t size)
+{
+	size_t at = 0, i = 0, zeros, literals;
+
+	while (at < length)
+	{
+		if (!snapshot_varint_get(record, length, &at, &zeros) ||
+				!snapshot_varint_get(record, length, &at, &literals) ||
+				zeros > size - i || literals > size - i - zeros ||
+				literals > length - at)
+			return (false);
+		for (i += zeros; literals > 0; literals--)
+			image[i++] ^= record[at++];
+	}
+	return (true);
+}
+
+/**
+ * snapshot_walk - Finds a tick's record in a segment.
+ * @segment: Bytes of the segment.
+ * @bytes: Number of bytes of @segment.
+ * @index: Position of the tick in the segment, 0 for the keyframe.
+ * @end: Pointer to store the offset past the tick's record.
+ * @last: Pointer to store the offset of the last record up to the tick
+ *		that is not empty, 0 when the tick is the keyframe's image.
+ *
+ * Return: true on success, false if the records run past @bytes.
+ */
+bool snapshot_walk(const Uint8 *segment, size_t bytes, int index,
+		size_t *end, size_t *last)
+{
+	size_t at = SNAPSHOT_IMAGE_BYTES, start, length;
+
+	*last = 0;
+	if (bytes < SNAPSHOT_IMAGE_BYTES)
+		return (false);
+	for (; index > 0; index--)
+	{
+		start = at;
+		if (!snapshot_varint_get(segment, bytes, &at, &length) ||
+				length > bytes - at)
+			return (false);
+		if (length)
+			*last = start;
+		at += length;
+	}
+	*end = at;
+	return (true);
+}
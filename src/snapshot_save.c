@@ -0,0 +1,159 @@
+#include "../inc/game.h"
+
+static bool snapshot_write_header(const struct Game *game, FILE *file);
+static bool snapshot_write_map(const struct Game *game, FILE *file);
+static bool snapshot_write_segments(const struct SnapshotRing *ring,
+		FILE *file);
+
+/**
+ * snapshot_save - Writes the history held to a file.
+ * @game: Pointer to the Game structure, its snapshots not NULL.
+ * @path: Path to the file, replaced if it exists.
+ *
+ * The file is SNAPSHOT_MAGIC, then varints: the image size, the keyframe
+ * interval, the player count, the tile size, the map width and height
+ * and the number of map rows stored, 0 for a streamed world. Each map
+ * row follows as a varint length and the row's cells, 4 little-endian
+ * bytes each, coded against zeros. Last come the segment count and every
+ * segment, oldest first: its tick, record count and size as varints,
+ * then its bytes as they are in the ring.
+ *
+ * Return: true on success, false if nothing was recorded or the file
+ * could not be written.
+ */
+bool snapshot_save(const struct Game *game, const char *path)
+{
+	const struct SnapshotRing *ring = game->snapshots;
+	FILE *file;
+	bool ok;
+
+	if (!ring->count)
+		return (false);
+	file = fopen(path, "wb");
+	if (!file)
+	{
+		fprintf(stderr, "Error opening snapshot file: %s\n", path);
+		return (false);
+	}
+	ok = snapshot_write_header(game, file) && snapshot_write_map(game, file)
+		&& snapshot_write_segments(ring, file);
+	ok = fclose(file) == 0 && ok;
+	if (ok)
+		printf("Saved ticks %ld to %ld, %.1f KiB, to %s\n",
+				snapshot_first_tick(ring), snapshot_last_tick(ring),
+				snapshot_size(ring) / 1024.0, path);
+	else
+		fprintf(stderr, "Error writing snapshot file: %s\n", path);
+	return (ok);
+}
+
+/**
+ * snapshot_map_row - Writes a map row as stored in snapshot files.
+ * @game: Pointer to the Game structure, its map not NULL.
+ * @map_y: Row to write.
+ * @row: 4 * map_width bytes to fill, one little-endian cell every 4.
+ */
+void snapshot_map_row(const struct Game *game, int map_y, Uint8 *row)
+{
+	const int *cells = game->map + (size_t)map_y * game->map_width;
+	Uint32 cell;
+	int x;
+
+	for (x = 0; x < game->map_width; x++)
+	{
+		cell = cells[x];
+		row[4 * x] = cell;
+		row[4 * x + 1] = cell >> 8;
+		row[4 * x + 2] = cell >> 16;
+		row[4 * x + 3] = cell >> 24;
+	}
+}
+
+/**
+ * snapshot_write_header - Writes the magic and the sizes of a file.
+ * @game: Pointer to the Game structure.
+ * @file: File to write.
+ *
+ * Return: true on success, false on a write error.
+ */
+static bool snapshot_write_header(const struct Game *game, FILE *file)
+{
+	Uint8 header[sizeof(SNAPSHOT_MAGIC) + 7 * 10];
+	size_t bytes = sizeof(SNAPSHOT_MAGIC) - 1;
+
+	memcpy(header, SNAPSHOT_MAGIC, bytes);
+	bytes += snapshot_varint_put(header + bytes, SNAPSHOT_IMAGE_BYTES);
+	bytes += snapshot_varint_put(header + bytes, SNAPSHOT_KEYFRAME_TICKS);
+	bytes += snapshot_varint_put(header + bytes, game->player_count);
+	bytes += snapshot_varint_put(header + bytes, TILE_SIZE);
+	bytes += snapshot_varint_put(header + bytes, game->map_width);
+	bytes += snapshot_varint_put(header + bytes, game->map_height);
+	bytes += snapshot_varint_put(header + bytes,
+			game->map ? game->map_height : 0);
+	return (fwrite(header, 1, bytes, file) == bytes);
+}
+
+/**
+ * snapshot_write_map - Writes the map rows of a file.
+ * @game: Pointer to the Game structure; nothing is written when its map
+ *		is a streamed world.
+ * @file: File to write.
+ *
+ * Return: true on success, false on a write error or if memory runs out.
+ */
+static bool snapshot_write_map(const struct Game *game, FILE *file)
+{
+	size_t row_bytes = (size_t)game->map_width * 4, bytes;
+	Uint8 *row, *zeros, *out, length[10];
+	bool ok;
+	int y;
+
+	if (!game->map)
+		return (true);
+	row = malloc(row_bytes);
+	zeros = calloc(row_bytes, 1);
+	out = malloc(2 * row_bytes + 8);
+	ok = row && zeros && out;
+	for (y = 0; ok && y < game->map_height; y++)
+	{
+		snapshot_map_row(game, y, row);
+		bytes = snapshot_rle_encode(row, zeros, row_bytes, out);
+		ok = fwrite(length, 1, snapshot_varint_put(length, bytes), file) > 0
+			&& fwrite(out, 1, bytes, file) == bytes;
+	}
+	free(row);
+	free(zeros);
+	free(out);
+	return (ok);
+}
+
+/**
+ * snapshot_write_segments - Writes the segments of a file.
+ * @ring: Pointer to the SnapshotRing.
+ * @file: File to write.
+ *
+ * Return: true on success, false on a write error.
+ */
+static bool snapshot_write_segments(const struct SnapshotRing *ring,
+		FILE *file)
+{
+	const struct SnapshotSegment *segment;
+	Uint8 header[3 * 10];
+	size_t bytes;
+	bool ok;
+	int i;
+
+	bytes = snapshot_varint_put(header, ring->count);
+	ok = fwrite(header, 1, bytes, file) == bytes;
+	for (i = 0; ok && i < ring->count; i++)
+	{
+		segment = &ring->segments[(ring->first + i) % SNAPSHOT_SEGMENTS];
+		bytes = snapshot_varint_put(header, segment->tick);
+		bytes += snapshot_varint_put(header + bytes, segment->records);
+		bytes += snapshot_varint_put(header + bytes, segment->bytes);
+		ok = fwrite(header, 1, bytes, file) == bytes &&
+			fwrite(ring->data + segment->offset, 1, segment->bytes, file) ==
+			segment->bytes;
+	}
+	return (ok);
+}
@@ -0,0 +1,108 @@
+#include "../inc/game.h"
+
+static int snapshot_find(const struct SnapshotRing *ring, long tick);
+
+/**
+ * snapshot_seek - Rebuilds the image of a tick.
+ * @ring: Pointer to the SnapshotRing.
+ * @tick: Tick to rebuild.
+ * @image: SNAPSHOT_IMAGE_BYTES bytes to store the image in.
+ *
+ * Only the record lengths of the ticks before @tick in its segment are
+ * read, then the keyframe and the last record that changed something
+ * are combined, so a seek costs at most SNAPSHOT_KEYFRAME_TICKS varints
+ * and one record wherever the tick lies.
+ *
+ * Return: true on success, false if the tick is not held.
+ */
+bool snapshot_seek(const struct SnapshotRing *ring, long tick, Uint8 *image)
+{
+	int index = snapshot_find(ring, tick);
+	const struct SnapshotSegment *segment;
+	const Uint8 *data;
+	size_t end, last, length;
+
+	if (index < 0)
+		return (false);
+	segment = &ring->segments[(ring->first + index) % SNAPSHOT_SEGMENTS];
+	data = ring->data + segment->offset;
+	if (!snapshot_walk(data, segment->bytes, tick - segment->tick, &end,
+				&last))
+		return (false);
+	memcpy(image, data, SNAPSHOT_IMAGE_BYTES);
+	if (!last)
+		return (true);
+	snapshot_varint_get(data, segment->bytes, &last, &length);
+	return (snapshot_rle_apply(data + last, length, image,
+				SNAPSHOT_IMAGE_BYTES));
+}
+
+/**
+ * snapshot_truncate - Drops the ticks after a tick.
+ * @ring: Pointer to the SnapshotRing.
+ * @tick: New newest tick, ignored when not held.
+ *
+ * The next tick recorded follows @tick, coded against its segment's
+ * keyframe.
+ */
+void snapshot_truncate(struct SnapshotRing *ring, long tick)
+{
+	int index = snapshot_find(ring, tick);
+	struct SnapshotSegment *segment;
+	size_t end, last;
+
+	if (index < 0 || !snapshot_seek(ring, tick, ring->previous))
+		return;
+	segment = &ring->segments[(ring->first + index) % SNAPSHOT_SEGMENTS];
+	snapshot_walk(ring->data + segment->offset, segment->bytes,
+			tick - segment->tick, &end, &last);
+	ring->count = index + 1;
+	segment->bytes = end;
+	segment->records = tick - segment->tick + 1;
+	ring->head = segment->offset + end;
+	memcpy(ring->keyframe, ring->data + segment->offset,
+			SNAPSHOT_IMAGE_BYTES);
+}
+
+/**
+ * snapshot_rewind - Goes back in time.
+ * @game: Pointer to the Game structure.
+ * @ticks: Number of ticks to go back, stopping at the oldest one held.
+ *
+ * The game takes the state of the tick rewound to and the later ticks
+ * are dropped.
+ *
+ * Return: true on success, false if nothing was recorded.
+ */
+bool snapshot_rewind(struct Game *game, long ticks)
+{
+	struct SnapshotRing *ring = game->snapshots;
+	long tick;
+
+	if (!ring || !ring->count)
+		return (false);
+	tick = SDL_max(snapshot_last_tick(ring) - ticks,
+			snapshot_first_tick(ring));
+	snapshot_truncate(ring, tick);
+	snapshot_apply(game, ring->previous);
+	return (true);
+}
+
+/**
+ * snapshot_find - Finds the segment holding a tick.
+ * @ring: Pointer to the SnapshotRing.
+ * @tick: Tick to find.
+ *
+ * Every segment but the newest holds SNAPSHOT_KEYFRAME_TICKS ticks, so
+ * the segment is found by a division.
+ *
+ * Return: Position of the segment from the oldest one, -1 if the tick is
+ * not held.
+ */
+static int snapshot_find(const struct SnapshotRing *ring, long tick)
+{
+	if (!ring->count || tick < snapshot_first_tick(ring) ||
+			tick > snapshot_last_tick(ring))
+		return (-1);
+	return ((tick - snapshot_first_tick(ring)) / SNAPSHOT_KEYFRAME_TICKS);
+}
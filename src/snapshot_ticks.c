@@ -0,0 +1,29 @@
+#include "../inc/game.h"
+
+/**
+ * snapshot_first_tick - Gives the oldest tick held.
+ * @ring: Pointer to the SnapshotRing.
+ *
+ * Return: The tick, 0 when the ring is empty.
+ */
+long snapshot_first_tick(const struct SnapshotRing *ring)
+{
+	return (ring->count ? ring->segments[ring->first].tick : 0);
+}
+
+/**
+ * snapshot_last_tick - Gives the newest tick held.
+ * @ring: Pointer to the SnapshotRing.
+ *
+ * Return: The tick, -1 when the ring is empty.
+ */
+long snapshot_last_tick(const struct SnapshotRing *ring)
+{
+	const struct SnapshotSegment *newest;
+
+	if (!ring->count)
+		return (-1);
+	newest = &ring->segments[(ring->first + ring->count - 1) %
+		SNAPSHOT_SEGMENTS];
+	return (newest->tick + newest->records - 1);
+}
@@ -0,0 +1,45 @@
+#include "../inc/game.h"
+
+/**
+ * stats_frame_end - Counts a rendered frame and reports the statistics
+ *		once every STATS_INTERVAL_MS.
+ * @game: Pointer to the Game structure.
+ *
+ * The report is only printed with the --stats option; the counters are
+ * reset at the end of every window either way.
+ */
+void stats_frame_end(struct Game *game)
+{
+	struct FrameStats *stats = &game->stats;
+	Uint32 now = SDL_GetTicks();
+	Uint32 elapsed = now - stats->window_start;
+
+	stats->frames++;
+	if (elapsed < STATS_INTERVAL_MS)
+		return;
+	if (game->options.stats)
+		printf("%5.1f fps  columns cast %5.1f%% interpolated %5.1f%% "
+				"reused %5.1f%%  overdraw %.2f  "
+				"layers %.2f  %s calls %.0f  level %.1f MiB\n",
+				stats->frames * 1000.0 / elapsed,
+				stats->columns ? 100.0 * stats->columns_cast / stats->columns : 0,
+				stats->columns ? 100.0 * stats->columns_interpolated /
+				stats->columns : 0, stats->columns ? 100.0 * (stats->columns -
+					stats->columns_cast - stats->columns_interpolated) /
+				stats->columns : 0, stats->pixels_covered ?
+				(double)stats->pixels_drawn / stats->pixels_covered : 0,
+				stats->columns ? (double)stats->layers / stats->columns : 0,
+				game->batches ? "batched" : "immediate",
+				(double)stats->render_calls / stats->frames,
+				game->levels ? level_set_memory(game->levels,
+					game->levels->slots[game->levels->current].index, NULL) /
+				1048576.0 : 0);
+	if (game->options.stats)
+		pacing_report(stats);
+	if (game->options.stats && game->capture)
+		printf("capture %.3f ms/frame  %ld dropped\n", stats->capture_ticks *
+				1000.0 / SDL_GetPerformanceFrequency() / stats->frames,
+				stats->frames_dropped);
+	memset(stats, 0, sizeof(*stats));
+	stats->window_start = now;
+}
@@ -0,0 +1,100 @@
+#include "../inc/world.h"
+
+/**
+ * world_create - Creates a streamed world and starts its generation thread.
+ * @seed: World seed.
+ * @chunks_x: World width in chunks.
+ * @chunks_y: World height in chunks.
+ * @cache_bytes: Memory cap of the chunk cache. It is raised to hold at
+ *		least WORLD_MIN_CHUNKS chunks and lowered to the world size.
+ *
+ * Return: Pointer to the World, or NULL on failure.
+ */
+struct World *world_create(Uint64 seed, int chunks_x, int chunks_y,
+		size_t cache_bytes)
+{
+	struct World *world = calloc(1, sizeof(*world));
+	size_t i, buckets = 1;
+
+	if (!world)
+		return (NULL);
+	world->seed = seed;
+	world->chunks_x = chunks_x;
+	world->chunks_y = chunks_y;
+	world->slot_count = SDL_min(SDL_max(cache_bytes /
+				(sizeof(struct WorldChunk) + 2 * sizeof(struct WorldChunk *)),
+				WORLD_MIN_CHUNKS), (size_t)chunks_x * chunks_y);
+	while (buckets < 2 * world->slot_count)
+		buckets *= 2;
+	world->bucket_mask = buckets - 1;
+	world->slots = malloc(world->slot_count * sizeof(*world->slots));
+	world->buckets = calloc(buckets, sizeof(*world->buckets));
+	world->lock = SDL_CreateMutex();
+	world->wake = SDL_CreateCond();
+	if (!world->slots || !world->buckets || !world->lock || !world->wake)
+	{
+		world_destroy(world);
+		return (NULL);
+	}
+	for (i = 0; i < world->slot_count; i++)
+	{
+		world->slots[i].state = CHUNK_FREE;
+		world->slots[i].lru_prev = NULL;
+		world->slots[i].lru_next = NULL;
+		world->slots[i].queue_next = world->free_list;
+		world->free_list = &world->slots[i];
+	}
+	world->thread = SDL_CreateThread(world_worker, "world", world);
+	if (!world->thread)
+	{
+		world_destroy(world);
+		return (NULL);
+	}
+	return (world);
+}
+
+/**
+ * world_destroy - Stops the generation thread and releases the world.
+ * @world: Pointer to the World, may be NULL.
+ */
+void world_destroy(struct World *world)
+{
+	if (!world)
+		return;
+	if (world->thread)
+	{
+		SDL_LockMutex(world->lock);
+		world->quit = true;
+		SDL_CondSignal(world->wake);
+		SDL_UnlockMutex(world->lock);
+		SDL_WaitThread(world->thread, NULL);
+	}
+	if (world->wake)
+		SDL_DestroyCond(world->wake);
+	if (world->lock)
+		SDL_DestroyMutex(world->lock);
+	free(world->buckets);
+	free(world->slots);
+	free(world);
+}
+
+/**
+ * world_cell - Reads one tile of the world.
+ * @world: Pointer to the World.
+ * @x: Tile column, inside the world.
+ * @y: Tile row, inside the world.
+ *
+ * Never blocks: a chunk that is not resident yet reads as walls.
+ *
+ * Return: MAP_WALL or MAP_FLOOR.
+ */
+int world_cell(const struct World *world, int x, int y)
+{
+	const struct WorldChunk *chunk = world_lookup(world,
+			x >> WORLD_CHUNK_SHIFT, y >> WORLD_CHUNK_SHIFT);
+
+	if (!chunk || chunk->state != CHUNK_RESIDENT)
+		return (MAP_WALL);
+	return (chunk->tiles[(y & (WORLD_CHUNK_SIZE - 1)) * WORLD_CHUNK_SIZE +
+		(x & (WORLD_CHUNK_SIZE - 1))]);
+}
@@ -0,0 +1,107 @@
+#include "../inc/world.h"
+
+static size_t world_bucket(const struct World *world, int cx, int cy);
+
+/**
+ * world_lookup - Finds the pending or resident chunk at chunk coordinates.
+ * @world: Pointer to the World.
+ * @cx: Chunk column.
+ * @cy: Chunk row.
+ *
+ * Return: Pointer to the chunk, or NULL if it is neither queued nor loaded.
+ */
+struct WorldChunk *world_lookup(const struct World *world, int cx, int cy)
+{
+	struct WorldChunk *chunk = world->buckets[world_bucket(world, cx, cy)];
+
+	while (chunk && (chunk->cx != cx || chunk->cy != cy))
+		chunk = chunk->hash_next;
+	return (chunk);
+}
+
+/**
+ * world_insert - Adds a chunk to the hash table.
+ * @world: Pointer to the World.
+ * @chunk: Pointer to the chunk, its coordinates already set.
+ */
+void world_insert(struct World *world, struct WorldChunk *chunk)
+{
+	size_t bucket = world_bucket(world, chunk->cx, chunk->cy);
+
+	chunk->hash_next = world->buckets[bucket];
+	world->buckets[bucket] = chunk;
+}
+
+/**
+ * world_touch - Moves a resident chunk to the front of the LRU list.
+ * @world: Pointer to the World.
+ * @chunk: Pointer to the resident chunk, linked in the list or not.
+ */
+void world_touch(struct World *world, struct WorldChunk *chunk)
+{
+	if (world->lru_head == chunk)
+		return;
+	if (chunk->lru_prev)
+		chunk->lru_prev->lru_next = chunk->lru_next;
+	if (chunk->lru_next)
+		chunk->lru_next->lru_prev = chunk->lru_prev;
+	else if (world->lru_tail == chunk)
+		world->lru_tail = chunk->lru_prev;
+	chunk->lru_prev = NULL;
+	chunk->lru_next = world->lru_head;
+	if (world->lru_head)
+		world->lru_head->lru_prev = chunk;
+	world->lru_head = chunk;
+	if (!world->lru_tail)
+		world->lru_tail = chunk;
+}
+
+/**
+ * world_evict - Frees the least recently used resident chunk.
+ * @world: Pointer to the World.
+ *
+ * Pending chunks are not in the LRU list, so the worker never loses the
+ * chunk it is writing.
+ *
+ * Return: true if a chunk went back to the free list, false if none is
+ * resident.
+ */
+bool world_evict(struct World *world)
+{
+	struct WorldChunk *chunk = world->lru_tail, **link;
+
+	if (!chunk)
+		return (false);
+	world->lru_tail = chunk->lru_prev;
+	if (world->lru_tail)
+		world->lru_tail->lru_next = NULL;
+	else
+		world->lru_head = NULL;
+	link = &world->buckets[world_bucket(world, chunk->cx, chunk->cy)];
+	while (*link != chunk)
+		link = &(*link)->hash_next;
+	*link = chunk->hash_next;
+	chunk->lru_prev = NULL;
+	chunk->lru_next = NULL;
+	chunk->state = CHUNK_FREE;
+	chunk->queue_next = world->free_list;
+	world->free_list = chunk;
+	world->resident--;
+	world->evictions++;
+	return (true);
+}
+
+/**
+ * world_bucket - Hashes chunk coordinates.
+ * @world: Pointer to the World.
+ * @cx: Chunk column.
+ * @cy: Chunk row.
+ *
+ * Return: Bucket index.
+ */
+static size_t world_bucket(const struct World *world, int cx, int cy)
+{
+	Uint32 hash = (Uint32)cx * 73856093u ^ (Uint32)cy * 19349663u;
+
+	return ((hash ^ hash >> 16) & world->bucket_mask);
+}
@@ -0,0 +1,131 @@
+#include "../inc/world.h"
+#include "../inc/maze_gen.h"
+
+#define WORLD_MAZE_SIZE (WORLD_CHUNK_SIZE + 1)
+
+static void world_generate_chunk(const struct World *world,
+		struct WorldChunk *chunk, Uint8 *maze);
+static Uint64 world_chunk_seed(const struct World *world, int cx, int cy,
+		int salt);
+
+/**
+ * world_worker - Background thread generating the queued chunks.
+ * @data: Pointer to the World.
+ *
+ * Return: Always 0.
+ */
+int world_worker(void *data)
+{
+	struct World *world = data;
+	struct WorldChunk *chunk;
+	Uint8 maze[WORLD_MAZE_SIZE * WORLD_MAZE_SIZE];
+
+	SDL_LockMutex(world->lock);
+	while (!world->quit)
+	{
+		if (!world->requests)
+		{
+			SDL_CondWait(world->wake, world->lock);
+			continue;
+		}
+		chunk = world->requests;
+		world->requests = chunk->queue_next;
+		if (!world->requests)
+			world->requests_tail = NULL;
+		SDL_UnlockMutex(world->lock);
+		world_generate_chunk(world, chunk, maze);
+		SDL_LockMutex(world->lock);
+		chunk->queue_next = world->done;
+		world->done = chunk;
+	}
+	SDL_UnlockMutex(world->lock);
+	return (0);
+}
+
+/**
+ * world_parse_spec - Parses "world:<seed>[:<chunks_x>x<chunks_y>]".
+ * @text: Specification string, e.g. "world:42:128x128".
+ * @seed: Pointer to store the world seed.
+ * @chunks_x: Pointer to store the world width in chunks.
+ * @chunks_y: Pointer to store the world height in chunks.
+ *
+ * The seed, and the size when given, must take up the whole rest of the
+ * string: "world:42:abc" is not read as world 42.
+ *
+ * Return: true if the string is a valid world specification.
+ */
+bool world_parse_spec(const char *text, Uint64 *seed, int *chunks_x,
+		int *chunks_y)
+{
+	unsigned long long value = 0;
+	int fields, used = 0;
+
+	if (strncmp(text, WORLD_SPEC_PREFIX, strlen(WORLD_SPEC_PREFIX)) != 0)
+		return (false);
+	text += strlen(WORLD_SPEC_PREFIX);
+	*chunks_x = WORLD_DEFAULT_CHUNKS;
+	*chunks_y = WORLD_DEFAULT_CHUNKS;
+	fields = sscanf(text, "%llu%n:%dx%d%n", &value, &used, chunks_x, chunks_y,
+			&used);
+	*seed = value;
+	return ((fields == 1 || fields == 3) && !text[used] &&
+		*chunks_x > 0 && *chunks_y > 0 &&
+		*chunks_x <= MAP_MAX_DIMENSION / WORLD_CHUNK_SIZE &&
+		*chunks_y <= MAP_MAX_DIMENSION / WORLD_CHUNK_SIZE);
+}
+
+/**
+ * world_generate_chunk - Fills a chunk with its maze.
+ * @world: Pointer to the World.
+ * @chunk: Pointer to the chunk whose coordinates are set.
+ * @maze: Scratch grid of WORLD_MAZE_SIZE squared tiles.
+ *
+ * Every chunk is a recursive backtracker maze seeded from the world seed
+ * and the chunk coordinates, so a chunk evicted and generated again comes
+ * back identical. Its left and top walls are shared with the neighbouring
+ * chunks; each gets one door so the whole world stays connected.
+ */
+static void world_generate_chunk(const struct World *world,
+		struct WorldChunk *chunk, Uint8 *maze)
+{
+	struct MazeRng rng = {world_chunk_seed(world, chunk->cx, chunk->cy, 0)};
+	int y, door;
+
+	memset(maze, MAP_WALL, WORLD_MAZE_SIZE * WORLD_MAZE_SIZE);
+	if (!maze_backtracker(maze, WORLD_CHUNK_CELLS, WORLD_CHUNK_CELLS, &rng))
+		memset(maze, MAP_WALL, WORLD_MAZE_SIZE * WORLD_MAZE_SIZE);
+	for (y = 0; y < WORLD_CHUNK_SIZE; y++)
+		memcpy(chunk->tiles + y * WORLD_CHUNK_SIZE, maze + y * WORLD_MAZE_SIZE,
+				WORLD_CHUNK_SIZE);
+	if (chunk->cx > 0)
+	{
+		rng.state = world_chunk_seed(world, chunk->cx, chunk->cy, 1);
+		door = 2 * maze_rng_below(&rng, WORLD_CHUNK_CELLS) + 1;
+		chunk->tiles[door * WORLD_CHUNK_SIZE] = MAP_FLOOR;
+	}
+	if (chunk->cy > 0)
+	{
+		rng.state = world_chunk_seed(world, chunk->cx, chunk->cy, 2);
+		door = 2 * maze_rng_below(&rng, WORLD_CHUNK_CELLS) + 1;
+		chunk->tiles[door] = MAP_FLOOR;
+	}
+}
+
+/**
+ * world_chunk_seed - Derives a generator seed for one chunk.
+ * @world: Pointer to the World.
+ * @cx: Chunk column.
+ * @cy: Chunk row.
+ * @salt: Distinguishes the streams drawn for one chunk.
+ *
+ * Return: Seed for a MazeRng.
+ */
+static Uint64 world_chunk_seed(const struct World *world, int cx, int cy,
+		int salt)
+{
+	struct MazeRng rng = {world->seed ^ ((Uint64)(Uint32)cx << 32 |
+			(Uint32)cy)};
+
+	rng.state ^= maze_rng_next(&rng) + (Uint64)salt;
+	return (maze_rng_next(&rng));
+}
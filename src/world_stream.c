@@ -0,0 +1,122 @@
+#include "../inc/world.h"
+
+static void world_touch_window(struct World *world, int center_x,
+		int center_y);
+static void world_request_window(struct World *world, int center_x,
+		int center_y);
+
+/**
+ * world_update - Streams chunks around the player, once per frame.
+ * @world: Pointer to the World.
+ * @player_x: Player x position, in world units.
+ * @player_y: Player y position, in world units.
+ * @dir_x: X component of the player's direction.
+ * @dir_y: Y component of the player's direction.
+ *
+ * Chunks finished by the worker become resident first. The chunks within
+ * WORLD_RESIDENT_RADIUS of the player, and of the point WORLD_LOOKAHEAD_TILES
+ * ahead of it, are then marked as recently used; the missing ones are
+ * queued nearest first, reusing the least recently used chunks once the
+ * cache is full.
+ *
+ * Return: true if a chunk became resident or was evicted, i.e. the tiles
+ * seen through world_cell() changed.
+ */
+bool world_update(struct World *world, float player_x, float player_y,
+		float dir_x, float dir_y)
+{
+	struct WorldChunk *done, *chunk;
+	long evictions = world->evictions;
+	bool changed;
+	int center_x = (int)(player_x / TILE_SIZE) >> WORLD_CHUNK_SHIFT;
+	int center_y = (int)(player_y / TILE_SIZE) >> WORLD_CHUNK_SHIFT;
+	int ahead_x = (int)(player_x / TILE_SIZE + dir_x * WORLD_LOOKAHEAD_TILES);
+	int ahead_y = (int)(player_y / TILE_SIZE + dir_y * WORLD_LOOKAHEAD_TILES);
+
+	ahead_x = ahead_x < 0 ? -1 : ahead_x >> WORLD_CHUNK_SHIFT;
+	ahead_y = ahead_y < 0 ? -1 : ahead_y >> WORLD_CHUNK_SHIFT;
+	SDL_LockMutex(world->lock);
+	done = world->done;
+	world->done = NULL;
+	SDL_UnlockMutex(world->lock);
+	changed = done != NULL;
+	while (done)
+	{
+		chunk = done;
+		done = chunk->queue_next;
+		chunk->state = CHUNK_RESIDENT;
+		world->resident++;
+		world_touch(world, chunk);
+	}
+	world_touch_window(world, ahead_x, ahead_y);
+	world_touch_window(world, center_x, center_y);
+	world_request_window(world, center_x, center_y);
+	world_request_window(world, ahead_x, ahead_y);
+	return (changed || world->evictions != evictions);
+}
+
+/**
+ * world_touch_window - Marks the resident chunks around a chunk as used.
+ * @world: Pointer to the World.
+ * @center_x: Chunk column at the center of the window.
+ * @center_y: Chunk row at the center of the window.
+ */
+static void world_touch_window(struct World *world, int center_x,
+		int center_y)
+{
+	struct WorldChunk *chunk;
+	int cx, cy;
+
+	for (cy = center_y - WORLD_RESIDENT_RADIUS;
+			cy <= center_y + WORLD_RESIDENT_RADIUS; cy++)
+		for (cx = center_x - WORLD_RESIDENT_RADIUS;
+				cx <= center_x + WORLD_RESIDENT_RADIUS; cx++)
+		{
+			chunk = world_lookup(world, cx, cy);
+			if (chunk && chunk->state == CHUNK_RESIDENT)
+				world_touch(world, chunk);
+		}
+}
+
+/**
+ * world_request_window - Queues the missing chunks around a chunk.
+ * @world: Pointer to the World.
+ * @center_x: Chunk column at the center of the window.
+ * @center_y: Chunk row at the center of the window.
+ *
+ * Chunks are visited ring by ring so the closest ones are generated first.
+ */
+static void world_request_window(struct World *world, int center_x,
+		int center_y)
+{
+	struct WorldChunk *chunk;
+	int ring, cx, cy;
+
+	for (ring = 0; ring <= WORLD_RESIDENT_RADIUS; ring++)
+		for (cy = center_y - ring; cy <= center_y + ring; cy++)
+			for (cx = center_x - ring; cx <= center_x + ring; cx++)
+			{
+				if (abs(cx - center_x) != ring && abs(cy - center_y) != ring)
+					continue;
+				if (cx < 0 || cy < 0 || cx >= world->chunks_x ||
+						cy >= world->chunks_y || world_lookup(world, cx, cy))
+					continue;
+				if (!world->free_list && !world_evict(world))
+					return;
+				chunk = world->free_list;
+				world->free_list = chunk->queue_next;
+				chunk->cx = cx;
+				chunk->cy = cy;
+				chunk->state = CHUNK_PENDING;
+				chunk->queue_next = NULL;
+				world_insert(world, chunk);
+				SDL_LockMutex(world->lock);
+				if (world->requests_tail)
+					world->requests_tail->queue_next = chunk;
+				else
+					world->requests = chunk;
+				world->requests_tail = chunk;
+				SDL_CondSignal(world->wake);
+				SDL_UnlockMutex(world->lock);
+			}
+}
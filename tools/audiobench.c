@@ -0,0 +1,120 @@
+#include "../inc/game.h"
+
+#define DEFAULT_SECONDS 10
+
+static bool bench_device(struct Audio *audio);
+static void bench_voices(struct Audio *audio, int count);
+
+/**
+ * main - Benchmarks the software audio mixer.
+ * @argc: argument count
+ * @argv: argument array
+ *
+ * Usage: audiobench [seconds]
+ *
+ * Opens the audio device, the dummy driver unless SDL_AUDIODRIVER says
+ * otherwise, checks that it pulls blocks from the mixer, then pauses it
+ * and mixes the given seconds of audio on this thread with more and more
+ * positional voices. The throughput is reported in voice blocks of
+ * AUDIO_FRAMES frames mixed per millisecond, and as the number of voices
+ * that could be mixed in real time.
+ *
+ * Return: Exit status.
+ */
+int main(int argc, char *argv[])
+{
+	struct Audio *audio;
+	static float stream[2 * AUDIO_FRAMES];
+	int seconds = argc > 1 ? atoi(argv[1]) : DEFAULT_SECONDS, count, block;
+	int blocks = seconds * AUDIO_RATE / AUDIO_FRAMES;
+	Uint64 start;
+	double milliseconds;
+
+	if (argc > 2 || seconds <= 0)
+	{
+		fprintf(stderr, "Usage: %s [seconds]\n", argv[0]);
+		return (EXIT_FAILURE);
+	}
+	setenv("SDL_AUDIODRIVER", "dummy", 0);
+	if (SDL_Init(0) != 0 || !(audio = audio_create(true)))
+		return (EXIT_FAILURE);
+	if (!bench_device(audio))
+	{
+		audio_destroy(audio);
+		return (EXIT_FAILURE);
+	}
+	printf("voices  ms/block  voice-blocks/ms  real-time voices\n");
+	for (count = 1; count <= AUDIO_VOICES; count *= 2)
+	{
+		bench_voices(audio, count);
+		start = SDL_GetPerformanceCounter();
+		for (block = 0; block < blocks; block++)
+			audio_mix(audio, stream, AUDIO_FRAMES);
+		milliseconds = (SDL_GetPerformanceCounter() - start) * 1000.0 /
+			SDL_GetPerformanceFrequency();
+		printf("%6d  %8.4f  %15.1f  %16.0f\n", count, milliseconds / blocks,
+				count * blocks / milliseconds,
+				count * seconds * 1000.0 / milliseconds);
+	}
+	audio_destroy(audio);
+	SDL_Quit();
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * bench_device - Checks that the audio device runs the mixer, then
+ *		pauses it.
+ * @audio: Pointer to the Audio, its device open.
+ *
+ * Return: true if the device consumed commands, false otherwise.
+ */
+static bool bench_device(struct Audio *audio)
+{
+	Uint32 start = SDL_GetTicks();
+
+	audio_play(audio, AUDIO_CLICK, 0, 0, 1, false);
+	while (SDL_AtomicGet(&audio->tail) != SDL_AtomicGet(&audio->head) &&
+			SDL_GetTicks() - start < 1000)
+		SDL_Delay(1);
+	SDL_PauseAudioDevice(audio->device, 1);
+	if (SDL_AtomicGet(&audio->tail) != SDL_AtomicGet(&audio->head))
+	{
+		fprintf(stderr, "The audio device never called the mixer\n");
+		return (false);
+	}
+	printf("Audio device running on the %s driver\n",
+			SDL_GetCurrentAudioDriver());
+	return (true);
+}
+
+/**
+ * bench_voices - Surrounds the listener with looping voices.
+ * @audio: Pointer to the Audio, its device paused.
+ * @count: Number of voices.
+ *
+ * The voices stand in a spiral within earshot, every other one behind a
+ * wall, so the mixer pans, attenuates and filters every one of them.
+ */
+static void bench_voices(struct Audio *audio, int count)
+{
+	static float stream[2 * AUDIO_FRAMES];
+	struct AudioCommand command = {AUDIO_LISTEN, 0, 0, false, 0, 0, 0};
+	float angle, distance;
+	int voice;
+
+	audio_push(audio, &command);
+	for (voice = 0; voice < AUDIO_VOICES; voice++)
+		if (audio->sources[voice].active)
+			audio_stop(audio, voice);
+	for (voice = 0; voice < count; voice++)
+	{
+		angle = voice * 2 * PI / count;
+		distance = AUDIO_RANGE * (voice + 1) / (count + 1);
+		command.voice = audio_play(audio, AUDIO_HUM, distance * cosf(angle),
+				distance * sinf(angle), 1, true);
+		command.type = AUDIO_OCCLUDE;
+		command.value = voice % 2 ? AUDIO_WALL_GAIN : 1;
+		audio_push(audio, &command);
+	}
+	audio_mix(audio, stream, AUDIO_FRAMES);
+}
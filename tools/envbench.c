@@ -0,0 +1,81 @@
+#include "../inc/env.h"
+#include "../inc/maze_gen.h"
+
+#define DEFAULT_AGENTS 4096
+#define DEFAULT_COLUMNS 64
+#define DEFAULT_STEPS 200
+#define STEP_SECONDS (1.0f / 60)
+
+static double run_steps(struct Env *env, float *actions, int steps);
+
+/**
+ * main - Benchmarks the headless environment on one and on all cores.
+ * @argc: argument count
+ * @argv: argument array
+ *
+ * Usage: envbench <map_file | maze:...> [agents] [columns] [steps]
+ *
+ * Return: Exit status.
+ */
+int main(int argc, char *argv[])
+{
+	int agents = argc > 2 ? atoi(argv[2]) : DEFAULT_AGENTS;
+	int columns = argc > 3 ? atoi(argv[3]) : DEFAULT_COLUMNS;
+	int steps = argc > 4 ? atoi(argv[4]) : DEFAULT_STEPS;
+	int threads[2] = {0, job_pool_default_threads()}, run;
+	struct Env *env;
+	float *actions;
+	double seconds;
+
+	if (argc < 2 || argc > 5 || agents <= 0 || columns <= 0 || steps <= 0)
+	{
+		fprintf(stderr, "Usage: %s <map_file|maze:...> [agents] [columns]"
+				" [steps]\n", argv[0]);
+		return (EXIT_FAILURE);
+	}
+	actions = malloc((size_t)agents * ENV_ACTION_SIZE * sizeof(*actions));
+	if (!actions)
+		return (EXIT_FAILURE);
+	for (run = 0; run < 2; run++)
+	{
+		env = env_create(argv[1], agents, columns, threads[run]);
+		if (!env)
+		{
+			fprintf(stderr, "Unable to create the environment\n");
+			free(actions);
+			return (EXIT_FAILURE);
+		}
+		seconds = run_steps(env, actions, steps);
+		printf("%d agents x %d columns, %d thread%s: %12.0f agent-steps/sec\n",
+				agents, columns, threads[run] + 1, threads[run] ? "s" : "",
+				seconds > 0 ? (double)agents * steps / seconds : 0);
+		env_destroy(env);
+	}
+	free(actions);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * run_steps - Steps the environment with random actions.
+ * @env: Pointer to the Env.
+ * @actions: Array of agent_count * ENV_ACTION_SIZE floats.
+ * @steps: Number of steps.
+ *
+ * Return: Time spent in env_step(), in seconds.
+ */
+static double run_steps(struct Env *env, float *actions, int steps)
+{
+	struct MazeRng rng = {MAZE_DEFAULT_SEED};
+	Uint64 elapsed = 0, start;
+	int step, i;
+
+	for (step = 0; step < steps; step++)
+	{
+		for (i = 0; i < env->agent_count * ENV_ACTION_SIZE; i++)
+			actions[i] = maze_rng_below(&rng, 3) - 1;
+		start = SDL_GetPerformanceCounter();
+		env_step(env, actions, STEP_SECONDS);
+		elapsed += SDL_GetPerformanceCounter() - start;
+	}
+	return ((double)elapsed / SDL_GetPerformanceFrequency());
+}
@@ -0,0 +1,174 @@
+#include "../inc/game.h"
+#include "../inc/maze_gen.h"
+
+#define DEFAULT_VIEWS 200
+#define WALK_STEPS 10000
+
+static void random_view(const struct Game *game, struct MazeRng *rng,
+		struct FixedPlayer *fixed_player, struct Player *player,
+		const struct FixedTables *tables);
+static Uint64 cast_views(const struct Game *game,
+		const struct FixedTables *tables, int views,
+		struct FixedPlayer *fixed_player, Uint64 ticks[2]);
+static Uint64 hash_value(Uint64 hash, Sint64 value);
+static Uint64 walk_checksum(const struct Game *game,
+		const struct FixedTables *tables, struct FixedPlayer *player);
+
+/**
+ * main - Benchmarks the fixed-point ray caster against the float one.
+ * @argc: argument count
+ * @argv: argument array
+ *
+ * Usage: fixedbench <map_file | maze:...> [views]
+ *
+ * Each view casts NUM_RAYS columns from a random floor tile. The checksum
+ * covers every fixed-point hit and a scripted walk; it must print the same
+ * value for every compiler, flag and CPU.
+ *
+ * Return: Exit status.
+ */
+int main(int argc, char *argv[])
+{
+	struct Game game = {0};
+	struct FixedTables *tables = fixed_tables_create(NUM_RAYS);
+	struct FixedPlayer fixed_player;
+	int views = argc > 2 ? atoi(argv[2]) : DEFAULT_VIEWS;
+	Uint64 ticks[2] = {0, 0}, checksum;
+	double rays, frequency = SDL_GetPerformanceFrequency();
+
+	if (argc < 2 || argc > 3 || views <= 0 || !tables)
+	{
+		fprintf(stderr, "Usage: %s <map_file|maze:...> [views]\n", argv[0]);
+		fixed_tables_destroy(tables);
+		return (EXIT_FAILURE);
+	}
+	if (!parse_map_file(&game, argv[1]) || !game.map)
+	{
+		fixed_tables_destroy(tables);
+		world_destroy(game.world);
+		return (EXIT_FAILURE);
+	}
+	checksum = cast_views(&game, tables, views, &fixed_player, ticks);
+	rays = (double)views * NUM_RAYS;
+	printf("float %12.0f rays/sec\n", ticks[1] ? rays * frequency /
+			ticks[1] : 0);
+	printf("fixed %12.0f rays/sec\n", ticks[0] ? rays * frequency /
+			ticks[0] : 0);
+	printf("checksum %016llx\n", (unsigned long long)hash_value(checksum,
+				walk_checksum(&game, tables, &fixed_player)));
+	fixed_tables_destroy(tables);
+	free(game.map);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * cast_views - Casts random views with both engines.
+ * @game: Pointer to the Game holding the map.
+ * @tables: Pointer to the FixedTables.
+ * @views: Number of views.
+ * @fixed_player: Pointer to store the fixed-point player of the last view.
+ * @ticks: Performance counter ticks spent by the fixed and the float
+ *		engine, added to.
+ *
+ * Return: Checksum of every fixed-point hit.
+ */
+static Uint64 cast_views(const struct Game *game,
+		const struct FixedTables *tables, int views,
+		struct FixedPlayer *fixed_player, Uint64 ticks[2])
+{
+	struct MazeRng rng = {MAZE_DEFAULT_SEED};
+	struct Player player;
+	struct FixedHit hit;
+	struct RayHit float_hit;
+	Uint64 start, checksum = 0;
+	int view, column;
+
+	for (view = 0; view < views; view++)
+	{
+		random_view(game, &rng, fixed_player, &player, tables);
+		start = SDL_GetPerformanceCounter();
+		for (column = 0; column < NUM_RAYS; column++)
+		{
+			fixed_cast_ray(game, tables, fixed_player, fixed_angle_wrap(tables,
+						fixed_player->angle - NUM_RAYS / 2 + column), &hit);
+			checksum = hash_value(checksum, hit.distance);
+			checksum = hash_value(checksum, hit.x ^ hit.y ^ hit.is_vertical);
+		}
+		ticks[0] += SDL_GetPerformanceCounter() - start;
+		start = SDL_GetPerformanceCounter();
+		for (column = 0; column < NUM_RAYS; column++)
+			cast_single_ray(game, &player, player.angle - FOV_HALF_RADIAN +
+					column * FOV_RADIAN / (NUM_RAYS - 1), &float_hit);
+		ticks[1] += SDL_GetPerformanceCounter() - start;
+	}
+	return (checksum);
+}
+
+/**
+ * random_view - Picks a random floor tile and view angle for both engines.
+ * @game: Pointer to the Game holding the map.
+ * @rng: Pointer to the random generator.
+ * @fixed_player: Pointer to the FixedPlayer to place.
+ * @player: Pointer to the float Player to place at the same spot.
+ * @tables: Pointer to the FixedTables.
+ */
+static void random_view(const struct Game *game, struct MazeRng *rng,
+		struct FixedPlayer *fixed_player, struct Player *player,
+		const struct FixedTables *tables)
+{
+	int x, y;
+
+	do {
+		x = maze_rng_below(rng, game->map_width);
+		y = maze_rng_below(rng, game->map_height);
+	} while (map_cell(game, x, y) != MAP_FLOOR);
+	fixed_player->x = FIX_FROM_INT(x) + FIX_ONE / 2;
+	fixed_player->y = FIX_FROM_INT(y) + FIX_ONE / 2;
+	fixed_player->angle = maze_rng_below(rng, tables->angles);
+	player->x = (x + 0.5f) * TILE_SIZE;
+	player->y = (y + 0.5f) * TILE_SIZE;
+	player->angle = fixed_player->angle * 2 * PI / tables->angles;
+}
+
+/**
+ * hash_value - Folds a value into an FNV-1a hash.
+ * @hash: Hash so far.
+ * @value: Value to fold in.
+ *
+ * Return: Updated hash.
+ */
+static Uint64 hash_value(Uint64 hash, Sint64 value)
+{
+	int i;
+
+	for (i = 0; i < 8; i++)
+		hash = (hash ^ ((Uint64)value >> (8 * i) & 0xFF)) *
+			0x100000001B3ULL;
+	return (hash);
+}
+
+/**
+ * walk_checksum - Walks a player with scripted inputs through the map.
+ * @game: Pointer to the Game holding the map.
+ * @tables: Pointer to the FixedTables.
+ * @player: Pointer to the FixedPlayer, moved in place.
+ *
+ * Return: Hash of every position and angle along the walk.
+ */
+static Uint64 walk_checksum(const struct Game *game,
+		const struct FixedTables *tables, struct FixedPlayer *player)
+{
+	struct MazeRng rng = {MAZE_DEFAULT_SEED};
+	Uint64 hash = 0;
+	int step;
+
+	for (step = 0; step < WALK_STEPS; step++)
+	{
+		fixed_rotate_player(tables, player, maze_rng_below(&rng, 41) - 20);
+		fixed_move_player(game, tables, player, FIX_ONE / 8,
+				maze_rng_below(&rng, 3) * FIX_ONE / 32 - FIX_ONE / 32);
+		hash = hash_value(hash, (Sint64)player->x << 32 ^ player->y);
+		hash = hash_value(hash, player->angle);
+	}
+	return (hash);
+}
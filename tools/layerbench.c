@@ -0,0 +1,152 @@
+#include "../inc/game.h"
+
+#define DEFAULT_FRAMES 200
+#define CORRIDOR_LENGTH 40
+#define CORRIDOR_HEIGHT 5
+
+static bool bench_setup(struct Game *game, SDL_Surface **target);
+static void bench_corridor(struct Game *game, int grates);
+static void bench_cleanup(struct Game *game, SDL_Surface *target);
+
+/**
+ * main - Benchmarks rendering through stacked see-through layers.
+ * @argc: argument count
+ * @argv: argument array
+ *
+ * Usage: layerbench [frames]
+ *
+ * Renders a corridor looking through 0 to CAST_MAX_LAYERS + 2 grates into
+ * an offscreen software renderer, ending on a thin wall, and reports the
+ * frame time with the number of layers drawn per column and the renderer
+ * calls per frame, first drawing strips one at a time, then batched.
+ *
+ * Return: Exit status.
+ */
+int main(int argc, char *argv[])
+{
+	struct Game game = {0};
+	SDL_Surface *target = NULL;
+	int frames = argc > 1 ? atoi(argv[1]) : DEFAULT_FRAMES, grates, frame;
+	int batched;
+	Uint64 start;
+	double milliseconds;
+
+	if (argc > 2 || frames <= 0)
+	{
+		fprintf(stderr, "Usage: %s [frames]\n", argv[0]);
+		return (EXIT_FAILURE);
+	}
+	if (!bench_setup(&game, &target))
+	{
+		bench_cleanup(&game, target);
+		return (EXIT_FAILURE);
+	}
+	printf("backend    grates  ms/frame  layers/column  calls/frame\n");
+	for (batched = 0; batched < 2; batched++)
+	{
+		game.batches = batched ? render_batches_create() : NULL;
+		for (grates = 0; grates <= CAST_MAX_LAYERS + 2; grates++)
+		{
+			bench_corridor(&game, grates);
+			render_cameras(&game);
+			memset(&game.stats, 0, sizeof(game.stats));
+			start = SDL_GetPerformanceCounter();
+			for (frame = 0; frame < frames; frame++)
+				render_cameras(&game);
+			milliseconds = (SDL_GetPerformanceCounter() - start) * 1000.0 /
+				SDL_GetPerformanceFrequency() / frames;
+			printf("%-9s  %6d  %8.3f  %13.2f  %11.0f\n", batched ? "batched" :
+					"immediate", grates, milliseconds, game.stats.columns ?
+					(double)game.stats.layers / game.stats.columns : 0,
+					(double)game.stats.render_calls / frames);
+		}
+	}
+	bench_cleanup(&game, target);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * bench_setup - Prepares a game rendering into an offscreen surface.
+ * @game: Pointer to the zeroed Game structure.
+ * @target: Pointer to store the surface rendered into.
+ *
+ * Return: true on success, false otherwise.
+ */
+static bool bench_setup(struct Game *game, SDL_Surface **target)
+{
+	*target = SDL_CreateRGBSurfaceWithFormat(0, WINDOW_WIDTH, WINDOW_HEIGHT,
+			32, SDL_PIXELFORMAT_ARGB8888);
+	game->renderer = *target ? SDL_CreateSoftwareRenderer(*target) : NULL;
+	if (!game->renderer)
+	{
+		fprintf(stderr, "Error creating renderer: %s\n", SDL_GetError());
+		return (false);
+	}
+	game->wall_texture = load_texture(game->renderer,
+			"./textures/grasstexture1.jpg");
+	game->ground_texture = load_texture(game->renderer,
+			"./textures/groundtexture4.jpg");
+	game->pistol_texture = load_texture(game->renderer,
+			"./textures/pistol.png");
+	game->grate_texture = create_grate_texture(game->renderer);
+	game->map_width = CORRIDOR_LENGTH;
+	game->map_height = CORRIDOR_HEIGHT;
+	game->map = malloc(sizeof(*game->map) * CORRIDOR_LENGTH * CORRIDOR_HEIGHT);
+	game->jobs = job_pool_create(job_pool_default_threads());
+	game->player_count = 1;
+	game->players[0].x = TILE_SIZE + TILE_SIZE / 2;
+	game->players[0].y = CORRIDOR_HEIGHT / 2 * TILE_SIZE + TILE_SIZE / 2;
+	update_direction(&game->players[0]);
+	setup_cameras(game);
+	return (game->wall_texture && game->ground_texture &&
+			game->pistol_texture && game->grate_texture && game->map &&
+			game->jobs && arena_init(&game->frame_arena, FRAME_ARENA_BYTES));
+}
+
+/**
+ * bench_corridor - Fills the map with a corridor crossed by grates.
+ * @game: Pointer to the Game structure.
+ * @grates: Number of grates, two tiles apart, in front of the player.
+ *
+ * The corridor ends on a thin wall, so every column of the view sees
+ * through all of them.
+ */
+static void bench_corridor(struct Game *game, int grates)
+{
+	int x, y, type;
+
+	for (y = 0; y < CORRIDOR_HEIGHT; y++)
+		for (x = 0; x < CORRIDOR_LENGTH; x++)
+		{
+			type = x == 0 || y == 0 || x == CORRIDOR_LENGTH - 1 ||
+				y == CORRIDOR_HEIGHT - 1 ? MAP_WALL : MAP_FLOOR;
+			if (type == MAP_FLOOR && x == CORRIDOR_LENGTH - 2)
+				type = MAP_THIN_X;
+			else if (type == MAP_FLOOR && x > 1 && x % 2 == 0 &&
+					x / 2 <= grates)
+				type = MAP_GRATE_X;
+			game->map[y * CORRIDOR_LENGTH + x] = MAP_CELL(type, 0);
+		}
+	map_measure_cells(game);
+	game->map_revision++;
+}
+
+/**
+ * bench_cleanup - Releases what bench_setup() created.
+ * @game: Pointer to the Game structure.
+ * @target: Surface rendered into, may be NULL.
+ */
+static void bench_cleanup(struct Game *game, SDL_Surface *target)
+{
+	render_batches_destroy(game->batches);
+	job_pool_destroy(game->jobs);
+	arena_free(&game->frame_arena);
+	free(game->map);
+	SDL_DestroyTexture(game->wall_texture);
+	SDL_DestroyTexture(game->ground_texture);
+	SDL_DestroyTexture(game->pistol_texture);
+	SDL_DestroyTexture(game->grate_texture);
+	if (game->renderer)
+		SDL_DestroyRenderer(game->renderer);
+	SDL_FreeSurface(target);
+}
@@ -0,0 +1,36 @@
+#include "../inc/maze_gen.h"
+
+/**
+ * main - Generates a maze map file and reports the generation throughput.
+ * @argc: argument count
+ * @argv: argument array
+ *
+ * Usage: mazegen maze:<backtracker|wilson|eller>:<W>x<H>[:<seed>] <output>
+ *
+ * Return: Exit status.
+ */
+int main(int argc, char *argv[])
+{
+	struct MazeSpec spec;
+	Uint64 start, elapsed;
+	double seconds, cells;
+
+	if (argc != 3 || !maze_parse_spec(argv[1], &spec))
+	{
+		fprintf(stderr, "Usage: %s maze:<backtracker|wilson|eller>:<W>x<H>[:<seed>]"
+				" <output_file>\n", argv[0]);
+		return (EXIT_FAILURE);
+	}
+
+	start = SDL_GetPerformanceCounter();
+	if (!maze_write_map_file(&spec, argv[2]))
+		return (EXIT_FAILURE);
+	elapsed = SDL_GetPerformanceCounter() - start;
+
+	seconds = (double)elapsed / SDL_GetPerformanceFrequency();
+	cells = (double)spec.cells_x * spec.cells_y;
+	printf("%s: %d x %d cells (%d x %d tiles) in %.3f s, %.0f cells/sec\n",
+			argv[2], spec.cells_x, spec.cells_y, 2 * spec.cells_x + 1,
+			2 * spec.cells_y + 1, seconds, seconds > 0 ? cells / seconds : 0);
+	return (EXIT_SUCCESS);
+}
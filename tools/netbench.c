@@ -0,0 +1,179 @@
+#include "../inc/game.h"
+#include <sys/socket.h>
+
+#define DEFAULT_TICKS 600
+#define JOIN_TICKS 200
+#define TICK_SECONDS (1.0f / 60)
+#define TICK_RATE 60
+#define BUTTON_CHANGE 30
+
+static bool run_clients(const struct Game *game, int count, int ticks);
+static int join_clients(struct NetServer *server, struct NetClient **clients,
+		int count);
+static bool play_ticks(struct NetServer *server, struct NetClient **clients,
+		int count, int ticks, Uint64 times[2]);
+
+/**
+ * main - Benchmarks the server with simulated clients over loopback.
+ * @argc: argument count
+ * @argv: argument array
+ *
+ * Usage: netbench <map_file | maze:...> [ticks] [clients...]
+ *
+ * Every client holds random keys, changed now and then, and the server
+ * runs at TICK_RATE ticks per simulated second. Each run reports the
+ * time a tick takes and the snapshot bandwidth per client, next to what
+ * the same snapshots would cost without delta compression.
+ *
+ * Return: Exit status.
+ */
+int main(int argc, char *argv[])
+{
+	static const int default_counts[] = {50, 100, 200, 400};
+	struct Game game = {0};
+	int ticks = argc > 2 ? atoi(argv[2]) : DEFAULT_TICKS, i, count;
+	int runs = argc > 3 ? argc - 3 : 4;
+
+	if (argc < 2 || ticks <= 0 || !parse_map_file(&game, argv[1]) ||
+			!game.map)
+	{
+		fprintf(stderr, "Usage: %s <map_file|maze:...> [ticks] "
+				"[clients...]\n", argv[0]);
+		return (EXIT_FAILURE);
+	}
+	for (i = 0; i < runs; i++)
+	{
+		count = argc > 3 ? atoi(argv[3 + i]) : default_counts[i];
+		if (count <= 0 || count > NET_MAX_CLIENTS ||
+				!run_clients(&game, count, ticks))
+		{
+			free(game.map);
+			return (EXIT_FAILURE);
+		}
+	}
+	free(game.map);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * run_clients - Runs a server with a number of clients and reports.
+ * @game: Pointer to the Game holding the map.
+ * @count: Number of clients.
+ * @ticks: Number of ticks measured, once every client joined.
+ *
+ * Return: true on success, false if the run could not be set up.
+ */
+static bool run_clients(const struct Game *game, int count, int ticks)
+{
+	struct NetServer *server = net_server_create(game, 0);
+	struct NetClient **clients = calloc(count, sizeof(*clients));
+	Uint64 times[2] = {0, 0};
+	long dropped = 0;
+	double frequency = SDL_GetPerformanceFrequency();
+	int i, joined = 0;
+
+	if (server && clients)
+		joined = join_clients(server, clients, count);
+	if (joined == count && play_ticks(server, clients, count, ticks, times))
+	{
+		for (i = 0; i < count; i++)
+			dropped += clients[i]->dropped;
+		printf("%4d clients: tick %.3f ms (max %.3f)  %5.1f entities/snapshot"
+				"  %6.1f B/client/tick  %5.1f kbit/s/client  full %6.1f B"
+				" (%.1fx)  dropped %ld\n", count,
+				times[0] * 1000.0 / frequency / ticks,
+				times[1] * 1000.0 / frequency,
+				(double)server->stats.entities / server->stats.snapshots,
+				(double)server->stats.bytes / server->stats.snapshots,
+				server->stats.bytes * 8.0 * TICK_RATE / 1000 /
+				server->stats.snapshots,
+				(double)server->stats.full_bytes / server->stats.snapshots,
+				(double)server->stats.full_bytes / server->stats.bytes,
+				dropped);
+	}
+	else
+		fprintf(stderr, "Only %d of %d clients joined\n", joined, count);
+	for (i = 0; clients && i < count; i++)
+		net_client_destroy(clients[i]);
+	free(clients);
+	net_server_destroy(server);
+	return (joined == count);
+}
+
+/**
+ * play_ticks - Runs the server with every client holding random keys.
+ * @server: Pointer to the NetServer, every client joined.
+ * @clients: Array of @count clients.
+ * @count: Number of clients.
+ * @ticks: Number of ticks to run.
+ * @times: Receives the performance counter ticks all server ticks took,
+ *		then the slowest one.
+ *
+ * Return: true on success, false if memory ran out.
+ */
+static bool play_ticks(struct NetServer *server, struct NetClient **clients,
+		int count, int ticks, Uint64 times[2])
+{
+	struct MazeRng rng = {MAZE_DEFAULT_SEED};
+	int *buttons = calloc(count, sizeof(*buttons)), tick, i;
+	Uint64 start;
+
+	if (!buttons)
+		return (false);
+	memset(&server->stats, 0, sizeof(server->stats));
+	for (tick = 0; tick < ticks; tick++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			if (maze_rng_below(&rng, BUTTON_CHANGE) == 0)
+				buttons[i] = maze_rng_below(&rng, 1 << INPUT_BUTTONS);
+			net_client_send(clients[i], buttons[i]);
+		}
+		start = SDL_GetPerformanceCounter();
+		net_server_tick(server, NULL, TICK_SECONDS);
+		start = SDL_GetPerformanceCounter() - start;
+		times[0] += start;
+		times[1] = SDL_max(times[1], start);
+		for (i = 0; i < count; i++)
+			net_client_receive(clients[i]);
+	}
+	free(buttons);
+	return (true);
+}
+
+/**
+ * join_clients - Connects clients to a server on the loopback interface.
+ * @server: Pointer to the NetServer.
+ * @clients: Array of @count client pointers to fill.
+ * @count: Number of clients.
+ *
+ * Return: Number of clients that joined within JOIN_TICKS ticks.
+ */
+static int join_clients(struct NetServer *server, struct NetClient **clients,
+		int count)
+{
+	struct sockaddr_in address;
+	socklen_t size = sizeof(address);
+	char text[32];
+	int i, tick, joined = 0;
+
+	if (getsockname(server->socket, (struct sockaddr *)&address, &size) != 0)
+		return (0);
+	snprintf(text, sizeof(text), "127.0.0.1:%d", ntohs(address.sin_port));
+	for (i = 0; i < count; i++)
+		if (!(clients[i] = net_client_create(&server->sim, text)))
+			return (0);
+	for (tick = 0; tick < JOIN_TICKS && joined < count; tick++)
+	{
+		net_server_tick(server, NULL, 0);
+		for (i = 0, joined = 0; i < count; i++)
+		{
+			net_client_receive(clients[i]);
+			if (clients[i]->id)
+				joined++;
+			else if (tick % 10 == 0)
+				net_client_hello(clients[i]);
+		}
+	}
+	return (joined);
+}
@@ -0,0 +1,156 @@
+#include "../inc/game.h"
+#include "../inc/maze_gen.h"
+#include "../inc/pathfind.h"
+
+#define DEFAULT_QUERIES 1000
+
+static void run_queries(const struct Game *game,
+		struct Pathfinder *pathfinder, int queries);
+static int random_floor_tile(const struct Game *game, struct MazeRng *rng);
+static void run_algorithm(struct Pathfinder *pathfinder,
+		enum PathAlgorithm algorithm, const int *pairs, int queries,
+		float *costs);
+
+/**
+ * main - Benchmarks A*, JPS and HPA* queries on one map.
+ * @argc: argument count
+ * @argv: argument array
+ *
+ * Usage: pathbench <map_file | maze:<algorithm>:<W>x<H>[:<seed>]> [queries]
+ *
+ * Return: Exit status.
+ */
+int main(int argc, char *argv[])
+{
+	struct Game game = {0};
+	struct Pathfinder *pathfinder;
+	int queries = argc > 2 ? atoi(argv[2]) : DEFAULT_QUERIES;
+	Uint64 start;
+
+	if (argc < 2 || argc > 3 || queries <= 0)
+	{
+		fprintf(stderr, "Usage: %s <map_file|maze:<algorithm>:<W>x<H>[:<seed>]>"
+				" [queries]\n", argv[0]);
+		return (EXIT_FAILURE);
+	}
+	if (!parse_map_file(&game, argv[1]))
+		return (EXIT_FAILURE);
+	if (!game.map)
+	{
+		fprintf(stderr, "Streamed worlds have no pathfinder\n");
+		world_destroy(game.world);
+		return (EXIT_FAILURE);
+	}
+	start = SDL_GetPerformanceCounter();
+	pathfinder = pathfinder_create(game.map, game.map_width, game.map_height,
+			NULL);
+	if (!pathfinder)
+	{
+		fprintf(stderr, "Not enough memory for the pathfinder\n");
+		free(game.map);
+		return (EXIT_FAILURE);
+	}
+	printf("%s: %d x %d tiles, HPA* build %.1f ms, %d nodes, %d edges\n",
+			argv[1], game.map_width, game.map_height,
+			(SDL_GetPerformanceCounter() - start) * 1000.0 /
+			SDL_GetPerformanceFrequency(), pathfinder->hpa.node_count,
+			pathfinder->hpa.edge_count);
+	run_queries(&game, pathfinder, queries);
+	pathfinder_destroy(pathfinder);
+	free(game.map);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * run_queries - Runs the same random queries with every algorithm.
+ * @game: Pointer to the Game holding the map.
+ * @pathfinder: Pointer to the Pathfinder of the map.
+ * @queries: Number of queries.
+ */
+static void run_queries(const struct Game *game,
+		struct Pathfinder *pathfinder, int queries)
+{
+	struct MazeRng rng = {MAZE_DEFAULT_SEED};
+	int *pairs = malloc(2 * queries * sizeof(*pairs)), i;
+	float *costs = malloc(3 * queries * sizeof(*costs));
+
+	for (i = 0; pairs && i < 2 * queries; i++)
+		pairs[i] = random_floor_tile(game, &rng);
+	if (pairs && costs)
+	{
+		run_algorithm(pathfinder, PATH_ASTAR, pairs, queries, costs);
+		run_algorithm(pathfinder, PATH_JPS, pairs, queries, costs + queries);
+		run_algorithm(pathfinder, PATH_HPA, pairs, queries,
+				costs + 2 * queries);
+	}
+	free(pairs);
+	free(costs);
+}
+
+/**
+ * random_floor_tile - Picks a random walkable tile.
+ * @game: Pointer to the Game holding the map.
+ * @rng: Pointer to the random generator.
+ *
+ * Return: Map index of a floor tile.
+ */
+static int random_floor_tile(const struct Game *game, struct MazeRng *rng)
+{
+	int tile;
+
+	do {
+		tile = maze_rng_below(rng, game->map_width * game->map_height);
+	} while (MAP_CELL_TYPE(game->map[tile]) != MAP_FLOOR);
+	return (tile);
+}
+
+/**
+ * run_algorithm - Times one algorithm over every query and prints a line.
+ * @pathfinder: Pointer to the Pathfinder.
+ * @algorithm: Algorithm to benchmark.
+ * @pairs: Start and goal tiles of every query.
+ * @queries: Number of queries.
+ * @costs: Array receiving the path cost of every query; A* costs come
+ *		first in memory, so later algorithms compare against them.
+ */
+static void run_algorithm(struct Pathfinder *pathfinder,
+		enum PathAlgorithm algorithm, const int *pairs, int queries,
+		float *costs)
+{
+	static const char * const names[] = {"A*", "JPS", "HPA*"};
+	const float *optimal = costs - algorithm * queries;
+	struct PathResult result;
+	long expanded = 0;
+	int i, found = 0, mismatches = 0;
+	double seconds, excess = 0;
+	Uint64 start = SDL_GetPerformanceCounter();
+
+	for (i = 0; i < queries; i++)
+	{
+		costs[i] = -1;
+		if (!pathfinder_query(pathfinder, algorithm, pairs[2 * i],
+					pairs[2 * i + 1], &result))
+			continue;
+		found++;
+		expanded += result.expanded;
+		costs[i] = result.cost;
+	}
+	seconds = (double)(SDL_GetPerformanceCounter() - start) /
+		SDL_GetPerformanceFrequency();
+	for (i = 0; i < queries; i++)
+	{
+		if (algorithm == PATH_JPS && fabsf(costs[i] - optimal[i]) >
+				1e-3f * (1 + optimal[i]))
+			mismatches++;
+		if (algorithm == PATH_HPA && optimal[i] > 0 && costs[i] > 0)
+			excess += costs[i] / optimal[i] - 1;
+	}
+	printf("%-5s %10.0f queries/sec %12.1f nodes expanded/query  %d/%d found",
+			names[algorithm], seconds > 0 ? queries / seconds : 0,
+			found ? (double)expanded / found : 0, found, queries);
+	if (algorithm == PATH_JPS)
+		printf("  %d cost mismatches vs A*", mismatches);
+	if (algorithm == PATH_HPA)
+		printf("  %.2f%% longer than A*", 100 * excess / queries);
+	printf("\n");
+}
@@ -0,0 +1,153 @@
+#include "../inc/game.h"
+
+#define DEFAULT_MINUTES 60
+#define TICK_RATE 60
+#define TICK_SECONDS (1.0f / TICK_RATE)
+#define BUTTON_CHANGE 90
+#define SEEKS 100000
+#define SAVE_PATH "snapbench.snap"
+
+static void play(struct Game *game, Uint8 *images, long ticks);
+static long check_seeks(const struct SnapshotRing *ring,
+		const Uint8 *images, double *mean_us, double *max_us);
+
+/**
+ * main - Records a simulated session and measures seeks into it.
+ * @argc: argument count
+ * @argv: argument array
+ *
+ * Usage: snapbench <map_file | maze:...> [minutes] [players]
+ *
+ * The players hold random keys, changed every BUTTON_CHANGE ticks and
+ * none at all a third of the time, for the given minutes at TICK_RATE
+ * ticks per second. The run reports the record time and the bytes per
+ * tick, then seeks to random ticks, checking each against the image
+ * recorded, and checks the history survives a save and a load.
+ *
+ * Return: Exit status.
+ */
+int main(int argc, char *argv[])
+{
+	struct Game game = {0};
+	long ticks = (argc > 2 ? atol(argv[2]) : DEFAULT_MINUTES) * 60 *
+		TICK_RATE, held, wrong;
+	Uint8 *images = NULL;
+	double mean_us, max_us;
+
+	game.player_count = argc > 3 ? atoi(argv[3]) : 1;
+	if (argc < 2 || ticks <= 0 || game.player_count < 1 ||
+			game.player_count > MAX_PLAYERS || !parse_map_file(&game, argv[1]))
+	{
+		fprintf(stderr, "Usage: %s <map_file|maze:...> [minutes] [players]\n",
+				argv[0]);
+		return (EXIT_FAILURE);
+	}
+	game.snapshots = snapshot_create();
+	images = malloc((size_t)ticks * SNAPSHOT_IMAGE_BYTES);
+	if (!game.snapshots || !images)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return (EXIT_FAILURE);
+	}
+	play(&game, images, ticks);
+	held = snapshot_last_tick(game.snapshots) -
+		snapshot_first_tick(game.snapshots) + 1;
+	wrong = check_seeks(game.snapshots, images, &mean_us, &max_us);
+	printf("seek %.3f us (max %.3f)  %ld of %d wrong\n", mean_us, max_us,
+			wrong, SEEKS);
+	if (!snapshot_save(&game, SAVE_PATH) || !snapshot_load(&game,
+				SAVE_PATH) || snapshot_last_tick(game.snapshots) -
+			snapshot_first_tick(game.snapshots) + 1 != held)
+		wrong++;
+	else
+		wrong += check_seeks(game.snapshots, images, &mean_us, &max_us);
+	remove(SAVE_PATH);
+	printf("after save and load: %s\n", wrong ? "WRONG" : "same history");
+	snapshot_destroy(game.snapshots);
+	free(images);
+	free(game.map);
+	return (wrong ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/**
+ * play - Moves the players with random keys, recording every tick.
+ * @game: Pointer to the Game, its map loaded.
+ * @images: @ticks images to store what each tick recorded.
+ * @ticks: Number of ticks to play.
+ */
+static void play(struct Game *game, Uint8 *images, long ticks)
+{
+	static Uint8 keys[SDL_NUM_SCANCODES];
+	struct MazeRng rng = {MAZE_DEFAULT_SEED};
+	double frequency = SDL_GetPerformanceFrequency();
+	Uint64 elapsed = 0, start;
+	long tick, held;
+	size_t bytes;
+	int i;
+
+	game->keyboard_state = keys;
+	game->delta_time = TICK_SECONDS;
+	for (i = 0; i < game->player_count; i++)
+	{
+		game->players[i].x = TILE_SIZE + TILE_SIZE / 2;
+		game->players[i].y = TILE_SIZE + TILE_SIZE / 2;
+		update_direction(&game->players[i]);
+	}
+	for (tick = 0; tick < ticks; tick++)
+	{
+		for (i = 0; tick % BUTTON_CHANGE == 0 && i < game->player_count; i++)
+			input_press(keys, i, maze_rng_below(&rng, 3) == 0 ? 0 :
+					maze_rng_below(&rng, 1 << INPUT_BUTTONS));
+		handle_input(game);
+		start = SDL_GetPerformanceCounter();
+		snapshot_record(game);
+		elapsed += SDL_GetPerformanceCounter() - start;
+		snapshot_capture(game, images + tick * SNAPSHOT_IMAGE_BYTES);
+	}
+	held = snapshot_last_tick(game->snapshots) -
+		snapshot_first_tick(game->snapshots) + 1;
+	bytes = snapshot_size(game->snapshots);
+	printf("%ld ticks: record %.3f us/tick  %ld ticks held in %.1f KiB"
+			"  %.2f B/tick  %.2f MiB/hour\n", ticks,
+			elapsed * 1e6 / frequency / ticks, held, bytes / 1024.0,
+			(double)bytes / held,
+			(double)bytes * 3600 * TICK_RATE / held / (1 << 20));
+}
+
+/**
+ * check_seeks - Seeks to random ticks held and compares the images.
+ * @ring: Pointer to the SnapshotRing.
+ * @images: Image of every tick recorded.
+ * @mean_us: Pointer to store the mean seek time, in microseconds.
+ * @max_us: Pointer to store the slowest seek time, in microseconds.
+ *
+ * Return: Number of seeks that failed or rebuilt another image.
+ */
+static long check_seeks(const struct SnapshotRing *ring,
+		const Uint8 *images, double *mean_us, double *max_us)
+{
+	struct MazeRng rng = {MAZE_DEFAULT_SEED + 1};
+	Uint8 image[SNAPSHOT_IMAGE_BYTES];
+	long first = snapshot_first_tick(ring), span, tick, wrong = 0;
+	Uint64 elapsed = 0, slowest = 0, start;
+	double frequency = SDL_GetPerformanceFrequency();
+	int i;
+
+	span = snapshot_last_tick(ring) - first + 1;
+	for (i = 0; i < SEEKS; i++)
+	{
+		tick = first + (long)(maze_rng_next(&rng) % span);
+		start = SDL_GetPerformanceCounter();
+		if (!snapshot_seek(ring, tick, image))
+			wrong++;
+		start = SDL_GetPerformanceCounter() - start;
+		elapsed += start;
+		slowest = SDL_max(slowest, start);
+		if (memcmp(image, images + tick * SNAPSHOT_IMAGE_BYTES,
+					SNAPSHOT_IMAGE_BYTES) != 0)
+			wrong++;
+	}
+	*mean_us = elapsed * 1e6 / frequency / SEEKS;
+	*max_us = slowest * 1e6 / frequency;
+	return (wrong);
+}